@@ -7,6 +7,7 @@
 #include "../config.h"
 
 #include <string.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
@@ -34,7 +35,8 @@ static QueueHandle_t data_queue = NULL;
 
 // GATT handles
 static uint16_t gatts_if = ESP_GATT_IF_NONE;
-static uint16_t telemetry_handle_table[4];  // Telemetry service handles
+static uint16_t telemetry_handle_table[7];  // Telemetry service handles
+static uint8_t analysis_seq = 0;
 static uint16_t control_handle_table[4];    // Control service handles
 static uint16_t ota_handle_table[3];        // OTA service handles
 
@@ -57,11 +59,23 @@ static const uint8_t CHAR_TEMPERATURE_UUID[16] = {
     0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0xA0
 };
 
+// CHAR_UUID_ANALYSIS (A0000006)
+static const uint8_t CHAR_ANALYSIS_UUID[16] = {
+    0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80,
+    0x00, 0x10, 0x00, 0x00, 0x06, 0x00, 0x00, 0xA0
+};
+
 static const uint8_t SERVICE_CONTROL_UUID[16] = {
     0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80,
     0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0xB0
 };
 
+// CHAR_UUID_COMMAND (B0000005), as used by the mobile app
+static const uint8_t CHAR_COMMAND_UUID[16] = {
+    0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80,
+    0x00, 0x10, 0x00, 0x00, 0x05, 0x00, 0x00, 0xB0
+};
+
 static const uint8_t SERVICE_OTA_UUID[16] = {
     0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80,
     0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC0
@@ -106,6 +120,28 @@ static const uint8_t char_prop_read_notify = ESP_GATT_CHAR_PROP_BIT_READ | ESP_G
 static const uint8_t char_prop_read_write = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_WRITE;
 static const uint8_t char_prop_write = ESP_GATT_CHAR_PROP_BIT_WRITE;
 
+// Control Service attributes
+static const esp_gatts_attr_db_t control_gatt_db[] = {
+    // Service Declaration
+    [0] = {
+        {ESP_GATT_AUTO_RSP},
+        {ESP_UUID_LEN_16, (uint8_t *)&PRIMARY_SERVICE_UUID, ESP_GATT_PERM_READ,
+         sizeof(SERVICE_CONTROL_UUID), sizeof(SERVICE_CONTROL_UUID), (uint8_t *)SERVICE_CONTROL_UUID}
+    },
+    // Command Characteristic Declaration
+    [1] = {
+        {ESP_GATT_AUTO_RSP},
+        {ESP_UUID_LEN_16, (uint8_t *)&CHAR_DECLARATION_UUID, ESP_GATT_PERM_READ,
+         sizeof(uint8_t), sizeof(char_prop_write), (uint8_t *)&char_prop_write}
+    },
+    // Command Characteristic Value
+    [2] = {
+        {ESP_GATT_AUTO_RSP},
+        {ESP_UUID_LEN_128, (uint8_t *)CHAR_COMMAND_UUID, ESP_GATT_PERM_WRITE,
+         32, 0, NULL}
+    },
+};
+
 // Telemetry Service attributes
 static const esp_gatts_attr_db_t telemetry_gatt_db[] = {
     // Service Declaration
@@ -132,6 +168,24 @@ static const esp_gatts_attr_db_t telemetry_gatt_db[] = {
         {ESP_UUID_LEN_16, (uint8_t *)&CHAR_CLIENT_CONFIG_UUID, ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE,
          2, 0, NULL}
     },
+    // Analysis Characteristic Declaration
+    [4] = {
+        {ESP_GATT_AUTO_RSP},
+        {ESP_UUID_LEN_16, (uint8_t *)&CHAR_DECLARATION_UUID, ESP_GATT_PERM_READ,
+         sizeof(uint8_t), sizeof(char_prop_read_notify), (uint8_t *)&char_prop_read_notify}
+    },
+    // Analysis Characteristic Value (one fragment)
+    [5] = {
+        {ESP_GATT_AUTO_RSP},
+        {ESP_UUID_LEN_128, (uint8_t *)CHAR_ANALYSIS_UUID, ESP_GATT_PERM_READ,
+         BLE_MTU_SIZE - 3, 0, NULL}
+    },
+    // Analysis CCCD
+    [6] = {
+        {ESP_GATT_AUTO_RSP},
+        {ESP_UUID_LEN_16, (uint8_t *)&CHAR_CLIENT_CONFIG_UUID, ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE,
+         2, 0, NULL}
+    },
 };
 
 // ===========================================
@@ -197,9 +251,20 @@ static void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatt_i
         case ESP_GATTS_CREAT_ATTR_TAB_EVT:
             if (param->add_attr_tab.status == ESP_GATT_OK) {
                 ESP_LOGI(TAG, "Attribute table created, num_handle=%d", param->add_attr_tab.num_handle);
-                memcpy(telemetry_handle_table, param->add_attr_tab.handles,
-                       sizeof(telemetry_handle_table));
-                esp_ble_gatts_start_service(telemetry_handle_table[0]);
+                
+                if (param->add_attr_tab.svc_inst_id == 0) {
+                    memcpy(telemetry_handle_table, param->add_attr_tab.handles,
+                           sizeof(telemetry_handle_table));
+                    esp_ble_gatts_start_service(telemetry_handle_table[0]);
+                    
+                    // Control service next, as instance 1
+                    esp_ble_gatts_create_attr_tab(control_gatt_db, gatts_if,
+                        sizeof(control_gatt_db) / sizeof(control_gatt_db[0]), 1);
+                } else {
+                    memcpy(control_handle_table, param->add_attr_tab.handles,
+                           sizeof(control_gatt_db) / sizeof(control_gatt_db[0]) * sizeof(uint16_t));
+                    esp_ble_gatts_start_service(control_handle_table[0]);
+                }
             }
             break;
             
@@ -271,7 +336,8 @@ static void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatt_i
             
             if (event_callback) {
                 ble_event_t evt = {
-                    .type = BLE_EVENT_DATA_RECEIVED,
+                    .type = (param->write.handle == control_handle_table[2]) ?
+                            BLE_EVENT_COMMAND : BLE_EVENT_DATA_RECEIVED,
                     .data = {
                         .handle = param->write.handle,
                         .data = param->write.value,
@@ -418,14 +484,16 @@ void ble_manager_process(void) {
             uint8_t packet[20];
             
             // Packet format: [timestamp(4)] [accel_x(2)] [accel_y(2)] [accel_z(2)] 
-            //                [temp(2)] [battery(1)] [flags(1)] [reserved(6)]
+            //                [temp(2)] [battery(1)] [flags(1)] [hours_to_critical(2)]
+            //                [reserved(4)]
             uint32_t timestamp = data.timestamp;
             memcpy(&packet[0], &timestamp, 4);
             
             int16_t ax = (int16_t)(data.accel_x * 1000);
             int16_t ay = (int16_t)(data.accel_y * 1000);
             int16_t az = (int16_t)(data.accel_z * 1000);
-            int16_t temp = (int16_t)(data.temperature * 100);
+            int16_t temp = isfinite(data.temperature)
+                ? (int16_t)(data.temperature * 100) : TEMPERATURE_CENTI_UNKNOWN;
             
             memcpy(&packet[4], &ax, 2);
             memcpy(&packet[6], &ay, 2);
@@ -433,6 +501,8 @@ void ble_manager_process(void) {
             memcpy(&packet[10], &temp, 2);
             packet[12] = data.battery_level;
             packet[13] = data.flags;
+            memcpy(&packet[14], &data.hours_to_critical, 2);
+            memset(&packet[16], 0, 4);
             
             // Send notification
             esp_ble_gatts_send_indicate(gatts_if, ble_conn_id,
@@ -470,6 +540,40 @@ esp_err_t ble_manager_queue_data(const sensor_data_t *data) {
     return ESP_OK;
 }
 
+esp_err_t ble_manager_send_analysis(uint8_t type, const uint8_t *payload, uint16_t len) {
+    if (ble_state != BLE_STATE_CONNECTED) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // Analysis is published from one task, so the fragment can be static
+    static uint8_t fragment[BLE_MTU_SIZE - 3];
+    const uint16_t mtu = (ble_mtu < BLE_MTU_SIZE) ? ble_mtu : BLE_MTU_SIZE;
+    const uint16_t chunk = mtu - 3 - BLE_ANALYSIS_HEADER_LEN;
+    const uint16_t parts = (len + chunk - 1) / chunk;
+    if (parts == 0 || parts > UINT8_MAX) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    
+    const uint8_t seq = analysis_seq++;
+    esp_err_t ret = ESP_OK;
+    
+    for (uint16_t part = 0; part < parts && ret == ESP_OK; part++) {
+        const uint16_t offset = part * chunk;
+        const uint16_t n = (len - offset < chunk) ? len - offset : chunk;
+        
+        fragment[0] = type;
+        fragment[1] = seq;
+        fragment[2] = (uint8_t)part;
+        fragment[3] = (uint8_t)parts;
+        memcpy(&fragment[BLE_ANALYSIS_HEADER_LEN], &payload[offset], n);
+        
+        ret = esp_ble_gatts_send_indicate(gatts_if, ble_conn_id, telemetry_handle_table[5],
+                                          BLE_ANALYSIS_HEADER_LEN + n, fragment, false);
+    }
+    
+    return ret;
+}
+
 esp_err_t ble_manager_send_notify(uint16_t char_handle, const uint8_t *data, uint16_t len) {
     if (ble_state != BLE_STATE_CONNECTED) {
         return ESP_ERR_INVALID_STATE;
@@ -38,9 +38,35 @@ typedef enum {
     BLE_EVENT_NOTIFY_DISABLED,
     BLE_EVENT_OTA_START,
     BLE_EVENT_OTA_DATA,
-    BLE_EVENT_OTA_COMPLETE
+    BLE_EVENT_OTA_COMPLETE,
+    BLE_EVENT_COMMAND           // Write to the control service command characteristic
 } ble_event_type_t;
 
+// ===========================================
+// Control Commands
+// ===========================================
+// Written to CHAR_UUID_COMMAND as [opcode(1)] [payload], little-endian.
+// BLE_CMD_MACHINE_PROFILE payload:
+//   [shaft_rpm f32] [line_hz f32] [rolling_elements u8]
+//   [ball_diameter_mm f32] [pitch_diameter_mm f32] [contact_angle_deg f32]
+#define BLE_CMD_MACHINE_PROFILE     0x10
+#define BLE_CMD_MACHINE_PROFILE_LEN 22
+
+// ===========================================
+// Analysis Records
+// ===========================================
+// Notified on CHAR_UUID_ANALYSIS. A record is split into fragments of at
+// most MTU - 3 bytes: [type(1)] [seq(1)] [part(1)] [parts(1)] [payload].
+// seq increments per record; the client joins parts 0..parts-1 of one seq.
+// Payloads are little-endian and start with [timestamp u32].
+#define BLE_ANALYSIS_HEADER_LEN     4
+#define BLE_ANALYSIS_VIBRATION      0x01    // Store statistics and spectrum
+#define BLE_ANALYSIS_WINDOW         0x02    // Streaming window statistics
+#define BLE_ANALYSIS_PSD            0x03    // Welch PSD
+#define BLE_ANALYSIS_DECIMATED      0x04    // Decimated acceleration
+#define BLE_ANALYSIS_ENVELOPE       0x05    // Envelope spectrum and bearing lines
+#define BLE_ANALYSIS_FAULTS         0x06    // Goertzel fault-frequency amplitudes
+
 // ===========================================
 // BLE Event Data
 // ===========================================
@@ -126,6 +152,16 @@ esp_err_t ble_manager_get_peer_addr(uint8_t *addr);
  */
 esp_err_t ble_manager_queue_data(const sensor_data_t *data);
 
+/**
+ * Notify an analysis record on the analysis characteristic
+ * Fragments the payload to the negotiated MTU.
+ * @param type Record type (BLE_ANALYSIS_*)
+ * @param payload Record payload
+ * @param len Payload length
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if not connected
+ */
+esp_err_t ble_manager_send_analysis(uint8_t type, const uint8_t *payload, uint16_t len);
+
 /**
  * Send notification to connected device
  * @param char_handle Characteristic handle
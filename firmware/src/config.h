@@ -26,9 +26,19 @@
 #define I2C_MASTER_SDA_IO       21
 #define I2C_MASTER_NUM          I2C_NUM_0
 #define I2C_MASTER_FREQ_HZ      400000
+#define MPU6050_INT_GPIO        19      // MPU6050 INT (data ready)
+
+// Secondary I2C bus for additional accelerometers
+#define I2C_SECONDARY_SCL_IO    26
+#define I2C_SECONDARY_SDA_IO    25
+#define I2C_SECONDARY_NUM       I2C_NUM_1
+#define I2C_SECONDARY_FREQ_HZ   400000
 
 // OneWire for DS18B20
 #define ONEWIRE_GPIO            4
+#define ONEWIRE_USE_RMT         1       // Hardware-timed slots (bit-bang fallback)
+#define ONEWIRE_RMT_TX_CHANNEL  RMT_CHANNEL_0
+#define ONEWIRE_RMT_RX_CHANNEL  RMT_CHANNEL_1
 
 // LED Indicator
 #define LED_GPIO                2
@@ -58,6 +68,7 @@
 #define CHAR_UUID_TEMPERATURE   "A0000003-0000-1000-8000-00805F9B34FB"
 #define CHAR_UUID_BATTERY       "A0000004-0000-1000-8000-00805F9B34FB"
 #define CHAR_UUID_ALERTS        "A0000005-0000-1000-8000-00805F9B34FB"
+#define CHAR_UUID_ANALYSIS      "A0000006-0000-1000-8000-00805F9B34FB"
 
 // Characteristic UUIDs - Control
 #define CHAR_UUID_SAMPLE_RATE   "B0000002-0000-1000-8000-00805F9B34FB"
@@ -75,17 +86,71 @@
 // ===========================================
 // MPU6050
 #define MPU6050_ADDR            0x68
+#define MPU6050_ADDR_ALT        0x69    // Second sensor with AD0 tied high
 #define MPU6050_ACCEL_RANGE     MPU6050_ACCEL_RANGE_4G
 #define MPU6050_GYRO_RANGE      MPU6050_GYRO_RANGE_500DPS
 #define MPU6050_DLPF_BW         MPU6050_DLPF_BW_42
+#define MPU6050_ACCEL_ONLY      1       // Gyro/temp standby, 1 kHz accel
+
+// Vibration spectrum
+#define VIB_FFT_SIZE            256     // Points per analysis frame (power of two)
+#define VIB_FFT_WINDOW          FFT_WINDOW_HANN
+#define VIB_GRAVITY_CUTOFF_HZ   0.5f    // Gravity removal high-pass corner
+#define VIB_GRAVITY_SECTIONS    2       // 4th-order Butterworth
+#define VIB_STORE_SIZE          1024    // Recent samples kept per channel (power of two), 16 KB
+
+// Welch PSD over the primary sensor's raw stream
+#define VIB_PSD_SEGMENT_MAX     512     // Storage bound, 3.5 floats per point
+#define VIB_PSD_SEGMENT         256     // Default segment length (power of two)
+#define VIB_PSD_OVERLAP         WELCH_OVERLAP_50
+#define VIB_PSD_AVERAGING       WELCH_AVG_EXPONENTIAL
+#define VIB_PSD_ALPHA           0.1f    // Exponential weight of newest segment
+#define VIB_PSD_AXIS            2       // 0 = X, 1 = Y, 2 = Z
+
+// Envelope (bearing) analysis; accel-only DLPF corner is 184 Hz
+#define VIB_ENV_BAND_LOW_HZ     100
+#define VIB_ENV_BAND_HIGH_HZ    300
+#define VIB_ENV_DECIMATION      4       // 1 kHz -> 250 Hz envelope
+#define VIB_ENV_FFT_SIZE        256     // ~1 Hz resolution, one spectrum per ~1 s
+#define VIB_ENV_AXIS            2       // 0 = X, 1 = Y, 2 = Z
+
+// Goertzel bank at machine fault frequencies (set via control service)
+#define VIB_FAULT_BLOCK_MS      1000    // Evaluation block, 1 Hz resolution
+#define VIB_FAULT_AXIS          2       // 0 = X, 1 = Y, 2 = Z
+#define VIB_TARGETED_ONLY       0       // 1 = battery node: Goertzel bank only,
+                                        //     no PSD/envelope/stats FFTs
+
+// Multi-rate streams of the primary sensor, decimate by 10 per stage
+#define VIB_DECIM_STAGES        2       // 1 kHz -> 100 Hz -> 10 Hz
+
+// Streaming per-axis statistics of the primary sensor
+#define VIB_STATS_WINDOW_MS     1000    // Short window
+#define VIB_STATS_LONG_WINDOWS  60      // Short windows merged per long window
+
+// Long-horizon trend of the long-window aggregates (time to critical)
+#define PROGNOSIS_LEVEL_RATIO       60      // Long windows per coarse point (1 min -> 1 h)
+#define PROGNOSIS_MIN_R2            0.6f    // Fit quality needed for an estimate
+#define PROGNOSIS_VELOCITY_LO_HZ    10.0f   // ISO 10816 velocity band
+#define PROGNOSIS_VELOCITY_HI_HZ    1000.0f // Capped at Nyquist and the DLPF corner:
+                                            // 10-184 Hz in accel-only mode
+#define PROGNOSIS_VELOCITY_CRITICAL 7.1f    // mm/s RMS, ISO 10816 class II zone C/D
+#define PROGNOSIS_KURTOSIS_CRITICAL 6.0f
+
+// Raw acceleration ring buffer (samples, power of two)
+#define RAW_SAMPLE_RING_SIZE    2048    // ~2 s at 1 kHz, 12 KB per detected
+                                        // accelerometer, heap while acquiring
+#define RAW_DRAIN_INTERVAL_MS   20      // FIFO holds ~170 ms of accel frames at 1 kHz
+#define RAW_DRAIN_BATCH         64      // Samples converted per read_raw_float() call
 
 // DS18B20
 #define DS18B20_RESOLUTION      12  // 12-bit resolution
+#define DS18B20_INTERVAL_MS     1000    // Time between conversion starts
 
 // Sample rates (ms)
 #define SAMPLE_INTERVAL_NORMAL  1000    // 1 second
 #define SAMPLE_INTERVAL_FAST    100     // 100ms for detailed analysis
 #define SAMPLE_INTERVAL_SLOW    5000    // 5 seconds for power saving
+#define ANALYSIS_INTERVAL_MS    1000    // Analysis notifications while connected
 
 // ===========================================
 // Thresholds (Default Values)
@@ -95,11 +160,22 @@
 #define DEFAULT_TEMP_WARNING        60.0f   // °C
 #define DEFAULT_TEMP_CRITICAL       80.0f   // °C
 
+// Alert debouncing: a level is entered after the raise dwell beyond its
+// limit and left after the clear dwell inside limit - hysteresis
+#define ALERT_VIBRATION_HYSTERESIS  0.2f    // g
+#define ALERT_TEMP_HYSTERESIS       2.0f    // °C
+#define ALERT_BATTERY_HYSTERESIS    5.0f    // %
+#define ALERT_RAISE_DWELL_MS        3000
+#define ALERT_CLEAR_DWELL_MS        10000
+#define ALERT_LOG_BURST             4       // Transition log lines per metric...
+#define ALERT_LOG_WINDOW_MS         60000   // ...per window
+
 // ===========================================
 // Power Management
 // ===========================================
 #define BATTERY_LOW_THRESHOLD   20      // %
 #define BATTERY_CRITICAL        10      // %
+#define BATTERY_SAMPLE_INTERVAL_MS 1000 // Background battery measurement period
 #define SLEEP_TIMEOUT_MS        60000   // 1 minute without connection
 #define DEEP_SLEEP_TIME_US      300000000  // 5 minutes
 
@@ -0,0 +1,243 @@
+/**
+ * VibeMon Biquad Filter Implementation
+ */
+
+#include "biquad.h"
+#include "kernels.h"
+
+#include <math.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static bool valid_corner(float sample_rate_hz, float f) {
+    return sample_rate_hz > 0 && f > 0 && f < 0.5f * sample_rate_hz;
+}
+
+// Coefficient in Q30; float keeps 24 bits, ample for filter coefficients
+static bool to_q30(float v, int32_t *out) {
+    if (!(v >= -2.0f && v < 2.0f)) {
+        return false;
+    }
+    *out = (int32_t)lroundf(v * 1073741824.0f);
+    return true;
+}
+
+static inline int32_t saturate_q31(int64_t v) {
+    if (v > INT32_MAX) return INT32_MAX;
+    if (v < INT32_MIN) return INT32_MIN;
+    return (int32_t)v;
+}
+
+static void normalize(biquad_coeffs_t *c, float b0, float b1, float b2,
+                      float a0, float a1, float a2) {
+    c->b0 = b0 / a0;
+    c->b1 = b1 / a0;
+    c->b2 = b2 / a0;
+    c->a1 = a1 / a0;
+    c->a2 = a2 / a0;
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool biquad_design_lowpass(biquad_coeffs_t *c, float sample_rate_hz, float cutoff_hz, float q) {
+    if (!c || !valid_corner(sample_rate_hz, cutoff_hz) || q <= 0) {
+        return false;
+    }
+    
+    const float w0 = 2.0f * (float)M_PI * cutoff_hz / sample_rate_hz;
+    const float cw = cosf(w0);
+    const float alpha = sinf(w0) / (2.0f * q);
+    
+    normalize(c, 0.5f * (1.0f - cw), 1.0f - cw, 0.5f * (1.0f - cw),
+              1.0f + alpha, -2.0f * cw, 1.0f - alpha);
+    return true;
+}
+
+bool biquad_design_highpass(biquad_coeffs_t *c, float sample_rate_hz, float cutoff_hz, float q) {
+    if (!c || !valid_corner(sample_rate_hz, cutoff_hz) || q <= 0) {
+        return false;
+    }
+    
+    const float w0 = 2.0f * (float)M_PI * cutoff_hz / sample_rate_hz;
+    const float cw = cosf(w0);
+    const float alpha = sinf(w0) / (2.0f * q);
+    
+    normalize(c, 0.5f * (1.0f + cw), -(1.0f + cw), 0.5f * (1.0f + cw),
+              1.0f + alpha, -2.0f * cw, 1.0f - alpha);
+    return true;
+}
+
+bool biquad_design_bandpass(biquad_coeffs_t *c, float sample_rate_hz, float low_hz, float high_hz) {
+    if (!c || !valid_corner(sample_rate_hz, low_hz) ||
+        !valid_corner(sample_rate_hz, high_hz) || low_hz >= high_hz) {
+        return false;
+    }
+    
+    // Centre at the geometric mean, bandwidth in octaves between the corners
+    const float w0 = 2.0f * (float)M_PI * sqrtf(low_hz * high_hz) / sample_rate_hz;
+    const float bw = log2f(high_hz / low_hz);
+    const float sw = sinf(w0);
+    const float alpha = sw * sinhf(0.5f * logf(2.0f) * bw * w0 / sw);
+    
+    normalize(c, alpha, 0.0f, -alpha, 1.0f + alpha, -2.0f * cosf(w0), 1.0f - alpha);
+    return true;
+}
+
+bool biquad_design_butterworth(biquad_coeffs_t *c, uint8_t count, biquad_type_t type,
+                               float sample_rate_hz, float cutoff_hz) {
+    if (!c || count == 0 || count > BIQUAD_MAX_SECTIONS) {
+        return false;
+    }
+    
+    // Pole pairs of an order-2n Butterworth at angles (2k+1) pi / 4n
+    for (uint8_t k = 0; k < count; k++) {
+        const float q = 1.0f / (2.0f * cosf((float)M_PI * (2 * k + 1) / (4.0f * count)));
+        const bool ok = (type == BIQUAD_HIGHPASS)
+            ? biquad_design_highpass(&c[k], sample_rate_hz, cutoff_hz, q)
+            : biquad_design_lowpass(&c[k], sample_rate_hz, cutoff_hz, q);
+        if (!ok) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+void biquad_init(biquad_t *f, const biquad_coeffs_t *c) {
+    f->c = *c;
+    biquad_reset(f);
+}
+
+void biquad_reset(biquad_t *f) {
+    f->z1 = 0;
+    f->z2 = 0;
+}
+
+void biquad_process_block(biquad_t *f, const float *in, float *out, size_t count) {
+    const float coeffs[5] = { f->c.b0, f->c.b1, f->c.b2, f->c.a1, f->c.a2 };
+    float state[2] = { f->z1, f->z2 };
+    
+    dsp_biquad_f32(in, out, count, coeffs, state);
+    
+    f->z1 = state[0];
+    f->z2 = state[1];
+}
+
+float biquad_prime(biquad_t *f, float x) {
+    const biquad_coeffs_t *c = &f->c;
+    const float den = 1.0f + c->a1 + c->a2;
+    const float y = (den != 0) ? x * (c->b0 + c->b1 + c->b2) / den : 0;
+    
+    f->z2 = c->b2 * x - c->a2 * y;
+    f->z1 = c->b1 * x - c->a1 * y + f->z2;
+    return y;
+}
+
+bool biquad_cascade_init(biquad_cascade_t *f, const biquad_coeffs_t *c, uint8_t count) {
+    if (!f || !c || count == 0 || count > BIQUAD_MAX_SECTIONS) {
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < count; i++) {
+        biquad_init(&f->section[i], &c[i]);
+    }
+    f->count = count;
+    return true;
+}
+
+void biquad_cascade_reset(biquad_cascade_t *f) {
+    for (uint8_t i = 0; i < f->count; i++) {
+        biquad_reset(&f->section[i]);
+    }
+}
+
+void biquad_cascade_prime(biquad_cascade_t *f, float x) {
+    for (uint8_t i = 0; i < f->count; i++) {
+        x = biquad_prime(&f->section[i], x);
+    }
+}
+
+void biquad_cascade_process_block(biquad_cascade_t *f, const float *in, float *out, size_t count) {
+    for (uint8_t i = 0; i < f->count; i++) {
+        biquad_process_block(&f->section[i], (i == 0) ? in : out, out, count);
+    }
+}
+
+bool biquad_q31_coeffs(biquad_q31_coeffs_t *q, const biquad_coeffs_t *c) {
+    return q && c &&
+           to_q30(c->b0, &q->b0) && to_q30(c->b1, &q->b1) && to_q30(c->b2, &q->b2) &&
+           to_q30(c->a1, &q->a1) && to_q30(c->a2, &q->a2);
+}
+
+void biquad_q31_init(biquad_q31_t *f, const biquad_q31_coeffs_t *c) {
+    f->c = *c;
+    biquad_q31_reset(f);
+}
+
+void biquad_q31_reset(biquad_q31_t *f) {
+    f->x1 = 0;
+    f->x2 = 0;
+    f->y1 = 0;
+    f->y2 = 0;
+}
+
+void biquad_q31_process_block(biquad_q31_t *f, const int32_t *in, int32_t *out, size_t count) {
+    const int64_t b0 = f->c.b0, b1 = f->c.b1, b2 = f->c.b2;
+    const int64_t a1 = f->c.a1, a2 = f->c.a2;
+    int32_t x1 = f->x1, x2 = f->x2;
+    int32_t y1 = f->y1, y2 = f->y2;
+    
+    for (size_t i = 0; i < count; i++) {
+        const int32_t x = in[i];
+        
+        // Q30 x Q31 products; summed modulo 2^64 since partial sums may
+        // wrap even when the result fits
+        uint64_t acc = (uint64_t)(b0 * x) + (uint64_t)(b1 * x1) + (uint64_t)(b2 * x2) -
+                       (uint64_t)(a1 * y1) - (uint64_t)(a2 * y2);
+        const int32_t y = saturate_q31(((int64_t)acc + (1LL << 29)) >> 30);
+        
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        out[i] = y;
+    }
+    
+    f->x1 = x1;
+    f->x2 = x2;
+    f->y1 = y1;
+    f->y2 = y2;
+}
+
+bool biquad_q31_cascade_init(biquad_q31_cascade_t *f, const biquad_coeffs_t *c, uint8_t count) {
+    if (!f || !c || count == 0 || count > BIQUAD_MAX_SECTIONS) {
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < count; i++) {
+        biquad_q31_coeffs_t q;
+        if (!biquad_q31_coeffs(&q, &c[i])) {
+            return false;
+        }
+        biquad_q31_init(&f->section[i], &q);
+    }
+    f->count = count;
+    return true;
+}
+
+void biquad_q31_cascade_reset(biquad_q31_cascade_t *f) {
+    for (uint8_t i = 0; i < f->count; i++) {
+        biquad_q31_reset(&f->section[i]);
+    }
+}
+
+void biquad_q31_cascade_process_block(biquad_q31_cascade_t *f, const int32_t *in,
+                                      int32_t *out, size_t count) {
+    for (uint8_t i = 0; i < f->count; i++) {
+        biquad_q31_process_block(&f->section[i], (i == 0) ? in : out, out, count);
+    }
+}
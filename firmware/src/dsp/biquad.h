@@ -0,0 +1,268 @@
+/**
+ * VibeMon Biquad Filter Header
+ * Second-order IIR sections with per-instance state, designed from
+ * sample rate and corner frequency (RBJ audio cookbook forms), in float
+ * and Q31 fixed point, singly or as cascades
+ */
+
+#ifndef BIQUAD_H
+#define BIQUAD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Filter Types
+// ===========================================
+#define BIQUAD_Q_BUTTERWORTH    0.70710678f
+#define BIQUAD_MAX_SECTIONS     4       // Cascade length (filter order / 2)
+
+typedef enum {
+    BIQUAD_LOWPASS = 0,
+    BIQUAD_HIGHPASS
+} biquad_type_t;
+
+// Normalized coefficients (a0 = 1)
+typedef struct {
+    float b0, b1, b2;
+    float a1, a2;
+} biquad_coeffs_t;
+
+// One section, transposed direct form II
+typedef struct {
+    biquad_coeffs_t c;
+    float z1, z2;
+} biquad_t;
+
+// Sections applied in series
+typedef struct {
+    biquad_t section[BIQUAD_MAX_SECTIONS];
+    uint8_t count;
+} biquad_cascade_t;
+
+// Fixed-point coefficients, Q30 so |a1| up to 2 fits
+typedef struct {
+    int32_t b0, b1, b2;
+    int32_t a1, a2;
+} biquad_q31_coeffs_t;
+
+// One Q31 section, direct form I with a 64-bit accumulator: only the
+// input and output history is stored, so state never overflows
+typedef struct {
+    biquad_q31_coeffs_t c;
+    int32_t x1, x2;
+    int32_t y1, y2;
+} biquad_q31_t;
+
+typedef struct {
+    biquad_q31_t section[BIQUAD_MAX_SECTIONS];
+    uint8_t count;
+} biquad_q31_cascade_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Design a low-pass section
+ * @param c Output coefficients
+ * @param sample_rate_hz Sample rate
+ * @param cutoff_hz Corner frequency (0 < cutoff < sample_rate / 2)
+ * @param q Quality factor (BIQUAD_Q_BUTTERWORTH for maximally flat)
+ * @return true on success, false on invalid parameters
+ */
+bool biquad_design_lowpass(biquad_coeffs_t *c, float sample_rate_hz, float cutoff_hz, float q);
+
+/**
+ * Design a high-pass section
+ * @param c Output coefficients
+ * @param sample_rate_hz Sample rate
+ * @param cutoff_hz Corner frequency (0 < cutoff < sample_rate / 2)
+ * @param q Quality factor
+ * @return true on success, false on invalid parameters
+ */
+bool biquad_design_highpass(biquad_coeffs_t *c, float sample_rate_hz, float cutoff_hz, float q);
+
+/**
+ * Design a band-pass section (0 dB peak gain) between two corners
+ * @param c Output coefficients
+ * @param sample_rate_hz Sample rate
+ * @param low_hz Lower -3 dB corner
+ * @param high_hz Upper -3 dB corner (low < high < sample_rate / 2)
+ * @return true on success, false on invalid parameters
+ */
+bool biquad_design_bandpass(biquad_coeffs_t *c, float sample_rate_hz, float low_hz, float high_hz);
+
+/**
+ * Design a Butterworth low-pass or high-pass as a cascade of sections
+ * @param c Output coefficients, count entries
+ * @param count Number of sections (filter order / 2, <= BIQUAD_MAX_SECTIONS)
+ * @param type BIQUAD_LOWPASS or BIQUAD_HIGHPASS
+ * @param sample_rate_hz Sample rate
+ * @param cutoff_hz -3 dB corner (0 < cutoff < sample_rate / 2)
+ * @return true on success, false on invalid parameters
+ */
+bool biquad_design_butterworth(biquad_coeffs_t *c, uint8_t count, biquad_type_t type,
+                               float sample_rate_hz, float cutoff_hz);
+
+/**
+ * Initialize a section with coefficients and cleared state
+ * @param f Filter
+ * @param c Coefficients
+ */
+void biquad_init(biquad_t *f, const biquad_coeffs_t *c);
+
+/**
+ * Clear filter state
+ * @param f Filter
+ */
+void biquad_reset(biquad_t *f);
+
+/**
+ * Filter one sample
+ * @param f Filter
+ * @param x Input sample
+ * @return Output sample
+ */
+static inline float biquad_process(biquad_t *f, float x) {
+    float y = f->c.b0 * x + f->z1;
+    f->z1 = f->c.b1 * x - f->c.a1 * y + f->z2;
+    f->z2 = f->c.b2 * x - f->c.a2 * y;
+    return y;
+}
+
+/**
+ * Filter a block of samples (in and out may alias)
+ * @param f Filter
+ * @param in Input samples
+ * @param out Output samples
+ * @param count Number of samples
+ */
+void biquad_process_block(biquad_t *f, const float *in, float *out, size_t count);
+
+/**
+ * Set state to the steady response of a constant input
+ * Avoids the start-up transient when a signal rides on a large offset.
+ * @param f Filter
+ * @param x Constant input level
+ * @return Steady output level (x times the DC gain)
+ */
+float biquad_prime(biquad_t *f, float x);
+
+// ===========================================
+// Cascades
+// ===========================================
+
+/**
+ * Initialize a cascade with coefficients and cleared state
+ * @param f Cascade
+ * @param c Coefficients, count entries
+ * @param count Number of sections (1..BIQUAD_MAX_SECTIONS)
+ * @return true on success, false on invalid count
+ */
+bool biquad_cascade_init(biquad_cascade_t *f, const biquad_coeffs_t *c, uint8_t count);
+
+/**
+ * Clear cascade state
+ * @param f Cascade
+ */
+void biquad_cascade_reset(biquad_cascade_t *f);
+
+/**
+ * Set every section to the steady response of a constant input
+ * @param f Cascade
+ * @param x Constant input level
+ */
+void biquad_cascade_prime(biquad_cascade_t *f, float x);
+
+/**
+ * Filter one sample through all sections
+ * @param f Cascade
+ * @param x Input sample
+ * @return Output sample
+ */
+static inline float biquad_cascade_process(biquad_cascade_t *f, float x) {
+    for (uint8_t i = 0; i < f->count; i++) {
+        x = biquad_process(&f->section[i], x);
+    }
+    return x;
+}
+
+/**
+ * Filter a block of samples, one section over the whole block at a time
+ * @param f Cascade
+ * @param in Input samples
+ * @param out Output samples (may alias in)
+ * @param count Number of samples
+ */
+void biquad_cascade_process_block(biquad_cascade_t *f, const float *in, float *out, size_t count);
+
+// ===========================================
+// Q31 Fixed Point
+// ===========================================
+
+/**
+ * Convert float coefficients to Q30
+ * @param q Output coefficients
+ * @param c Float coefficients
+ * @return true on success, false if a coefficient is outside [-2, 2)
+ */
+bool biquad_q31_coeffs(biquad_q31_coeffs_t *q, const biquad_coeffs_t *c);
+
+/**
+ * Initialize a Q31 section with coefficients and cleared state
+ * @param f Filter
+ * @param c Q30 coefficients
+ */
+void biquad_q31_init(biquad_q31_t *f, const biquad_q31_coeffs_t *c);
+
+/**
+ * Clear Q31 section state
+ * @param f Filter
+ */
+void biquad_q31_reset(biquad_q31_t *f);
+
+/**
+ * Filter a block of Q31 samples (in and out may alias); saturates
+ * @param f Filter
+ * @param in Input samples
+ * @param out Output samples
+ * @param count Number of samples
+ */
+void biquad_q31_process_block(biquad_q31_t *f, const int32_t *in, int32_t *out, size_t count);
+
+/**
+ * Initialize a Q31 cascade from float coefficients
+ * @param f Cascade
+ * @param c Float coefficients, count entries
+ * @param count Number of sections (1..BIQUAD_MAX_SECTIONS)
+ * @return true on success, false on invalid count or unrepresentable coefficients
+ */
+bool biquad_q31_cascade_init(biquad_q31_cascade_t *f, const biquad_coeffs_t *c, uint8_t count);
+
+/**
+ * Clear Q31 cascade state
+ * @param f Cascade
+ */
+void biquad_q31_cascade_reset(biquad_q31_cascade_t *f);
+
+/**
+ * Filter a block of Q31 samples through all sections
+ * @param f Cascade
+ * @param in Input samples
+ * @param out Output samples (may alias in)
+ * @param count Number of samples
+ */
+void biquad_q31_cascade_process_block(biquad_q31_cascade_t *f, const int32_t *in,
+                                      int32_t *out, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BIQUAD_H
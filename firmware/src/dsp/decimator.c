@@ -0,0 +1,124 @@
+/**
+ * VibeMon Multi-Rate Decimator Implementation
+ * Polyphase in effect: filter outputs are only computed for the samples
+ * that are kept, so each stage costs one DECIMATOR_TAPS dot product per
+ * DECIMATOR_FACTOR inputs. Later stages run at a tenth of the rate of the
+ * one before and add almost nothing.
+ */
+
+#include "decimator.h"
+#include "kernels.h"
+
+#include <string.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+// Taps are symmetric, so the newest-first window correlates directly.
+// Folding the window would halve the multiplies but defeat the dot kernel.
+static float stage_output(const decimator_stage_t *st) {
+    return dsp_dot_f32(&st->history[st->pos], decimator_taps, DECIMATOR_TAPS);
+}
+
+static void queue_put(decimator_stage_t *st, float v) {
+    st->queue[(st->head + st->count) & (DECIMATOR_QUEUE_LEN - 1)] = v;
+    
+    if (st->count < DECIMATOR_QUEUE_LEN) {
+        st->count++;
+    } else {
+        st->head = (st->head + 1) & (DECIMATOR_QUEUE_LEN - 1);
+        st->overruns++;
+    }
+}
+
+/**
+ * Add one input sample to a stage
+ * @return true if the stage produced an output into *out
+ */
+static bool stage_push(decimator_stage_t *st, float x, float *out) {
+    // Newest sample first; the mirror copy keeps the window contiguous
+    st->pos = (st->pos == 0) ? DECIMATOR_TAPS - 1 : st->pos - 1;
+    st->history[st->pos] = x;
+    st->history[st->pos + DECIMATOR_TAPS] = x;
+    
+    if (++st->phase < DECIMATOR_FACTOR) {
+        return false;
+    }
+    st->phase = 0;
+    
+    *out = stage_output(st);
+    queue_put(st, *out);
+    return true;
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool decimator_init(decimator_t *dec, float input_rate_hz, uint8_t stages) {
+    if (!dec || input_rate_hz <= 0 || stages == 0 || stages > DECIMATOR_MAX_STAGES) {
+        return false;
+    }
+    
+    dec->stages = stages;
+    dec->input_rate_hz = input_rate_hz;
+    decimator_reset(dec);
+    return true;
+}
+
+void decimator_reset(decimator_t *dec) {
+    for (uint8_t s = 0; s < dec->stages; s++) {
+        decimator_stage_t *st = &dec->stage[s];
+        memset(st->history, 0, sizeof(st->history));
+        st->pos = 0;
+        st->phase = 0;
+        st->head = 0;
+        st->count = 0;
+        st->overruns = 0;
+    }
+}
+
+void decimator_push(decimator_t *dec, const float *samples, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        float v = samples[i];
+    
+        // Each stage's output is the next stage's input
+        for (uint8_t s = 0; s < dec->stages; s++) {
+            if (!stage_push(&dec->stage[s], v, &v)) {
+                break;
+            }
+        }
+    }
+}
+
+size_t decimator_available(const decimator_t *dec, uint8_t stage) {
+    return (stage < dec->stages) ? dec->stage[stage].count : 0;
+}
+
+size_t decimator_read(decimator_t *dec, uint8_t stage, float *out, size_t max) {
+    if (stage >= dec->stages) {
+        return 0;
+    }
+    
+    decimator_stage_t *st = &dec->stage[stage];
+    size_t n = (st->count < max) ? st->count : max;
+    
+    for (size_t i = 0; i < n; i++) {
+        if (out) {
+            out[i] = st->queue[st->head];
+        }
+        st->head = (st->head + 1) & (DECIMATOR_QUEUE_LEN - 1);
+    }
+    st->count -= n;
+    
+    return n;
+}
+
+float decimator_rate_hz(const decimator_t *dec, uint8_t stage) {
+    float rate = dec->input_rate_hz;
+    for (uint8_t s = 0; s <= stage; s++) {
+        rate /= DECIMATOR_FACTOR;
+    }
+    return rate;
+}
@@ -0,0 +1,103 @@
+/**
+ * VibeMon Multi-Rate Decimator Header
+ * Cascade of FIR decimate-by-DECIMATOR_FACTOR stages over one input stream.
+ * Every stage's output is queued, so a 1 kHz input yields 100 Hz and 10 Hz
+ * streams (and so on) at once, each already free of aliased vibration.
+ */
+
+#ifndef DECIMATOR_H
+#define DECIMATOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "decimator_taps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Configuration
+// ===========================================
+#define DECIMATOR_MAX_STAGES    3
+#define DECIMATOR_QUEUE_LEN     128     // Output samples held per stage (power of two)
+
+// ===========================================
+// Decimator State
+// ===========================================
+typedef struct {
+    float history[2 * DECIMATOR_TAPS];  // Each input stored twice, newest at pos
+    uint16_t pos;
+    uint8_t phase;                      // Inputs since the last output
+    
+    float queue[DECIMATOR_QUEUE_LEN];   // Outputs not yet read; oldest overwritten
+    uint16_t head;
+    uint16_t count;
+    uint32_t overruns;                  // Outputs lost to a full queue
+} decimator_stage_t;
+
+typedef struct {
+    decimator_stage_t stage[DECIMATOR_MAX_STAGES];
+    uint8_t stages;
+    float input_rate_hz;
+} decimator_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Initialize a decimator
+ * @param dec Decimator
+ * @param input_rate_hz Input sample rate
+ * @param stages Number of stages (1..DECIMATOR_MAX_STAGES)
+ * @return true on success, false on invalid parameters
+ */
+bool decimator_init(decimator_t *dec, float input_rate_hz, uint8_t stages);
+
+/**
+ * Clear filter history and drop queued outputs
+ * @param dec Decimator
+ */
+void decimator_reset(decimator_t *dec);
+
+/**
+ * Feed input samples through every stage
+ * @param dec Decimator
+ * @param samples Input samples
+ * @param count Number of samples
+ */
+void decimator_push(decimator_t *dec, const float *samples, size_t count);
+
+/**
+ * Get number of queued outputs of a stage
+ * @param dec Decimator
+ * @param stage Stage index, 0 = first decimated rate
+ * @return Sample count
+ */
+size_t decimator_available(const decimator_t *dec, uint8_t stage);
+
+/**
+ * Consume queued outputs of a stage, oldest first
+ * @param dec Decimator
+ * @param stage Stage index, 0 = first decimated rate
+ * @param out Output array (NULL to discard)
+ * @param max Maximum samples to consume
+ * @return Number of samples consumed
+ */
+size_t decimator_read(decimator_t *dec, uint8_t stage, float *out, size_t max);
+
+/**
+ * Get the output rate of a stage
+ * @param dec Decimator
+ * @param stage Stage index, 0 = first decimated rate
+ * @return Output sample rate in Hz
+ */
+float decimator_rate_hz(const decimator_t *dec, uint8_t stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DECIMATOR_H
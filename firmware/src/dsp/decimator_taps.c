@@ -0,0 +1,40 @@
+/**
+ * VibeMon Decimator Taps
+ * Generated by tools/gen_decimator_taps.py for factor 10, 100 taps. Do not edit.
+ * Passband 0..0.30 x output rate: +/-0.006 dB
+ * Aliasing bands (>= 0.70 x output rate): -58.7 dB
+ */
+
+#include "decimator_taps.h"
+
+#if DECIMATOR_FACTOR != 10 || DECIMATOR_TAPS != 100
+#error "decimator_taps.c was generated for a different factor or length"
+#endif
+
+const float decimator_taps[DECIMATOR_TAPS] = {
+    2.050421867e-05f, 8.174685719e-05f, 1.680534449e-04f, 2.715182571e-04f,
+    3.774661405e-04f, 4.651313757e-04f, 5.096568127e-04f, 4.853801595e-04f,
+    3.701452068e-04f, 1.501461764e-04f, -1.753790779e-04f, -5.904089979e-04f,
+    -1.060164798e-03f, -1.531602449e-03f, -1.936825755e-03f, -2.199520083e-03f,
+    -2.244073516e-03f, -2.006594833e-03f, -1.446619327e-03f, -5.579802111e-04f,
+    6.228246003e-04f, 2.012378918e-03f, 3.481524827e-03f, 4.862773587e-03f,
+    5.964062023e-03f, 6.588161977e-03f, 6.556229026e-03f, 5.733242858e-03f,
+    4.052550287e-03f, 1.536463421e-03f, -1.690047256e-03f, -5.395067640e-03f,
+    -9.246558024e-03f, -1.283087862e-02f, -1.568235892e-02f, -1.732193998e-02f,
+    -1.730172424e-02f, -1.525133630e-02f, -1.092145713e-02f, -4.219833401e-03f,
+    4.764479610e-03f, 1.575193123e-02f, 2.828026772e-02f, 4.172957933e-02f,
+    5.536312146e-02f, 6.838075484e-02f, 7.998044697e-02f, 8.942230790e-02f,
+    9.608921826e-02f, 9.953830305e-02f, 9.953830305e-02f, 9.608921826e-02f,
+    8.942230790e-02f, 7.998044697e-02f, 6.838075484e-02f, 5.536312146e-02f,
+    4.172957933e-02f, 2.828026772e-02f, 1.575193123e-02f, 4.764479610e-03f,
+    -4.219833401e-03f, -1.092145713e-02f, -1.525133630e-02f, -1.730172424e-02f,
+    -1.732193998e-02f, -1.568235892e-02f, -1.283087862e-02f, -9.246558024e-03f,
+    -5.395067640e-03f, -1.690047256e-03f, 1.536463421e-03f, 4.052550287e-03f,
+    5.733242858e-03f, 6.556229026e-03f, 6.588161977e-03f, 5.964062023e-03f,
+    4.862773587e-03f, 3.481524827e-03f, 2.012378918e-03f, 6.228246003e-04f,
+    -5.579802111e-04f, -1.446619327e-03f, -2.006594833e-03f, -2.244073516e-03f,
+    -2.199520083e-03f, -1.936825755e-03f, -1.531602449e-03f, -1.060164798e-03f,
+    -5.904089979e-04f, -1.753790779e-04f, 1.501461764e-04f, 3.701452068e-04f,
+    4.853801595e-04f, 5.096568127e-04f, 4.651313757e-04f, 3.774661405e-04f,
+    2.715182571e-04f, 1.680534449e-04f, 8.174685719e-05f, 2.050421867e-05f,
+};
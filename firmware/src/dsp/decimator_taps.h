@@ -0,0 +1,25 @@
+/**
+ * VibeMon Decimator Taps Header
+ * Anti-alias FIR shared by every decimation stage (placed in flash)
+ */
+
+#ifndef DECIMATOR_TAPS_H
+#define DECIMATOR_TAPS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DECIMATOR_FACTOR        10
+#define DECIMATOR_TAPS          100     // Multiple of DECIMATOR_FACTOR
+
+// Linear-phase low-pass, cutoff at the output Nyquist, unity DC gain
+extern const float decimator_taps[DECIMATOR_TAPS];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DECIMATOR_TAPS_H
@@ -0,0 +1,120 @@
+/**
+ * VibeMon Envelope Analysis Implementation
+ * Per input sample: two band-pass sections and a fabsf(); the low-pass
+ * runs at the input rate too, but only every decimation-th output is
+ * kept. The FFT runs once per fft_size envelope samples.
+ */
+
+#include "envelope.h"
+#include "kernels.h"
+
+#include <string.h>
+#include <math.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static void process_frame(envelope_t *env) {
+    const uint16_t n = env->config.fft_size;
+    
+    // The envelope's mean is the rectified band level, not a fault line
+    float mean = 0;
+    for (uint16_t i = 0; i < n; i++) {
+        mean += env->frame[i];
+    }
+    mean /= n;
+    
+    for (uint16_t i = 0; i < n; i++) {
+        env->frame[i] -= mean;
+    }
+    env->envelope_rms = sqrtf(dsp_dot_f32(env->frame, env->frame, n) / n);
+    
+    fft_window_apply_f32(&env->plan, env->frame);
+    fft_real_f32(&env->plan, env->frame);
+    fft_amplitude_f32(&env->plan, env->frame, env->spectrum);
+    
+    env->frames++;
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool envelope_init(envelope_t *env, const envelope_config_t *config, float *storage) {
+    if (!env || !config || !storage || config->decimation == 0) {
+        return false;
+    }
+    
+    const float out_rate = config->sample_rate_hz / config->decimation;
+    biquad_coeffs_t band[2], smooth[2];
+    
+    // Keep the envelope below its own Nyquist before decimating
+    if (!biquad_design_bandpass(&band[0], config->sample_rate_hz,
+                                config->band_low_hz, config->band_high_hz) ||
+        !biquad_design_butterworth(smooth, 2, BIQUAD_LOWPASS, config->sample_rate_hz,
+                                   0.4f * out_rate)) {
+        return false;
+    }
+    band[1] = band[0];
+    
+    const uint16_t n = config->fft_size;
+    if (!fft_plan_init(&env->plan, n, config->window, storage + n, NULL)) {
+        return false;
+    }
+    
+    env->config = *config;
+    env->frame = storage;
+    env->spectrum = storage + 2 * n;
+    
+    biquad_cascade_init(&env->band, band, 2);
+    biquad_cascade_init(&env->smooth, smooth, 2);
+    
+    envelope_reset(env);
+    return true;
+}
+
+void envelope_reset(envelope_t *env) {
+    biquad_cascade_reset(&env->band);
+    biquad_cascade_reset(&env->smooth);
+    
+    env->phase = 0;
+    env->fill = 0;
+    env->envelope_rms = 0;
+    env->frames = 0;
+    memset(env->spectrum, 0, (env->config.fft_size / 2) * sizeof(float));
+}
+
+uint32_t envelope_push(envelope_t *env, const float *samples, size_t count) {
+    uint32_t produced = 0;
+    
+    for (size_t i = 0; i < count; i++) {
+        float v = fabsf(biquad_cascade_process(&env->band, samples[i]));
+        v = biquad_cascade_process(&env->smooth, v);
+    
+        if (++env->phase < env->config.decimation) {
+            continue;
+        }
+        env->phase = 0;
+    
+        env->frame[env->fill++] = v;
+        if (env->fill == env->config.fft_size) {
+            process_frame(env);
+            env->fill = 0;
+            produced++;
+        }
+    }
+    
+    return produced;
+}
+
+const float *envelope_spectrum(const envelope_t *env, uint16_t *bins) {
+    if (bins) {
+        *bins = env->config.fft_size / 2;
+    }
+    return env->spectrum;
+}
+
+float envelope_bin_hz(const envelope_t *env) {
+    return env->config.sample_rate_hz / env->config.decimation / env->config.fft_size;
+}
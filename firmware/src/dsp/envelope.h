@@ -0,0 +1,103 @@
+/**
+ * VibeMon Envelope Analysis Header
+ * Band-pass around a structural resonance, full-wave rectify, low-pass and
+ * decimate, then FFT the envelope. Repetitive impacts from bearing defects
+ * modulate the resonance and show up as lines at the defect frequency.
+ */
+
+#ifndef ENVELOPE_H
+#define ENVELOPE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "biquad.h"
+#include "fft.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Configuration
+// ===========================================
+
+// Floats of caller storage needed for an envelope FFT length n:
+// envelope frame (n) + window (n) + spectrum (n/2)
+#define ENVELOPE_STORAGE_SIZE(n)    (2 * (n) + (n) / 2)
+
+typedef struct {
+    float sample_rate_hz;       // Input rate
+    float band_low_hz;          // Band-pass corners around the resonance
+    float band_high_hz;
+    uint8_t decimation;         // Input samples per envelope sample
+    uint16_t fft_size;          // Envelope samples per spectrum (power of two)
+    fft_window_t window;
+} envelope_config_t;
+
+// ===========================================
+// Analyzer State
+// ===========================================
+typedef struct {
+    envelope_config_t config;
+    fft_plan_t plan;
+    biquad_cascade_t band;      // 4th-order band-pass
+    biquad_cascade_t smooth;    // 4th-order anti-alias low-pass
+    uint8_t phase;              // Input samples since last envelope sample
+    
+    float *frame;               // Envelope samples, FFT'd in place when full
+    uint16_t fill;
+    float *spectrum;            // Latest envelope amplitude spectrum, n/2 bins
+    float envelope_rms;         // RMS of the latest frame's envelope (AC part)
+    uint32_t frames;            // Spectra produced since reset
+} envelope_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Initialize an analyzer over caller-provided storage
+ * @param env Analyzer
+ * @param config Band, decimation and FFT settings
+ * @param storage ENVELOPE_STORAGE_SIZE(config->fft_size) floats
+ * @return true on success, false on invalid configuration
+ */
+bool envelope_init(envelope_t *env, const envelope_config_t *config, float *storage);
+
+/**
+ * Clear filter state and discard the partial frame
+ * @param env Analyzer
+ */
+void envelope_reset(envelope_t *env);
+
+/**
+ * Feed input samples
+ * @param env Analyzer
+ * @param samples Input samples (acceleration)
+ * @param count Number of samples
+ * @return Number of new envelope spectra produced
+ */
+uint32_t envelope_push(envelope_t *env, const float *samples, size_t count);
+
+/**
+ * Get the latest envelope amplitude spectrum
+ * @param env Analyzer
+ * @param bins Optional output, number of bins (fft_size / 2)
+ * @return Amplitude per bin, bin k at k * envelope_bin_hz(); valid once
+ *         env->frames > 0
+ */
+const float *envelope_spectrum(const envelope_t *env, uint16_t *bins);
+
+/**
+ * Get envelope spectrum resolution
+ * @param env Analyzer
+ * @return Bin spacing in Hz
+ */
+float envelope_bin_hz(const envelope_t *env);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ENVELOPE_H
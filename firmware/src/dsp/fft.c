@@ -0,0 +1,360 @@
+/**
+ * VibeMon FFT Engine Implementation
+ * Radix-2 decimation-in-time. One set of twiddle/bit-reversal tables sized
+ * for FFT_MAX_SIZE serves every smaller size by striding. Real transforms
+ * run as an n/2-point complex FFT followed by a split (post-processing) pass.
+ */
+
+#include "fft.h"
+#include "kernels.h"
+
+#include <stddef.h>
+#include <math.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static int size_log2(uint16_t n) {
+    int log2n = 0;
+    while ((1u << log2n) < n) {
+        log2n++;
+    }
+    return ((1u << log2n) == n) ? log2n : -1;
+}
+
+static void bit_reverse_f32(float *data, uint16_t n, int log2n) {
+    const int shift = FFT_MAX_LOG2 - log2n;
+    
+    for (uint16_t i = 0; i < n; i++) {
+        uint16_t j = fft_bitrev[i] >> shift;
+        if (j > i) {
+            float re = data[2 * i];
+            float im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+}
+
+static void bit_reverse_q15(int16_t *data, uint16_t n, int log2n) {
+    const int shift = FFT_MAX_LOG2 - log2n;
+    
+    for (uint16_t i = 0; i < n; i++) {
+        uint16_t j = fft_bitrev[i] >> shift;
+        if (j > i) {
+            int16_t re = data[2 * i];
+            int16_t im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool fft_plan_init(fft_plan_t *plan, uint16_t n, fft_window_t window,
+                   float *win_f32, int16_t *win_q15) {
+    int log2n = size_log2(n);
+    if (!plan || log2n < 0 || n < FFT_MIN_SIZE || n > FFT_MAX_SIZE) {
+        return false;
+    }
+    
+    // w(i) = a0 - a1 cos(2 pi i/n) + a2 cos(4 pi i/n) - a3 cos(6 pi i/n) + a4 cos(8 pi i/n)
+    static const float coeffs[][5] = {
+        [FFT_WINDOW_RECT]            = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+        [FFT_WINDOW_HANN]            = { 0.5f, 0.5f, 0.0f, 0.0f, 0.0f },
+        [FFT_WINDOW_HAMMING]         = { 0.54f, 0.46f, 0.0f, 0.0f, 0.0f },
+        [FFT_WINDOW_BLACKMAN_HARRIS] = { 0.35875f, 0.48829f, 0.14128f, 0.01168f, 0.0f },
+        [FFT_WINDOW_FLATTOP]         = { 0.21557895f, 0.41663158f, 0.277263158f,
+                                         0.083578947f, 0.006947368f },
+    };
+    
+    if ((unsigned)window > FFT_WINDOW_FLATTOP) {
+        return false;
+    }
+    
+    const float *a = coeffs[window];
+    
+    plan->n = n;
+    plan->log2n = (uint8_t)log2n;
+    plan->window = window;
+    plan->win_f32 = (window != FFT_WINDOW_RECT) ? win_f32 : NULL;
+    plan->win_q15 = (window != FFT_WINDOW_RECT) ? win_q15 : NULL;
+    
+    // Periodic cosine-sum windows have closed-form gains
+    plan->coherent_gain = a[0];
+    plan->power_gain = a[0] * a[0] + 0.5f * (a[1] * a[1] + a[2] * a[2] +
+                                             a[3] * a[3] + a[4] * a[4]);
+    
+    if (!plan->win_f32 && !plan->win_q15) {
+        return true;
+    }
+    
+    for (uint16_t i = 0; i < n; i++) {
+        float phase = 2.0f * (float)M_PI * i / n;
+        float w = a[0] - a[1] * cosf(phase) + a[2] * cosf(2.0f * phase)
+                - a[3] * cosf(3.0f * phase) + a[4] * cosf(4.0f * phase);
+    
+        if (plan->win_f32) {
+            plan->win_f32[i] = w;
+        }
+        if (plan->win_q15) {
+            int32_t q = (int32_t)lrintf(w * 32768.0f);
+            plan->win_q15[i] = (int16_t)(q > 32767 ? 32767 : (q < -32767 ? -32767 : q));
+        }
+    }
+    
+    return true;
+}
+
+void fft_window_apply_f32(const fft_plan_t *plan, float *data) {
+    if (!plan->win_f32) {
+        return;
+    }
+    
+    dsp_mul_f32(data, plan->win_f32, data, plan->n);
+}
+
+void fft_window_apply_q15(const fft_plan_t *plan, int16_t *data) {
+    if (!plan->win_q15) {
+        return;
+    }
+    
+    for (uint16_t i = 0; i < plan->n; i++) {
+        data[i] = (int16_t)(((int32_t)data[i] * plan->win_q15[i] + 0x4000) >> 15);
+    }
+}
+
+void fft_window_apply_pair_f32(const fft_plan_t *plan, float *data) {
+    if (!plan->win_f32) {
+        return;
+    }
+    
+    for (uint16_t i = 0; i < plan->n; i++) {
+        const float w = plan->win_f32[i];
+        data[2 * i] *= w;
+        data[2 * i + 1] *= w;
+    }
+}
+
+void fft_complex_f32(float *data, uint16_t n) {
+    int log2n = size_log2(n);
+    if (log2n < 1 || n > FFT_MAX_SIZE) {
+        return;
+    }
+    
+    bit_reverse_f32(data, n, log2n);
+    
+    // W_size^k = W_M^(k*M/size)
+    for (uint16_t size = 2; size <= n; size <<= 1) {
+        dsp_fft2r_stage_f32(data, n, size >> 1, fft_twiddle_f32, FFT_MAX_SIZE / size);
+    }
+}
+
+void fft_complex_q15(int16_t *data, uint16_t n) {
+    int log2n = size_log2(n);
+    if (log2n < 1 || n > FFT_MAX_SIZE) {
+        return;
+    }
+    
+    bit_reverse_q15(data, n, log2n);
+    
+    // Each stage halves its output, so the result is DFT / n. Products and
+    // halvings round to nearest; truncating would bias every bin downwards.
+    for (uint16_t size = 2; size <= n; size <<= 1) {
+        const uint16_t half = size >> 1;
+        const uint16_t stride = FFT_MAX_SIZE / size;
+    
+        for (uint16_t k = 0; k < half; k++) {
+            const int32_t wr = fft_twiddle_q15[2 * k * stride];
+            const int32_t wi = fft_twiddle_q15[2 * k * stride + 1];
+    
+            for (uint16_t a = k; a < n; a += size) {
+                const uint16_t b = a + half;
+                const int32_t br = data[2 * b];
+                const int32_t bi = data[2 * b + 1];
+                const int32_t ar = data[2 * a];
+                const int32_t ai = data[2 * a + 1];
+    
+                int32_t tr = (wr * br + wi * bi + 0x4000) >> 15;
+                int32_t ti = (wr * bi - wi * br + 0x4000) >> 15;
+    
+                data[2 * a] = (int16_t)((ar + tr + 1) >> 1);
+                data[2 * a + 1] = (int16_t)((ai + ti + 1) >> 1);
+                data[2 * b] = (int16_t)((ar - tr + 1) >> 1);
+                data[2 * b + 1] = (int16_t)((ai - ti + 1) >> 1);
+            }
+        }
+    }
+}
+
+void fft_real_f32(const fft_plan_t *plan, float *data) {
+    const uint16_t n = plan->n;
+    const uint16_t half = n >> 1;
+    const uint16_t stride = FFT_MAX_SIZE / n;
+    
+    // Even/odd samples as one n/2-point complex sequence
+    fft_complex_f32(data, half);
+    
+    // DC and Nyquist are real; pack them into bin 0
+    float z0r = data[0];
+    float z0i = data[1];
+    data[0] = z0r + z0i;
+    data[1] = z0r - z0i;
+    
+    // X[k] = E + W^k O, X[n/2-k] = conj(E - W^k O)
+    for (uint16_t k = 1; k <= half / 2; k++) {
+        const uint16_t m = half - k;
+        const float a = data[2 * k], b = data[2 * k + 1];
+        const float c = data[2 * m], d = data[2 * m + 1];
+        const float wr = fft_twiddle_f32[2 * k * stride];
+        const float wi = fft_twiddle_f32[2 * k * stride + 1];
+    
+        const float er = 0.5f * (a + c);
+        const float ei = 0.5f * (b - d);
+        const float or_ = 0.5f * (b + d);
+        const float oi = 0.5f * (c - a);
+    
+        const float tr = wr * or_ + wi * oi;
+        const float ti = wr * oi - wi * or_;
+    
+        data[2 * k] = er + tr;
+        data[2 * k + 1] = ei + ti;
+        data[2 * m] = er - tr;
+        data[2 * m + 1] = ti - ei;
+    }
+}
+
+void fft_real_pair_f32(const fft_plan_t *plan, float *data) {
+    const uint16_t n = plan->n;
+    
+    fft_complex_f32(data, n);
+    
+    // Z = A + iB with A, B Hermitian:
+    // A[k] = (Z[k] + conj(Z[n-k])) / 2, B[k] = (Z[k] - conj(Z[n-k])) / 2i
+    // Pairs 0 and n/2 already hold {A, B} since both are real there.
+    for (uint16_t k = 1; k < n / 2; k++) {
+        const uint16_t m = n - k;
+        const float zr = data[2 * k], zi = data[2 * k + 1];
+        const float yr = data[2 * m], yi = data[2 * m + 1];
+    
+        data[2 * k] = 0.5f * (zr + yr);
+        data[2 * k + 1] = 0.5f * (zi - yi);
+        data[2 * m] = 0.5f * (zi + yi);
+        data[2 * m + 1] = 0.5f * (yr - zr);
+    }
+}
+
+void fft_real_q15(const fft_plan_t *plan, int16_t *data) {
+    const uint16_t n = plan->n;
+    const uint16_t half = n >> 1;
+    const uint16_t stride = FFT_MAX_SIZE / n;
+    
+    // Result is DFT / (n/2); the split below halves once more
+    fft_complex_q15(data, half);
+    
+    int32_t z0r = data[0];
+    int32_t z0i = data[1];
+    data[0] = (int16_t)((z0r + z0i) >> 1);
+    data[1] = (int16_t)((z0r - z0i) >> 1);
+    
+    for (uint16_t k = 1; k <= half / 2; k++) {
+        const uint16_t m = half - k;
+        const int32_t a = data[2 * k], b = data[2 * k + 1];
+        const int32_t c = data[2 * m], d = data[2 * m + 1];
+        const int32_t wr = fft_twiddle_q15[2 * k * stride];
+        const int32_t wi = fft_twiddle_q15[2 * k * stride + 1];
+    
+        const int32_t er = (a + c) >> 1;
+        const int32_t ei = (b - d) >> 1;
+        const int32_t or_ = (b + d) >> 1;
+        const int32_t oi = (c - a) >> 1;
+    
+        const int32_t tr = (wr * or_ + wi * oi + 0x4000) >> 15;
+        const int32_t ti = (wr * oi - wi * or_ + 0x4000) >> 15;
+    
+        data[2 * k] = (int16_t)((er + tr + 1) >> 1);
+        data[2 * k + 1] = (int16_t)((ei + ti + 1) >> 1);
+        data[2 * m] = (int16_t)((er - tr + 1) >> 1);
+        data[2 * m + 1] = (int16_t)((ti - ei + 1) >> 1);
+    }
+}
+
+void fft_amplitude_f32(const fft_plan_t *plan, const float *packed, float *amplitude) {
+    const uint16_t half = plan->n >> 1;
+    const float dc_scale = 1.0f / (plan->n * plan->coherent_gain);
+    const float scale = 2.0f * dc_scale;
+    
+    amplitude[0] = fabsf(packed[0]) * dc_scale;
+    dsp_cmag_f32(&packed[2], &amplitude[1], half - 1, scale);
+}
+
+void fft_amplitude_pair_f32(const fft_plan_t *plan, const float *packed,
+                            float *amplitude_a, float *amplitude_b) {
+    const uint16_t n = plan->n;
+    const float dc_scale = 1.0f / (n * plan->coherent_gain);
+    const float scale = 2.0f * dc_scale;
+    
+    amplitude_a[0] = fabsf(packed[0]) * dc_scale;
+    amplitude_b[0] = fabsf(packed[1]) * dc_scale;
+    
+    for (uint16_t k = 1; k < n / 2; k++) {
+        const uint16_t m = n - k;
+        float ar = packed[2 * k], ai = packed[2 * k + 1];
+        float br = packed[2 * m], bi = packed[2 * m + 1];
+        amplitude_a[k] = sqrtf(ar * ar + ai * ai) * scale;
+        amplitude_b[k] = sqrtf(br * br + bi * bi) * scale;
+    }
+}
+
+void fft_amplitude_q15(const fft_plan_t *plan, const int16_t *packed,
+                       float *amplitude, float scale) {
+    const uint16_t half = plan->n >> 1;
+    
+    // Packed values are already DFT / n
+    const float dc_scale = scale / plan->coherent_gain;
+    const float ac_scale = 2.0f * dc_scale;
+    
+    amplitude[0] = fabsf((float)packed[0]) * dc_scale;
+    
+    for (uint16_t k = 1; k < half; k++) {
+        int32_t re = packed[2 * k];
+        int32_t im = packed[2 * k + 1];
+        amplitude[k] = sqrtf((float)(re * re + im * im)) * ac_scale;
+    }
+}
+
+uint16_t fft_find_peak(const float *spectrum, uint16_t bins, uint16_t first_bin,
+                       float *frac_bin) {
+    uint16_t peak = first_bin;
+    
+    for (uint16_t k = first_bin + 1; k < bins; k++) {
+        if (spectrum[k] > spectrum[peak]) {
+            peak = k;
+        }
+    }
+    
+    if (frac_bin) {
+        *frac_bin = peak;
+    
+        // Parabola through the peak and its neighbours
+        if (peak > 0 && peak + 1 < bins) {
+            float alpha = spectrum[peak - 1];
+            float beta = spectrum[peak];
+            float gamma = spectrum[peak + 1];
+            float denom = alpha - 2.0f * beta + gamma;
+            if (denom != 0.0f) {
+                *frac_bin = peak + 0.5f * (alpha - gamma) / denom;
+            }
+        }
+    }
+    
+    return peak;
+}
@@ -0,0 +1,162 @@
+/**
+ * VibeMon FFT Engine Header
+ * In-place radix-2 real/complex FFT in float and Q15 fixed point
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft_tables.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Configuration
+// ===========================================
+#define FFT_MIN_SIZE            8
+
+// Periodic cosine-sum windows
+typedef enum {
+    FFT_WINDOW_RECT = 0,
+    FFT_WINDOW_HANN,
+    FFT_WINDOW_HAMMING,
+    FFT_WINDOW_BLACKMAN_HARRIS,     // 4-term, low leakage
+    FFT_WINDOW_FLATTOP,             // Accurate tone amplitude
+} fft_window_t;
+
+// Transform size plus window coefficients for one analysis setup
+typedef struct {
+    uint16_t n;                 // Real transform length (power of two)
+    uint8_t log2n;
+    fft_window_t window;
+    float *win_f32;             // n coefficients, or NULL
+    int16_t *win_q15;           // n coefficients, or NULL
+    float coherent_gain;        // Mean of window (amplitude correction)
+    float power_gain;           // Mean of window^2 (PSD / ENBW correction)
+} fft_plan_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Initialize a plan and fill window coefficient buffers
+ * @param plan Plan to initialize
+ * @param n Real transform length (FFT_MIN_SIZE .. FFT_MAX_SIZE, power of two)
+ * @param window Window type
+ * @param win_f32 Storage for n float coefficients, or NULL
+ * @param win_q15 Storage for n Q15 coefficients, or NULL
+ * @return true on success, false on invalid size
+ */
+bool fft_plan_init(fft_plan_t *plan, uint16_t n, fft_window_t window,
+                   float *win_f32, int16_t *win_q15);
+
+/**
+ * Multiply samples by the plan's float window (no-op if none)
+ * @param plan FFT plan
+ * @param data n samples
+ */
+void fft_window_apply_f32(const fft_plan_t *plan, float *data);
+
+/**
+ * Multiply samples by the plan's Q15 window (no-op if none)
+ * @param plan FFT plan
+ * @param data n samples
+ */
+void fft_window_apply_q15(const fft_plan_t *plan, int16_t *data);
+
+/**
+ * Window two interleaved real channels with one coefficient load per pair
+ * @param plan FFT plan
+ * @param data n {a, b} pairs (2n floats)
+ */
+void fft_window_apply_pair_f32(const fft_plan_t *plan, float *data);
+
+/**
+ * In-place complex FFT (unnormalized)
+ * @param data n interleaved {re, im} pairs
+ * @param n Number of complex points (power of two, <= FFT_MAX_SIZE)
+ */
+void fft_complex_f32(float *data, uint16_t n);
+
+/**
+ * In-place complex FFT in Q15, scaled by 1/n to avoid overflow
+ * @param data n interleaved {re, im} pairs
+ * @param n Number of complex points (power of two, <= FFT_MAX_SIZE)
+ */
+void fft_complex_q15(int16_t *data, uint16_t n);
+
+/**
+ * In-place real FFT (unnormalized)
+ * Output is packed: data[0] = X[0], data[1] = X[n/2] (both real),
+ * then {re, im} of X[k] at data[2k], data[2k+1] for 1 <= k < n/2.
+ * @param plan FFT plan (window is not applied here)
+ * @param data n real samples in, packed spectrum out
+ */
+void fft_real_f32(const fft_plan_t *plan, float *data);
+
+/**
+ * Two real FFTs for the price of one n-point complex FFT (unnormalized)
+ * Channel a rides in the real part, b in the imaginary part. Output pairs:
+ * [0] = {A[0], B[0]}, [n/2] = {A[n/2], B[n/2]} (all real), and for
+ * 1 <= k < n/2 complex A[k] at pair k, complex B[k] at pair n-k.
+ * @param plan FFT plan (n = real length of each channel)
+ * @param data n interleaved {a, b} pairs in, packed spectra out
+ */
+void fft_real_pair_f32(const fft_plan_t *plan, float *data);
+
+/**
+ * In-place real FFT in Q15, scaled by 1/n; same packing as fft_real_f32()
+ * @param plan FFT plan
+ * @param data n real samples in, packed spectrum out
+ */
+void fft_real_q15(const fft_plan_t *plan, int16_t *data);
+
+/**
+ * Single-sided amplitude spectrum from a packed float result
+ * Corrected for window coherent gain, so a sine of amplitude A reads A.
+ * @param plan FFT plan
+ * @param packed Output of fft_real_f32()
+ * @param amplitude Output, n/2 bins (DC .. n/2-1)
+ */
+void fft_amplitude_f32(const fft_plan_t *plan, const float *packed, float *amplitude);
+
+/**
+ * Single-sided amplitude spectra from a fft_real_pair_f32() result
+ * @param plan FFT plan
+ * @param packed Output of fft_real_pair_f32()
+ * @param amplitude_a, amplitude_b Outputs, n/2 bins each
+ */
+void fft_amplitude_pair_f32(const fft_plan_t *plan, const float *packed,
+                            float *amplitude_a, float *amplitude_b);
+
+/**
+ * Single-sided amplitude spectrum from a packed Q15 result
+ * @param plan FFT plan
+ * @param packed Output of fft_real_q15()
+ * @param amplitude Output, n/2 bins (DC .. n/2-1)
+ * @param scale Units per input LSB (e.g. 1 / LSB-per-g)
+ */
+void fft_amplitude_q15(const fft_plan_t *plan, const int16_t *packed,
+                       float *amplitude, float scale);
+
+/**
+ * Find the largest bin with parabolic sub-bin interpolation
+ * @param spectrum Magnitude spectrum
+ * @param bins Number of bins
+ * @param first_bin First bin to consider (skip DC)
+ * @param frac_bin Optional output, interpolated peak position in bins
+ * @return Index of the largest bin
+ */
+uint16_t fft_find_peak(const float *spectrum, uint16_t bins, uint16_t first_bin,
+                       float *frac_bin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFT_H
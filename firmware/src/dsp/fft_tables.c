@@ -0,0 +1,959 @@
+/**
+ * VibeMon FFT Tables
+ * Generated by tools/gen_fft_tables.py for FFT_MAX_SIZE = 2048. Do not edit.
+ */
+
+#include "fft_tables.h"
+
+#if FFT_MAX_SIZE != 2048
+#error "fft_tables.c was generated for a different FFT_MAX_SIZE"
+#endif
+
+const float fft_twiddle_f32[FFT_MAX_SIZE] = {
+    1.000000000e+00f, 0.000000000e+00f, 9.999952938e-01f, 3.067956763e-03f,
+    9.999811753e-01f, 6.135884649e-03f, 9.999576446e-01f, 9.203754782e-03f,
+    9.999247018e-01f, 1.227153829e-02f, 9.998823475e-01f, 1.533920628e-02f,
+    9.998305818e-01f, 1.840672991e-02f, 9.997694054e-01f, 2.147408028e-02f,
+    9.996988187e-01f, 2.454122852e-02f, 9.996188225e-01f, 2.760814578e-02f,
+    9.995294175e-01f, 3.067480318e-02f, 9.994306046e-01f, 3.374117185e-02f,
+    9.993223846e-01f, 3.680722294e-02f, 9.992047586e-01f, 3.987292759e-02f,
+    9.990777278e-01f, 4.293825693e-02f, 9.989412932e-01f, 4.600318213e-02f,
+    9.987954562e-01f, 4.906767433e-02f, 9.986402182e-01f, 5.213170468e-02f,
+    9.984755806e-01f, 5.519524435e-02f, 9.983015449e-01f, 5.825826450e-02f,
+    9.981181129e-01f, 6.132073630e-02f, 9.979252862e-01f, 6.438263093e-02f,
+    9.977230666e-01f, 6.744391956e-02f, 9.975114561e-01f, 7.050457339e-02f,
+    9.972904567e-01f, 7.356456360e-02f, 9.970600703e-01f, 7.662386139e-02f,
+    9.968202993e-01f, 7.968243797e-02f, 9.965711458e-01f, 8.274026455e-02f,
+    9.963126122e-01f, 8.579731234e-02f, 9.960447009e-01f, 8.885355258e-02f,
+    9.957674145e-01f, 9.190895650e-02f, 9.954807555e-01f, 9.496349533e-02f,
+    9.951847267e-01f, 9.801714033e-02f, 9.948793308e-01f, 1.010698628e-01f,
+    9.945645707e-01f, 1.041216339e-01f, 9.942404495e-01f, 1.071724250e-01f,
+    9.939069700e-01f, 1.102222073e-01f, 9.935641355e-01f, 1.132709522e-01f,
+    9.932119492e-01f, 1.163186309e-01f, 9.928504145e-01f, 1.193652148e-01f,
+    9.924795346e-01f, 1.224106752e-01f, 9.920993131e-01f, 1.254549834e-01f,
+    9.917097537e-01f, 1.284981108e-01f, 9.913108598e-01f, 1.315400287e-01f,
+    9.909026354e-01f, 1.345807085e-01f, 9.904850843e-01f, 1.376201216e-01f,
+    9.900582103e-01f, 1.406582393e-01f, 9.896220175e-01f, 1.436950332e-01f,
+    9.891765100e-01f, 1.467304745e-01f, 9.887216920e-01f, 1.497645347e-01f,
+    9.882575677e-01f, 1.527971853e-01f, 9.877841416e-01f, 1.558283977e-01f,
+    9.873014182e-01f, 1.588581433e-01f, 9.868094018e-01f, 1.618863938e-01f,
+    9.863080972e-01f, 1.649131205e-01f, 9.857975092e-01f, 1.679382950e-01f,
+    9.852776424e-01f, 1.709618888e-01f, 9.847485018e-01f, 1.739838734e-01f,
+    9.842100924e-01f, 1.770042204e-01f, 9.836624192e-01f, 1.800229014e-01f,
+    9.831054874e-01f, 1.830398880e-01f, 9.825393023e-01f, 1.860551517e-01f,
+    9.819638691e-01f, 1.890686641e-01f, 9.813791933e-01f, 1.920803970e-01f,
+    9.807852804e-01f, 1.950903220e-01f, 9.801821360e-01f, 1.980984107e-01f,
+    9.795697657e-01f, 2.011046348e-01f, 9.789481753e-01f, 2.041089661e-01f,
+    9.783173707e-01f, 2.071113762e-01f, 9.776773578e-01f, 2.101118369e-01f,
+    9.770281427e-01f, 2.131103199e-01f, 9.763697313e-01f, 2.161067971e-01f,
+    9.757021300e-01f, 2.191012402e-01f, 9.750253451e-01f, 2.220936210e-01f,
+    9.743393828e-01f, 2.250839114e-01f, 9.736442497e-01f, 2.280720832e-01f,
+    9.729399522e-01f, 2.310581083e-01f, 9.722264971e-01f, 2.340419586e-01f,
+    9.715038910e-01f, 2.370236060e-01f, 9.707721407e-01f, 2.400030224e-01f,
+    9.700312532e-01f, 2.429801799e-01f, 9.692812354e-01f, 2.459550503e-01f,
+    9.685220943e-01f, 2.489276057e-01f, 9.677538371e-01f, 2.518978182e-01f,
+    9.669764710e-01f, 2.548656596e-01f, 9.661900034e-01f, 2.578311022e-01f,
+    9.653944417e-01f, 2.607941179e-01f, 9.645897933e-01f, 2.637546790e-01f,
+    9.637760658e-01f, 2.667127575e-01f, 9.629532669e-01f, 2.696683256e-01f,
+    9.621214043e-01f, 2.726213554e-01f, 9.612804858e-01f, 2.755718193e-01f,
+    9.604305194e-01f, 2.785196894e-01f, 9.595715131e-01f, 2.814649379e-01f,
+    9.587034749e-01f, 2.844075372e-01f, 9.578264130e-01f, 2.873474595e-01f,
+    9.569403357e-01f, 2.902846773e-01f, 9.560452513e-01f, 2.932191627e-01f,
+    9.551411683e-01f, 2.961508882e-01f, 9.542280951e-01f, 2.990798263e-01f,
+    9.533060404e-01f, 3.020059493e-01f, 9.523750127e-01f, 3.049292297e-01f,
+    9.514350210e-01f, 3.078496400e-01f, 9.504860739e-01f, 3.107671527e-01f,
+    9.495281806e-01f, 3.136817404e-01f, 9.485613499e-01f, 3.165933756e-01f,
+    9.475855910e-01f, 3.195020308e-01f, 9.466009131e-01f, 3.224076788e-01f,
+    9.456073254e-01f, 3.253102922e-01f, 9.446048373e-01f, 3.282098436e-01f,
+    9.435934582e-01f, 3.311063058e-01f, 9.425731976e-01f, 3.339996514e-01f,
+    9.415440652e-01f, 3.368898534e-01f, 9.405060706e-01f, 3.397768844e-01f,
+    9.394592236e-01f, 3.426607173e-01f, 9.384035341e-01f, 3.455413250e-01f,
+    9.373390119e-01f, 3.484186802e-01f, 9.362656672e-01f, 3.512927561e-01f,
+    9.351835099e-01f, 3.541635254e-01f, 9.340925504e-01f, 3.570309612e-01f,
+    9.329927988e-01f, 3.598950365e-01f, 9.318842656e-01f, 3.627557244e-01f,
+    9.307669611e-01f, 3.656129978e-01f, 9.296408958e-01f, 3.684668300e-01f,
+    9.285060805e-01f, 3.713171940e-01f, 9.273625257e-01f, 3.741640630e-01f,
+    9.262102421e-01f, 3.770074102e-01f, 9.250492408e-01f, 3.798472089e-01f,
+    9.238795325e-01f, 3.826834324e-01f, 9.227011283e-01f, 3.855160538e-01f,
+    9.215140393e-01f, 3.883450467e-01f, 9.203182767e-01f, 3.911703843e-01f,
+    9.191138517e-01f, 3.939920401e-01f, 9.179007756e-01f, 3.968099874e-01f,
+    9.166790599e-01f, 3.996241998e-01f, 9.154487161e-01f, 4.024346509e-01f,
+    9.142097557e-01f, 4.052413140e-01f, 9.129621904e-01f, 4.080441629e-01f,
+    9.117060320e-01f, 4.108431711e-01f, 9.104412923e-01f, 4.136383122e-01f,
+    9.091679831e-01f, 4.164295601e-01f, 9.078861165e-01f, 4.192168884e-01f,
+    9.065957045e-01f, 4.220002708e-01f, 9.052967593e-01f, 4.247796812e-01f,
+    9.039892931e-01f, 4.275550934e-01f, 9.026733182e-01f, 4.303264813e-01f,
+    9.013488470e-01f, 4.330938189e-01f, 9.000158920e-01f, 4.358570799e-01f,
+    8.986744657e-01f, 4.386162385e-01f, 8.973245807e-01f, 4.413712687e-01f,
+    8.959662498e-01f, 4.441221446e-01f, 8.945994856e-01f, 4.468688402e-01f,
+    8.932243012e-01f, 4.496113297e-01f, 8.918407094e-01f, 4.523495872e-01f,
+    8.904487232e-01f, 4.550835871e-01f, 8.890483559e-01f, 4.578133036e-01f,
+    8.876396204e-01f, 4.605387110e-01f, 8.862225301e-01f, 4.632597836e-01f,
+    8.847970984e-01f, 4.659764958e-01f, 8.833633387e-01f, 4.686888220e-01f,
+    8.819212643e-01f, 4.713967368e-01f, 8.804708891e-01f, 4.741002147e-01f,
+    8.790122264e-01f, 4.767992301e-01f, 8.775452902e-01f, 4.794937577e-01f,
+    8.760700942e-01f, 4.821837721e-01f, 8.745866523e-01f, 4.848692480e-01f,
+    8.730949784e-01f, 4.875501601e-01f, 8.715950867e-01f, 4.902264833e-01f,
+    8.700869911e-01f, 4.928981922e-01f, 8.685707060e-01f, 4.955652618e-01f,
+    8.670462455e-01f, 4.982276670e-01f, 8.655136241e-01f, 5.008853826e-01f,
+    8.639728561e-01f, 5.035383837e-01f, 8.624239561e-01f, 5.061866453e-01f,
+    8.608669386e-01f, 5.088301425e-01f, 8.593018184e-01f, 5.114688504e-01f,
+    8.577286100e-01f, 5.141027442e-01f, 8.561473284e-01f, 5.167317990e-01f,
+    8.545579884e-01f, 5.193559902e-01f, 8.529606049e-01f, 5.219752929e-01f,
+    8.513551931e-01f, 5.245896827e-01f, 8.497417680e-01f, 5.271991348e-01f,
+    8.481203448e-01f, 5.298036247e-01f, 8.464909388e-01f, 5.324031279e-01f,
+    8.448535652e-01f, 5.349976199e-01f, 8.432082396e-01f, 5.375870763e-01f,
+    8.415549774e-01f, 5.401714727e-01f, 8.398937942e-01f, 5.427507849e-01f,
+    8.382247056e-01f, 5.453249884e-01f, 8.365477272e-01f, 5.478940592e-01f,
+    8.348628750e-01f, 5.504579729e-01f, 8.331701647e-01f, 5.530167056e-01f,
+    8.314696123e-01f, 5.555702330e-01f, 8.297612338e-01f, 5.581185312e-01f,
+    8.280450453e-01f, 5.606615762e-01f, 8.263210628e-01f, 5.631993440e-01f,
+    8.245893028e-01f, 5.657318108e-01f, 8.228497814e-01f, 5.682589527e-01f,
+    8.211025150e-01f, 5.707807459e-01f, 8.193475201e-01f, 5.732971667e-01f,
+    8.175848132e-01f, 5.758081914e-01f, 8.158144108e-01f, 5.783137964e-01f,
+    8.140363297e-01f, 5.808139581e-01f, 8.122505866e-01f, 5.833086529e-01f,
+    8.104571983e-01f, 5.857978575e-01f, 8.086561816e-01f, 5.882815482e-01f,
+    8.068475535e-01f, 5.907597019e-01f, 8.050313311e-01f, 5.932322950e-01f,
+    8.032075315e-01f, 5.956993045e-01f, 8.013761717e-01f, 5.981607070e-01f,
+    7.995372691e-01f, 6.006164794e-01f, 7.976908409e-01f, 6.030665985e-01f,
+    7.958369046e-01f, 6.055110414e-01f, 7.939754776e-01f, 6.079497850e-01f,
+    7.921065773e-01f, 6.103828063e-01f, 7.902302214e-01f, 6.128100824e-01f,
+    7.883464276e-01f, 6.152315906e-01f, 7.864552136e-01f, 6.176473079e-01f,
+    7.845565972e-01f, 6.200572118e-01f, 7.826505962e-01f, 6.224612794e-01f,
+    7.807372286e-01f, 6.248594881e-01f, 7.788165124e-01f, 6.272518155e-01f,
+    7.768884657e-01f, 6.296382389e-01f, 7.749531066e-01f, 6.320187359e-01f,
+    7.730104534e-01f, 6.343932842e-01f, 7.710605243e-01f, 6.367618612e-01f,
+    7.691033376e-01f, 6.391244449e-01f, 7.671389119e-01f, 6.414810128e-01f,
+    7.651672656e-01f, 6.438315429e-01f, 7.631884173e-01f, 6.461760130e-01f,
+    7.612023855e-01f, 6.485144010e-01f, 7.592091890e-01f, 6.508466850e-01f,
+    7.572088465e-01f, 6.531728430e-01f, 7.552013769e-01f, 6.554928530e-01f,
+    7.531867990e-01f, 6.578066933e-01f, 7.511651319e-01f, 6.601143421e-01f,
+    7.491363945e-01f, 6.624157776e-01f, 7.471006060e-01f, 6.647109782e-01f,
+    7.450577854e-01f, 6.669999223e-01f, 7.430079521e-01f, 6.692825883e-01f,
+    7.409511254e-01f, 6.715589548e-01f, 7.388873245e-01f, 6.738290004e-01f,
+    7.368165689e-01f, 6.760927036e-01f, 7.347388781e-01f, 6.783500431e-01f,
+    7.326542717e-01f, 6.806009978e-01f, 7.305627692e-01f, 6.828455464e-01f,
+    7.284643904e-01f, 6.850836678e-01f, 7.263591551e-01f, 6.873153409e-01f,
+    7.242470830e-01f, 6.895405447e-01f, 7.221281939e-01f, 6.917592584e-01f,
+    7.200025080e-01f, 6.939714609e-01f, 7.178700451e-01f, 6.961771315e-01f,
+    7.157308253e-01f, 6.983762494e-01f, 7.135848688e-01f, 7.005687939e-01f,
+    7.114321957e-01f, 7.027547445e-01f, 7.092728264e-01f, 7.049340804e-01f,
+    7.071067812e-01f, 7.071067812e-01f, 7.049340804e-01f, 7.092728264e-01f,
+    7.027547445e-01f, 7.114321957e-01f, 7.005687939e-01f, 7.135848688e-01f,
+    6.983762494e-01f, 7.157308253e-01f, 6.961771315e-01f, 7.178700451e-01f,
+    6.939714609e-01f, 7.200025080e-01f, 6.917592584e-01f, 7.221281939e-01f,
+    6.895405447e-01f, 7.242470830e-01f, 6.873153409e-01f, 7.263591551e-01f,
+    6.850836678e-01f, 7.284643904e-01f, 6.828455464e-01f, 7.305627692e-01f,
+    6.806009978e-01f, 7.326542717e-01f, 6.783500431e-01f, 7.347388781e-01f,
+    6.760927036e-01f, 7.368165689e-01f, 6.738290004e-01f, 7.388873245e-01f,
+    6.715589548e-01f, 7.409511254e-01f, 6.692825883e-01f, 7.430079521e-01f,
+    6.669999223e-01f, 7.450577854e-01f, 6.647109782e-01f, 7.471006060e-01f,
+    6.624157776e-01f, 7.491363945e-01f, 6.601143421e-01f, 7.511651319e-01f,
+    6.578066933e-01f, 7.531867990e-01f, 6.554928530e-01f, 7.552013769e-01f,
+    6.531728430e-01f, 7.572088465e-01f, 6.508466850e-01f, 7.592091890e-01f,
+    6.485144010e-01f, 7.612023855e-01f, 6.461760130e-01f, 7.631884173e-01f,
+    6.438315429e-01f, 7.651672656e-01f, 6.414810128e-01f, 7.671389119e-01f,
+    6.391244449e-01f, 7.691033376e-01f, 6.367618612e-01f, 7.710605243e-01f,
+    6.343932842e-01f, 7.730104534e-01f, 6.320187359e-01f, 7.749531066e-01f,
+    6.296382389e-01f, 7.768884657e-01f, 6.272518155e-01f, 7.788165124e-01f,
+    6.248594881e-01f, 7.807372286e-01f, 6.224612794e-01f, 7.826505962e-01f,
+    6.200572118e-01f, 7.845565972e-01f, 6.176473079e-01f, 7.864552136e-01f,
+    6.152315906e-01f, 7.883464276e-01f, 6.128100824e-01f, 7.902302214e-01f,
+    6.103828063e-01f, 7.921065773e-01f, 6.079497850e-01f, 7.939754776e-01f,
+    6.055110414e-01f, 7.958369046e-01f, 6.030665985e-01f, 7.976908409e-01f,
+    6.006164794e-01f, 7.995372691e-01f, 5.981607070e-01f, 8.013761717e-01f,
+    5.956993045e-01f, 8.032075315e-01f, 5.932322950e-01f, 8.050313311e-01f,
+    5.907597019e-01f, 8.068475535e-01f, 5.882815482e-01f, 8.086561816e-01f,
+    5.857978575e-01f, 8.104571983e-01f, 5.833086529e-01f, 8.122505866e-01f,
+    5.808139581e-01f, 8.140363297e-01f, 5.783137964e-01f, 8.158144108e-01f,
+    5.758081914e-01f, 8.175848132e-01f, 5.732971667e-01f, 8.193475201e-01f,
+    5.707807459e-01f, 8.211025150e-01f, 5.682589527e-01f, 8.228497814e-01f,
+    5.657318108e-01f, 8.245893028e-01f, 5.631993440e-01f, 8.263210628e-01f,
+    5.606615762e-01f, 8.280450453e-01f, 5.581185312e-01f, 8.297612338e-01f,
+    5.555702330e-01f, 8.314696123e-01f, 5.530167056e-01f, 8.331701647e-01f,
+    5.504579729e-01f, 8.348628750e-01f, 5.478940592e-01f, 8.365477272e-01f,
+    5.453249884e-01f, 8.382247056e-01f, 5.427507849e-01f, 8.398937942e-01f,
+    5.401714727e-01f, 8.415549774e-01f, 5.375870763e-01f, 8.432082396e-01f,
+    5.349976199e-01f, 8.448535652e-01f, 5.324031279e-01f, 8.464909388e-01f,
+    5.298036247e-01f, 8.481203448e-01f, 5.271991348e-01f, 8.497417680e-01f,
+    5.245896827e-01f, 8.513551931e-01f, 5.219752929e-01f, 8.529606049e-01f,
+    5.193559902e-01f, 8.545579884e-01f, 5.167317990e-01f, 8.561473284e-01f,
+    5.141027442e-01f, 8.577286100e-01f, 5.114688504e-01f, 8.593018184e-01f,
+    5.088301425e-01f, 8.608669386e-01f, 5.061866453e-01f, 8.624239561e-01f,
+    5.035383837e-01f, 8.639728561e-01f, 5.008853826e-01f, 8.655136241e-01f,
+    4.982276670e-01f, 8.670462455e-01f, 4.955652618e-01f, 8.685707060e-01f,
+    4.928981922e-01f, 8.700869911e-01f, 4.902264833e-01f, 8.715950867e-01f,
+    4.875501601e-01f, 8.730949784e-01f, 4.848692480e-01f, 8.745866523e-01f,
+    4.821837721e-01f, 8.760700942e-01f, 4.794937577e-01f, 8.775452902e-01f,
+    4.767992301e-01f, 8.790122264e-01f, 4.741002147e-01f, 8.804708891e-01f,
+    4.713967368e-01f, 8.819212643e-01f, 4.686888220e-01f, 8.833633387e-01f,
+    4.659764958e-01f, 8.847970984e-01f, 4.632597836e-01f, 8.862225301e-01f,
+    4.605387110e-01f, 8.876396204e-01f, 4.578133036e-01f, 8.890483559e-01f,
+    4.550835871e-01f, 8.904487232e-01f, 4.523495872e-01f, 8.918407094e-01f,
+    4.496113297e-01f, 8.932243012e-01f, 4.468688402e-01f, 8.945994856e-01f,
+    4.441221446e-01f, 8.959662498e-01f, 4.413712687e-01f, 8.973245807e-01f,
+    4.386162385e-01f, 8.986744657e-01f, 4.358570799e-01f, 9.000158920e-01f,
+    4.330938189e-01f, 9.013488470e-01f, 4.303264813e-01f, 9.026733182e-01f,
+    4.275550934e-01f, 9.039892931e-01f, 4.247796812e-01f, 9.052967593e-01f,
+    4.220002708e-01f, 9.065957045e-01f, 4.192168884e-01f, 9.078861165e-01f,
+    4.164295601e-01f, 9.091679831e-01f, 4.136383122e-01f, 9.104412923e-01f,
+    4.108431711e-01f, 9.117060320e-01f, 4.080441629e-01f, 9.129621904e-01f,
+    4.052413140e-01f, 9.142097557e-01f, 4.024346509e-01f, 9.154487161e-01f,
+    3.996241998e-01f, 9.166790599e-01f, 3.968099874e-01f, 9.179007756e-01f,
+    3.939920401e-01f, 9.191138517e-01f, 3.911703843e-01f, 9.203182767e-01f,
+    3.883450467e-01f, 9.215140393e-01f, 3.855160538e-01f, 9.227011283e-01f,
+    3.826834324e-01f, 9.238795325e-01f, 3.798472089e-01f, 9.250492408e-01f,
+    3.770074102e-01f, 9.262102421e-01f, 3.741640630e-01f, 9.273625257e-01f,
+    3.713171940e-01f, 9.285060805e-01f, 3.684668300e-01f, 9.296408958e-01f,
+    3.656129978e-01f, 9.307669611e-01f, 3.627557244e-01f, 9.318842656e-01f,
+    3.598950365e-01f, 9.329927988e-01f, 3.570309612e-01f, 9.340925504e-01f,
+    3.541635254e-01f, 9.351835099e-01f, 3.512927561e-01f, 9.362656672e-01f,
+    3.484186802e-01f, 9.373390119e-01f, 3.455413250e-01f, 9.384035341e-01f,
+    3.426607173e-01f, 9.394592236e-01f, 3.397768844e-01f, 9.405060706e-01f,
+    3.368898534e-01f, 9.415440652e-01f, 3.339996514e-01f, 9.425731976e-01f,
+    3.311063058e-01f, 9.435934582e-01f, 3.282098436e-01f, 9.446048373e-01f,
+    3.253102922e-01f, 9.456073254e-01f, 3.224076788e-01f, 9.466009131e-01f,
+    3.195020308e-01f, 9.475855910e-01f, 3.165933756e-01f, 9.485613499e-01f,
+    3.136817404e-01f, 9.495281806e-01f, 3.107671527e-01f, 9.504860739e-01f,
+    3.078496400e-01f, 9.514350210e-01f, 3.049292297e-01f, 9.523750127e-01f,
+    3.020059493e-01f, 9.533060404e-01f, 2.990798263e-01f, 9.542280951e-01f,
+    2.961508882e-01f, 9.551411683e-01f, 2.932191627e-01f, 9.560452513e-01f,
+    2.902846773e-01f, 9.569403357e-01f, 2.873474595e-01f, 9.578264130e-01f,
+    2.844075372e-01f, 9.587034749e-01f, 2.814649379e-01f, 9.595715131e-01f,
+    2.785196894e-01f, 9.604305194e-01f, 2.755718193e-01f, 9.612804858e-01f,
+    2.726213554e-01f, 9.621214043e-01f, 2.696683256e-01f, 9.629532669e-01f,
+    2.667127575e-01f, 9.637760658e-01f, 2.637546790e-01f, 9.645897933e-01f,
+    2.607941179e-01f, 9.653944417e-01f, 2.578311022e-01f, 9.661900034e-01f,
+    2.548656596e-01f, 9.669764710e-01f, 2.518978182e-01f, 9.677538371e-01f,
+    2.489276057e-01f, 9.685220943e-01f, 2.459550503e-01f, 9.692812354e-01f,
+    2.429801799e-01f, 9.700312532e-01f, 2.400030224e-01f, 9.707721407e-01f,
+    2.370236060e-01f, 9.715038910e-01f, 2.340419586e-01f, 9.722264971e-01f,
+    2.310581083e-01f, 9.729399522e-01f, 2.280720832e-01f, 9.736442497e-01f,
+    2.250839114e-01f, 9.743393828e-01f, 2.220936210e-01f, 9.750253451e-01f,
+    2.191012402e-01f, 9.757021300e-01f, 2.161067971e-01f, 9.763697313e-01f,
+    2.131103199e-01f, 9.770281427e-01f, 2.101118369e-01f, 9.776773578e-01f,
+    2.071113762e-01f, 9.783173707e-01f, 2.041089661e-01f, 9.789481753e-01f,
+    2.011046348e-01f, 9.795697657e-01f, 1.980984107e-01f, 9.801821360e-01f,
+    1.950903220e-01f, 9.807852804e-01f, 1.920803970e-01f, 9.813791933e-01f,
+    1.890686641e-01f, 9.819638691e-01f, 1.860551517e-01f, 9.825393023e-01f,
+    1.830398880e-01f, 9.831054874e-01f, 1.800229014e-01f, 9.836624192e-01f,
+    1.770042204e-01f, 9.842100924e-01f, 1.739838734e-01f, 9.847485018e-01f,
+    1.709618888e-01f, 9.852776424e-01f, 1.679382950e-01f, 9.857975092e-01f,
+    1.649131205e-01f, 9.863080972e-01f, 1.618863938e-01f, 9.868094018e-01f,
+    1.588581433e-01f, 9.873014182e-01f, 1.558283977e-01f, 9.877841416e-01f,
+    1.527971853e-01f, 9.882575677e-01f, 1.497645347e-01f, 9.887216920e-01f,
+    1.467304745e-01f, 9.891765100e-01f, 1.436950332e-01f, 9.896220175e-01f,
+    1.406582393e-01f, 9.900582103e-01f, 1.376201216e-01f, 9.904850843e-01f,
+    1.345807085e-01f, 9.909026354e-01f, 1.315400287e-01f, 9.913108598e-01f,
+    1.284981108e-01f, 9.917097537e-01f, 1.254549834e-01f, 9.920993131e-01f,
+    1.224106752e-01f, 9.924795346e-01f, 1.193652148e-01f, 9.928504145e-01f,
+    1.163186309e-01f, 9.932119492e-01f, 1.132709522e-01f, 9.935641355e-01f,
+    1.102222073e-01f, 9.939069700e-01f, 1.071724250e-01f, 9.942404495e-01f,
+    1.041216339e-01f, 9.945645707e-01f, 1.010698628e-01f, 9.948793308e-01f,
+    9.801714033e-02f, 9.951847267e-01f, 9.496349533e-02f, 9.954807555e-01f,
+    9.190895650e-02f, 9.957674145e-01f, 8.885355258e-02f, 9.960447009e-01f,
+    8.579731234e-02f, 9.963126122e-01f, 8.274026455e-02f, 9.965711458e-01f,
+    7.968243797e-02f, 9.968202993e-01f, 7.662386139e-02f, 9.970600703e-01f,
+    7.356456360e-02f, 9.972904567e-01f, 7.050457339e-02f, 9.975114561e-01f,
+    6.744391956e-02f, 9.977230666e-01f, 6.438263093e-02f, 9.979252862e-01f,
+    6.132073630e-02f, 9.981181129e-01f, 5.825826450e-02f, 9.983015449e-01f,
+    5.519524435e-02f, 9.984755806e-01f, 5.213170468e-02f, 9.986402182e-01f,
+    4.906767433e-02f, 9.987954562e-01f, 4.600318213e-02f, 9.989412932e-01f,
+    4.293825693e-02f, 9.990777278e-01f, 3.987292759e-02f, 9.992047586e-01f,
+    3.680722294e-02f, 9.993223846e-01f, 3.374117185e-02f, 9.994306046e-01f,
+    3.067480318e-02f, 9.995294175e-01f, 2.760814578e-02f, 9.996188225e-01f,
+    2.454122852e-02f, 9.996988187e-01f, 2.147408028e-02f, 9.997694054e-01f,
+    1.840672991e-02f, 9.998305818e-01f, 1.533920628e-02f, 9.998823475e-01f,
+    1.227153829e-02f, 9.999247018e-01f, 9.203754782e-03f, 9.999576446e-01f,
+    6.135884649e-03f, 9.999811753e-01f, 3.067956763e-03f, 9.999952938e-01f,
+    6.123233996e-17f, 1.000000000e+00f, -3.067956763e-03f, 9.999952938e-01f,
+    -6.135884649e-03f, 9.999811753e-01f, -9.203754782e-03f, 9.999576446e-01f,
+    -1.227153829e-02f, 9.999247018e-01f, -1.533920628e-02f, 9.998823475e-01f,
+    -1.840672991e-02f, 9.998305818e-01f, -2.147408028e-02f, 9.997694054e-01f,
+    -2.454122852e-02f, 9.996988187e-01f, -2.760814578e-02f, 9.996188225e-01f,
+    -3.067480318e-02f, 9.995294175e-01f, -3.374117185e-02f, 9.994306046e-01f,
+    -3.680722294e-02f, 9.993223846e-01f, -3.987292759e-02f, 9.992047586e-01f,
+    -4.293825693e-02f, 9.990777278e-01f, -4.600318213e-02f, 9.989412932e-01f,
+    -4.906767433e-02f, 9.987954562e-01f, -5.213170468e-02f, 9.986402182e-01f,
+    -5.519524435e-02f, 9.984755806e-01f, -5.825826450e-02f, 9.983015449e-01f,
+    -6.132073630e-02f, 9.981181129e-01f, -6.438263093e-02f, 9.979252862e-01f,
+    -6.744391956e-02f, 9.977230666e-01f, -7.050457339e-02f, 9.975114561e-01f,
+    -7.356456360e-02f, 9.972904567e-01f, -7.662386139e-02f, 9.970600703e-01f,
+    -7.968243797e-02f, 9.968202993e-01f, -8.274026455e-02f, 9.965711458e-01f,
+    -8.579731234e-02f, 9.963126122e-01f, -8.885355258e-02f, 9.960447009e-01f,
+    -9.190895650e-02f, 9.957674145e-01f, -9.496349533e-02f, 9.954807555e-01f,
+    -9.801714033e-02f, 9.951847267e-01f, -1.010698628e-01f, 9.948793308e-01f,
+    -1.041216339e-01f, 9.945645707e-01f, -1.071724250e-01f, 9.942404495e-01f,
+    -1.102222073e-01f, 9.939069700e-01f, -1.132709522e-01f, 9.935641355e-01f,
+    -1.163186309e-01f, 9.932119492e-01f, -1.193652148e-01f, 9.928504145e-01f,
+    -1.224106752e-01f, 9.924795346e-01f, -1.254549834e-01f, 9.920993131e-01f,
+    -1.284981108e-01f, 9.917097537e-01f, -1.315400287e-01f, 9.913108598e-01f,
+    -1.345807085e-01f, 9.909026354e-01f, -1.376201216e-01f, 9.904850843e-01f,
+    -1.406582393e-01f, 9.900582103e-01f, -1.436950332e-01f, 9.896220175e-01f,
+    -1.467304745e-01f, 9.891765100e-01f, -1.497645347e-01f, 9.887216920e-01f,
+    -1.527971853e-01f, 9.882575677e-01f, -1.558283977e-01f, 9.877841416e-01f,
+    -1.588581433e-01f, 9.873014182e-01f, -1.618863938e-01f, 9.868094018e-01f,
+    -1.649131205e-01f, 9.863080972e-01f, -1.679382950e-01f, 9.857975092e-01f,
+    -1.709618888e-01f, 9.852776424e-01f, -1.739838734e-01f, 9.847485018e-01f,
+    -1.770042204e-01f, 9.842100924e-01f, -1.800229014e-01f, 9.836624192e-01f,
+    -1.830398880e-01f, 9.831054874e-01f, -1.860551517e-01f, 9.825393023e-01f,
+    -1.890686641e-01f, 9.819638691e-01f, -1.920803970e-01f, 9.813791933e-01f,
+    -1.950903220e-01f, 9.807852804e-01f, -1.980984107e-01f, 9.801821360e-01f,
+    -2.011046348e-01f, 9.795697657e-01f, -2.041089661e-01f, 9.789481753e-01f,
+    -2.071113762e-01f, 9.783173707e-01f, -2.101118369e-01f, 9.776773578e-01f,
+    -2.131103199e-01f, 9.770281427e-01f, -2.161067971e-01f, 9.763697313e-01f,
+    -2.191012402e-01f, 9.757021300e-01f, -2.220936210e-01f, 9.750253451e-01f,
+    -2.250839114e-01f, 9.743393828e-01f, -2.280720832e-01f, 9.736442497e-01f,
+    -2.310581083e-01f, 9.729399522e-01f, -2.340419586e-01f, 9.722264971e-01f,
+    -2.370236060e-01f, 9.715038910e-01f, -2.400030224e-01f, 9.707721407e-01f,
+    -2.429801799e-01f, 9.700312532e-01f, -2.459550503e-01f, 9.692812354e-01f,
+    -2.489276057e-01f, 9.685220943e-01f, -2.518978182e-01f, 9.677538371e-01f,
+    -2.548656596e-01f, 9.669764710e-01f, -2.578311022e-01f, 9.661900034e-01f,
+    -2.607941179e-01f, 9.653944417e-01f, -2.637546790e-01f, 9.645897933e-01f,
+    -2.667127575e-01f, 9.637760658e-01f, -2.696683256e-01f, 9.629532669e-01f,
+    -2.726213554e-01f, 9.621214043e-01f, -2.755718193e-01f, 9.612804858e-01f,
+    -2.785196894e-01f, 9.604305194e-01f, -2.814649379e-01f, 9.595715131e-01f,
+    -2.844075372e-01f, 9.587034749e-01f, -2.873474595e-01f, 9.578264130e-01f,
+    -2.902846773e-01f, 9.569403357e-01f, -2.932191627e-01f, 9.560452513e-01f,
+    -2.961508882e-01f, 9.551411683e-01f, -2.990798263e-01f, 9.542280951e-01f,
+    -3.020059493e-01f, 9.533060404e-01f, -3.049292297e-01f, 9.523750127e-01f,
+    -3.078496400e-01f, 9.514350210e-01f, -3.107671527e-01f, 9.504860739e-01f,
+    -3.136817404e-01f, 9.495281806e-01f, -3.165933756e-01f, 9.485613499e-01f,
+    -3.195020308e-01f, 9.475855910e-01f, -3.224076788e-01f, 9.466009131e-01f,
+    -3.253102922e-01f, 9.456073254e-01f, -3.282098436e-01f, 9.446048373e-01f,
+    -3.311063058e-01f, 9.435934582e-01f, -3.339996514e-01f, 9.425731976e-01f,
+    -3.368898534e-01f, 9.415440652e-01f, -3.397768844e-01f, 9.405060706e-01f,
+    -3.426607173e-01f, 9.394592236e-01f, -3.455413250e-01f, 9.384035341e-01f,
+    -3.484186802e-01f, 9.373390119e-01f, -3.512927561e-01f, 9.362656672e-01f,
+    -3.541635254e-01f, 9.351835099e-01f, -3.570309612e-01f, 9.340925504e-01f,
+    -3.598950365e-01f, 9.329927988e-01f, -3.627557244e-01f, 9.318842656e-01f,
+    -3.656129978e-01f, 9.307669611e-01f, -3.684668300e-01f, 9.296408958e-01f,
+    -3.713171940e-01f, 9.285060805e-01f, -3.741640630e-01f, 9.273625257e-01f,
+    -3.770074102e-01f, 9.262102421e-01f, -3.798472089e-01f, 9.250492408e-01f,
+    -3.826834324e-01f, 9.238795325e-01f, -3.855160538e-01f, 9.227011283e-01f,
+    -3.883450467e-01f, 9.215140393e-01f, -3.911703843e-01f, 9.203182767e-01f,
+    -3.939920401e-01f, 9.191138517e-01f, -3.968099874e-01f, 9.179007756e-01f,
+    -3.996241998e-01f, 9.166790599e-01f, -4.024346509e-01f, 9.154487161e-01f,
+    -4.052413140e-01f, 9.142097557e-01f, -4.080441629e-01f, 9.129621904e-01f,
+    -4.108431711e-01f, 9.117060320e-01f, -4.136383122e-01f, 9.104412923e-01f,
+    -4.164295601e-01f, 9.091679831e-01f, -4.192168884e-01f, 9.078861165e-01f,
+    -4.220002708e-01f, 9.065957045e-01f, -4.247796812e-01f, 9.052967593e-01f,
+    -4.275550934e-01f, 9.039892931e-01f, -4.303264813e-01f, 9.026733182e-01f,
+    -4.330938189e-01f, 9.013488470e-01f, -4.358570799e-01f, 9.000158920e-01f,
+    -4.386162385e-01f, 8.986744657e-01f, -4.413712687e-01f, 8.973245807e-01f,
+    -4.441221446e-01f, 8.959662498e-01f, -4.468688402e-01f, 8.945994856e-01f,
+    -4.496113297e-01f, 8.932243012e-01f, -4.523495872e-01f, 8.918407094e-01f,
+    -4.550835871e-01f, 8.904487232e-01f, -4.578133036e-01f, 8.890483559e-01f,
+    -4.605387110e-01f, 8.876396204e-01f, -4.632597836e-01f, 8.862225301e-01f,
+    -4.659764958e-01f, 8.847970984e-01f, -4.686888220e-01f, 8.833633387e-01f,
+    -4.713967368e-01f, 8.819212643e-01f, -4.741002147e-01f, 8.804708891e-01f,
+    -4.767992301e-01f, 8.790122264e-01f, -4.794937577e-01f, 8.775452902e-01f,
+    -4.821837721e-01f, 8.760700942e-01f, -4.848692480e-01f, 8.745866523e-01f,
+    -4.875501601e-01f, 8.730949784e-01f, -4.902264833e-01f, 8.715950867e-01f,
+    -4.928981922e-01f, 8.700869911e-01f, -4.955652618e-01f, 8.685707060e-01f,
+    -4.982276670e-01f, 8.670462455e-01f, -5.008853826e-01f, 8.655136241e-01f,
+    -5.035383837e-01f, 8.639728561e-01f, -5.061866453e-01f, 8.624239561e-01f,
+    -5.088301425e-01f, 8.608669386e-01f, -5.114688504e-01f, 8.593018184e-01f,
+    -5.141027442e-01f, 8.577286100e-01f, -5.167317990e-01f, 8.561473284e-01f,
+    -5.193559902e-01f, 8.545579884e-01f, -5.219752929e-01f, 8.529606049e-01f,
+    -5.245896827e-01f, 8.513551931e-01f, -5.271991348e-01f, 8.497417680e-01f,
+    -5.298036247e-01f, 8.481203448e-01f, -5.324031279e-01f, 8.464909388e-01f,
+    -5.349976199e-01f, 8.448535652e-01f, -5.375870763e-01f, 8.432082396e-01f,
+    -5.401714727e-01f, 8.415549774e-01f, -5.427507849e-01f, 8.398937942e-01f,
+    -5.453249884e-01f, 8.382247056e-01f, -5.478940592e-01f, 8.365477272e-01f,
+    -5.504579729e-01f, 8.348628750e-01f, -5.530167056e-01f, 8.331701647e-01f,
+    -5.555702330e-01f, 8.314696123e-01f, -5.581185312e-01f, 8.297612338e-01f,
+    -5.606615762e-01f, 8.280450453e-01f, -5.631993440e-01f, 8.263210628e-01f,
+    -5.657318108e-01f, 8.245893028e-01f, -5.682589527e-01f, 8.228497814e-01f,
+    -5.707807459e-01f, 8.211025150e-01f, -5.732971667e-01f, 8.193475201e-01f,
+    -5.758081914e-01f, 8.175848132e-01f, -5.783137964e-01f, 8.158144108e-01f,
+    -5.808139581e-01f, 8.140363297e-01f, -5.833086529e-01f, 8.122505866e-01f,
+    -5.857978575e-01f, 8.104571983e-01f, -5.882815482e-01f, 8.086561816e-01f,
+    -5.907597019e-01f, 8.068475535e-01f, -5.932322950e-01f, 8.050313311e-01f,
+    -5.956993045e-01f, 8.032075315e-01f, -5.981607070e-01f, 8.013761717e-01f,
+    -6.006164794e-01f, 7.995372691e-01f, -6.030665985e-01f, 7.976908409e-01f,
+    -6.055110414e-01f, 7.958369046e-01f, -6.079497850e-01f, 7.939754776e-01f,
+    -6.103828063e-01f, 7.921065773e-01f, -6.128100824e-01f, 7.902302214e-01f,
+    -6.152315906e-01f, 7.883464276e-01f, -6.176473079e-01f, 7.864552136e-01f,
+    -6.200572118e-01f, 7.845565972e-01f, -6.224612794e-01f, 7.826505962e-01f,
+    -6.248594881e-01f, 7.807372286e-01f, -6.272518155e-01f, 7.788165124e-01f,
+    -6.296382389e-01f, 7.768884657e-01f, -6.320187359e-01f, 7.749531066e-01f,
+    -6.343932842e-01f, 7.730104534e-01f, -6.367618612e-01f, 7.710605243e-01f,
+    -6.391244449e-01f, 7.691033376e-01f, -6.414810128e-01f, 7.671389119e-01f,
+    -6.438315429e-01f, 7.651672656e-01f, -6.461760130e-01f, 7.631884173e-01f,
+    -6.485144010e-01f, 7.612023855e-01f, -6.508466850e-01f, 7.592091890e-01f,
+    -6.531728430e-01f, 7.572088465e-01f, -6.554928530e-01f, 7.552013769e-01f,
+    -6.578066933e-01f, 7.531867990e-01f, -6.601143421e-01f, 7.511651319e-01f,
+    -6.624157776e-01f, 7.491363945e-01f, -6.647109782e-01f, 7.471006060e-01f,
+    -6.669999223e-01f, 7.450577854e-01f, -6.692825883e-01f, 7.430079521e-01f,
+    -6.715589548e-01f, 7.409511254e-01f, -6.738290004e-01f, 7.388873245e-01f,
+    -6.760927036e-01f, 7.368165689e-01f, -6.783500431e-01f, 7.347388781e-01f,
+    -6.806009978e-01f, 7.326542717e-01f, -6.828455464e-01f, 7.305627692e-01f,
+    -6.850836678e-01f, 7.284643904e-01f, -6.873153409e-01f, 7.263591551e-01f,
+    -6.895405447e-01f, 7.242470830e-01f, -6.917592584e-01f, 7.221281939e-01f,
+    -6.939714609e-01f, 7.200025080e-01f, -6.961771315e-01f, 7.178700451e-01f,
+    -6.983762494e-01f, 7.157308253e-01f, -7.005687939e-01f, 7.135848688e-01f,
+    -7.027547445e-01f, 7.114321957e-01f, -7.049340804e-01f, 7.092728264e-01f,
+    -7.071067812e-01f, 7.071067812e-01f, -7.092728264e-01f, 7.049340804e-01f,
+    -7.114321957e-01f, 7.027547445e-01f, -7.135848688e-01f, 7.005687939e-01f,
+    -7.157308253e-01f, 6.983762494e-01f, -7.178700451e-01f, 6.961771315e-01f,
+    -7.200025080e-01f, 6.939714609e-01f, -7.221281939e-01f, 6.917592584e-01f,
+    -7.242470830e-01f, 6.895405447e-01f, -7.263591551e-01f, 6.873153409e-01f,
+    -7.284643904e-01f, 6.850836678e-01f, -7.305627692e-01f, 6.828455464e-01f,
+    -7.326542717e-01f, 6.806009978e-01f, -7.347388781e-01f, 6.783500431e-01f,
+    -7.368165689e-01f, 6.760927036e-01f, -7.388873245e-01f, 6.738290004e-01f,
+    -7.409511254e-01f, 6.715589548e-01f, -7.430079521e-01f, 6.692825883e-01f,
+    -7.450577854e-01f, 6.669999223e-01f, -7.471006060e-01f, 6.647109782e-01f,
+    -7.491363945e-01f, 6.624157776e-01f, -7.511651319e-01f, 6.601143421e-01f,
+    -7.531867990e-01f, 6.578066933e-01f, -7.552013769e-01f, 6.554928530e-01f,
+    -7.572088465e-01f, 6.531728430e-01f, -7.592091890e-01f, 6.508466850e-01f,
+    -7.612023855e-01f, 6.485144010e-01f, -7.631884173e-01f, 6.461760130e-01f,
+    -7.651672656e-01f, 6.438315429e-01f, -7.671389119e-01f, 6.414810128e-01f,
+    -7.691033376e-01f, 6.391244449e-01f, -7.710605243e-01f, 6.367618612e-01f,
+    -7.730104534e-01f, 6.343932842e-01f, -7.749531066e-01f, 6.320187359e-01f,
+    -7.768884657e-01f, 6.296382389e-01f, -7.788165124e-01f, 6.272518155e-01f,
+    -7.807372286e-01f, 6.248594881e-01f, -7.826505962e-01f, 6.224612794e-01f,
+    -7.845565972e-01f, 6.200572118e-01f, -7.864552136e-01f, 6.176473079e-01f,
+    -7.883464276e-01f, 6.152315906e-01f, -7.902302214e-01f, 6.128100824e-01f,
+    -7.921065773e-01f, 6.103828063e-01f, -7.939754776e-01f, 6.079497850e-01f,
+    -7.958369046e-01f, 6.055110414e-01f, -7.976908409e-01f, 6.030665985e-01f,
+    -7.995372691e-01f, 6.006164794e-01f, -8.013761717e-01f, 5.981607070e-01f,
+    -8.032075315e-01f, 5.956993045e-01f, -8.050313311e-01f, 5.932322950e-01f,
+    -8.068475535e-01f, 5.907597019e-01f, -8.086561816e-01f, 5.882815482e-01f,
+    -8.104571983e-01f, 5.857978575e-01f, -8.122505866e-01f, 5.833086529e-01f,
+    -8.140363297e-01f, 5.808139581e-01f, -8.158144108e-01f, 5.783137964e-01f,
+    -8.175848132e-01f, 5.758081914e-01f, -8.193475201e-01f, 5.732971667e-01f,
+    -8.211025150e-01f, 5.707807459e-01f, -8.228497814e-01f, 5.682589527e-01f,
+    -8.245893028e-01f, 5.657318108e-01f, -8.263210628e-01f, 5.631993440e-01f,
+    -8.280450453e-01f, 5.606615762e-01f, -8.297612338e-01f, 5.581185312e-01f,
+    -8.314696123e-01f, 5.555702330e-01f, -8.331701647e-01f, 5.530167056e-01f,
+    -8.348628750e-01f, 5.504579729e-01f, -8.365477272e-01f, 5.478940592e-01f,
+    -8.382247056e-01f, 5.453249884e-01f, -8.398937942e-01f, 5.427507849e-01f,
+    -8.415549774e-01f, 5.401714727e-01f, -8.432082396e-01f, 5.375870763e-01f,
+    -8.448535652e-01f, 5.349976199e-01f, -8.464909388e-01f, 5.324031279e-01f,
+    -8.481203448e-01f, 5.298036247e-01f, -8.497417680e-01f, 5.271991348e-01f,
+    -8.513551931e-01f, 5.245896827e-01f, -8.529606049e-01f, 5.219752929e-01f,
+    -8.545579884e-01f, 5.193559902e-01f, -8.561473284e-01f, 5.167317990e-01f,
+    -8.577286100e-01f, 5.141027442e-01f, -8.593018184e-01f, 5.114688504e-01f,
+    -8.608669386e-01f, 5.088301425e-01f, -8.624239561e-01f, 5.061866453e-01f,
+    -8.639728561e-01f, 5.035383837e-01f, -8.655136241e-01f, 5.008853826e-01f,
+    -8.670462455e-01f, 4.982276670e-01f, -8.685707060e-01f, 4.955652618e-01f,
+    -8.700869911e-01f, 4.928981922e-01f, -8.715950867e-01f, 4.902264833e-01f,
+    -8.730949784e-01f, 4.875501601e-01f, -8.745866523e-01f, 4.848692480e-01f,
+    -8.760700942e-01f, 4.821837721e-01f, -8.775452902e-01f, 4.794937577e-01f,
+    -8.790122264e-01f, 4.767992301e-01f, -8.804708891e-01f, 4.741002147e-01f,
+    -8.819212643e-01f, 4.713967368e-01f, -8.833633387e-01f, 4.686888220e-01f,
+    -8.847970984e-01f, 4.659764958e-01f, -8.862225301e-01f, 4.632597836e-01f,
+    -8.876396204e-01f, 4.605387110e-01f, -8.890483559e-01f, 4.578133036e-01f,
+    -8.904487232e-01f, 4.550835871e-01f, -8.918407094e-01f, 4.523495872e-01f,
+    -8.932243012e-01f, 4.496113297e-01f, -8.945994856e-01f, 4.468688402e-01f,
+    -8.959662498e-01f, 4.441221446e-01f, -8.973245807e-01f, 4.413712687e-01f,
+    -8.986744657e-01f, 4.386162385e-01f, -9.000158920e-01f, 4.358570799e-01f,
+    -9.013488470e-01f, 4.330938189e-01f, -9.026733182e-01f, 4.303264813e-01f,
+    -9.039892931e-01f, 4.275550934e-01f, -9.052967593e-01f, 4.247796812e-01f,
+    -9.065957045e-01f, 4.220002708e-01f, -9.078861165e-01f, 4.192168884e-01f,
+    -9.091679831e-01f, 4.164295601e-01f, -9.104412923e-01f, 4.136383122e-01f,
+    -9.117060320e-01f, 4.108431711e-01f, -9.129621904e-01f, 4.080441629e-01f,
+    -9.142097557e-01f, 4.052413140e-01f, -9.154487161e-01f, 4.024346509e-01f,
+    -9.166790599e-01f, 3.996241998e-01f, -9.179007756e-01f, 3.968099874e-01f,
+    -9.191138517e-01f, 3.939920401e-01f, -9.203182767e-01f, 3.911703843e-01f,
+    -9.215140393e-01f, 3.883450467e-01f, -9.227011283e-01f, 3.855160538e-01f,
+    -9.238795325e-01f, 3.826834324e-01f, -9.250492408e-01f, 3.798472089e-01f,
+    -9.262102421e-01f, 3.770074102e-01f, -9.273625257e-01f, 3.741640630e-01f,
+    -9.285060805e-01f, 3.713171940e-01f, -9.296408958e-01f, 3.684668300e-01f,
+    -9.307669611e-01f, 3.656129978e-01f, -9.318842656e-01f, 3.627557244e-01f,
+    -9.329927988e-01f, 3.598950365e-01f, -9.340925504e-01f, 3.570309612e-01f,
+    -9.351835099e-01f, 3.541635254e-01f, -9.362656672e-01f, 3.512927561e-01f,
+    -9.373390119e-01f, 3.484186802e-01f, -9.384035341e-01f, 3.455413250e-01f,
+    -9.394592236e-01f, 3.426607173e-01f, -9.405060706e-01f, 3.397768844e-01f,
+    -9.415440652e-01f, 3.368898534e-01f, -9.425731976e-01f, 3.339996514e-01f,
+    -9.435934582e-01f, 3.311063058e-01f, -9.446048373e-01f, 3.282098436e-01f,
+    -9.456073254e-01f, 3.253102922e-01f, -9.466009131e-01f, 3.224076788e-01f,
+    -9.475855910e-01f, 3.195020308e-01f, -9.485613499e-01f, 3.165933756e-01f,
+    -9.495281806e-01f, 3.136817404e-01f, -9.504860739e-01f, 3.107671527e-01f,
+    -9.514350210e-01f, 3.078496400e-01f, -9.523750127e-01f, 3.049292297e-01f,
+    -9.533060404e-01f, 3.020059493e-01f, -9.542280951e-01f, 2.990798263e-01f,
+    -9.551411683e-01f, 2.961508882e-01f, -9.560452513e-01f, 2.932191627e-01f,
+    -9.569403357e-01f, 2.902846773e-01f, -9.578264130e-01f, 2.873474595e-01f,
+    -9.587034749e-01f, 2.844075372e-01f, -9.595715131e-01f, 2.814649379e-01f,
+    -9.604305194e-01f, 2.785196894e-01f, -9.612804858e-01f, 2.755718193e-01f,
+    -9.621214043e-01f, 2.726213554e-01f, -9.629532669e-01f, 2.696683256e-01f,
+    -9.637760658e-01f, 2.667127575e-01f, -9.645897933e-01f, 2.637546790e-01f,
+    -9.653944417e-01f, 2.607941179e-01f, -9.661900034e-01f, 2.578311022e-01f,
+    -9.669764710e-01f, 2.548656596e-01f, -9.677538371e-01f, 2.518978182e-01f,
+    -9.685220943e-01f, 2.489276057e-01f, -9.692812354e-01f, 2.459550503e-01f,
+    -9.700312532e-01f, 2.429801799e-01f, -9.707721407e-01f, 2.400030224e-01f,
+    -9.715038910e-01f, 2.370236060e-01f, -9.722264971e-01f, 2.340419586e-01f,
+    -9.729399522e-01f, 2.310581083e-01f, -9.736442497e-01f, 2.280720832e-01f,
+    -9.743393828e-01f, 2.250839114e-01f, -9.750253451e-01f, 2.220936210e-01f,
+    -9.757021300e-01f, 2.191012402e-01f, -9.763697313e-01f, 2.161067971e-01f,
+    -9.770281427e-01f, 2.131103199e-01f, -9.776773578e-01f, 2.101118369e-01f,
+    -9.783173707e-01f, 2.071113762e-01f, -9.789481753e-01f, 2.041089661e-01f,
+    -9.795697657e-01f, 2.011046348e-01f, -9.801821360e-01f, 1.980984107e-01f,
+    -9.807852804e-01f, 1.950903220e-01f, -9.813791933e-01f, 1.920803970e-01f,
+    -9.819638691e-01f, 1.890686641e-01f, -9.825393023e-01f, 1.860551517e-01f,
+    -9.831054874e-01f, 1.830398880e-01f, -9.836624192e-01f, 1.800229014e-01f,
+    -9.842100924e-01f, 1.770042204e-01f, -9.847485018e-01f, 1.739838734e-01f,
+    -9.852776424e-01f, 1.709618888e-01f, -9.857975092e-01f, 1.679382950e-01f,
+    -9.863080972e-01f, 1.649131205e-01f, -9.868094018e-01f, 1.618863938e-01f,
+    -9.873014182e-01f, 1.588581433e-01f, -9.877841416e-01f, 1.558283977e-01f,
+    -9.882575677e-01f, 1.527971853e-01f, -9.887216920e-01f, 1.497645347e-01f,
+    -9.891765100e-01f, 1.467304745e-01f, -9.896220175e-01f, 1.436950332e-01f,
+    -9.900582103e-01f, 1.406582393e-01f, -9.904850843e-01f, 1.376201216e-01f,
+    -9.909026354e-01f, 1.345807085e-01f, -9.913108598e-01f, 1.315400287e-01f,
+    -9.917097537e-01f, 1.284981108e-01f, -9.920993131e-01f, 1.254549834e-01f,
+    -9.924795346e-01f, 1.224106752e-01f, -9.928504145e-01f, 1.193652148e-01f,
+    -9.932119492e-01f, 1.163186309e-01f, -9.935641355e-01f, 1.132709522e-01f,
+    -9.939069700e-01f, 1.102222073e-01f, -9.942404495e-01f, 1.071724250e-01f,
+    -9.945645707e-01f, 1.041216339e-01f, -9.948793308e-01f, 1.010698628e-01f,
+    -9.951847267e-01f, 9.801714033e-02f, -9.954807555e-01f, 9.496349533e-02f,
+    -9.957674145e-01f, 9.190895650e-02f, -9.960447009e-01f, 8.885355258e-02f,
+    -9.963126122e-01f, 8.579731234e-02f, -9.965711458e-01f, 8.274026455e-02f,
+    -9.968202993e-01f, 7.968243797e-02f, -9.970600703e-01f, 7.662386139e-02f,
+    -9.972904567e-01f, 7.356456360e-02f, -9.975114561e-01f, 7.050457339e-02f,
+    -9.977230666e-01f, 6.744391956e-02f, -9.979252862e-01f, 6.438263093e-02f,
+    -9.981181129e-01f, 6.132073630e-02f, -9.983015449e-01f, 5.825826450e-02f,
+    -9.984755806e-01f, 5.519524435e-02f, -9.986402182e-01f, 5.213170468e-02f,
+    -9.987954562e-01f, 4.906767433e-02f, -9.989412932e-01f, 4.600318213e-02f,
+    -9.990777278e-01f, 4.293825693e-02f, -9.992047586e-01f, 3.987292759e-02f,
+    -9.993223846e-01f, 3.680722294e-02f, -9.994306046e-01f, 3.374117185e-02f,
+    -9.995294175e-01f, 3.067480318e-02f, -9.996188225e-01f, 2.760814578e-02f,
+    -9.996988187e-01f, 2.454122852e-02f, -9.997694054e-01f, 2.147408028e-02f,
+    -9.998305818e-01f, 1.840672991e-02f, -9.998823475e-01f, 1.533920628e-02f,
+    -9.999247018e-01f, 1.227153829e-02f, -9.999576446e-01f, 9.203754782e-03f,
+    -9.999811753e-01f, 6.135884649e-03f, -9.999952938e-01f, 3.067956763e-03f,
+};
+
+const int16_t fft_twiddle_q15[FFT_MAX_SIZE] = {
+     32767,      0,  32767,    101,  32767,    201,  32767,    302,
+     32766,    402,  32764,    503,  32762,    603,  32760,    704,
+     32758,    804,  32756,    905,  32753,   1005,  32749,   1106,
+     32746,   1206,  32742,   1307,  32738,   1407,  32733,   1507,
+     32729,   1608,  32723,   1708,  32718,   1809,  32712,   1909,
+     32706,   2009,  32700,   2110,  32693,   2210,  32686,   2310,
+     32679,   2411,  32672,   2511,  32664,   2611,  32656,   2711,
+     32647,   2811,  32638,   2912,  32629,   3012,  32620,   3112,
+     32610,   3212,  32600,   3312,  32590,   3412,  32579,   3512,
+     32568,   3612,  32557,   3712,  32546,   3812,  32534,   3911,
+     32522,   4011,  32509,   4111,  32496,   4211,  32483,   4310,
+     32470,   4410,  32456,   4510,  32442,   4609,  32428,   4709,
+     32413,   4808,  32398,   4907,  32383,   5007,  32368,   5106,
+     32352,   5205,  32336,   5305,  32319,   5404,  32303,   5503,
+     32286,   5602,  32268,   5701,  32251,   5800,  32233,   5899,
+     32214,   5998,  32196,   6097,  32177,   6195,  32158,   6294,
+     32138,   6393,  32119,   6491,  32099,   6590,  32078,   6688,
+     32058,   6787,  32037,   6885,  32015,   6983,  31994,   7081,
+     31972,   7180,  31950,   7278,  31927,   7376,  31904,   7473,
+     31881,   7571,  31858,   7669,  31834,   7767,  31810,   7864,
+     31786,   7962,  31761,   8059,  31737,   8157,  31711,   8254,
+     31686,   8351,  31660,   8449,  31634,   8546,  31608,   8643,
+     31581,   8740,  31554,   8836,  31527,   8933,  31499,   9030,
+     31471,   9127,  31443,   9223,  31415,   9319,  31386,   9416,
+     31357,   9512,  31328,   9608,  31298,   9704,  31268,   9800,
+     31238,   9896,  31207,   9992,  31177,  10088,  31146,  10183,
+     31114,  10279,  31082,  10374,  31050,  10469,  31018,  10565,
+     30986,  10660,  30953,  10755,  30920,  10850,  30886,  10945,
+     30853,  11039,  30819,  11134,  30784,  11228,  30750,  11323,
+     30715,  11417,  30680,  11511,  30644,  11605,  30608,  11699,
+     30572,  11793,  30536,  11887,  30499,  11980,  30462,  12074,
+     30425,  12167,  30388,  12261,  30350,  12354,  30312,  12447,
+     30274,  12540,  30235,  12633,  30196,  12725,  30157,  12818,
+     30118,  12910,  30078,  13003,  30038,  13095,  29997,  13187,
+     29957,  13279,  29916,  13371,  29875,  13463,  29833,  13554,
+     29792,  13646,  29750,  13737,  29707,  13828,  29665,  13919,
+     29622,  14010,  29579,  14101,  29535,  14192,  29492,  14282,
+     29448,  14373,  29404,  14463,  29359,  14553,  29314,  14643,
+     29269,  14733,  29224,  14823,  29178,  14912,  29132,  15002,
+     29086,  15091,  29040,  15180,  28993,  15269,  28946,  15358,
+     28899,  15447,  28851,  15535,  28803,  15624,  28755,  15712,
+     28707,  15800,  28658,  15888,  28610,  15976,  28560,  16064,
+     28511,  16151,  28461,  16239,  28411,  16326,  28361,  16413,
+     28311,  16500,  28260,  16587,  28209,  16673,  28158,  16760,
+     28106,  16846,  28054,  16932,  28002,  17018,  27950,  17104,
+     27897,  17190,  27844,  17275,  27791,  17361,  27738,  17446,
+     27684,  17531,  27630,  17616,  27576,  17700,  27522,  17785,
+     27467,  17869,  27412,  17953,  27357,  18037,  27301,  18121,
+     27246,  18205,  27190,  18288,  27133,  18372,  27077,  18455,
+     27020,  18538,  26963,  18621,  26906,  18703,  26848,  18786,
+     26791,  18868,  26733,  18950,  26674,  19032,  26616,  19114,
+     26557,  19195,  26498,  19277,  26439,  19358,  26379,  19439,
+     26320,  19520,  26259,  19601,  26199,  19681,  26139,  19761,
+     26078,  19841,  26017,  19921,  25956,  20001,  25894,  20081,
+     25833,  20160,  25771,  20239,  25708,  20318,  25646,  20397,
+     25583,  20475,  25520,  20554,  25457,  20632,  25394,  20710,
+     25330,  20788,  25266,  20865,  25202,  20943,  25138,  21020,
+     25073,  21097,  25008,  21174,  24943,  21251,  24878,  21327,
+     24812,  21403,  24746,  21479,  24680,  21555,  24614,  21631,
+     24548,  21706,  24481,  21781,  24414,  21856,  24347,  21931,
+     24279,  22006,  24212,  22080,  24144,  22154,  24076,  22228,
+     24008,  22302,  23939,  22375,  23870,  22449,  23801,  22522,
+     23732,  22595,  23663,  22668,  23593,  22740,  23523,  22812,
+     23453,  22884,  23383,  22956,  23312,  23028,  23241,  23099,
+     23170,  23170,  23099,  23241,  23028,  23312,  22956,  23383,
+     22884,  23453,  22812,  23523,  22740,  23593,  22668,  23663,
+     22595,  23732,  22522,  23801,  22449,  23870,  22375,  23939,
+     22302,  24008,  22228,  24076,  22154,  24144,  22080,  24212,
+     22006,  24279,  21931,  24347,  21856,  24414,  21781,  24481,
+     21706,  24548,  21631,  24614,  21555,  24680,  21479,  24746,
+     21403,  24812,  21327,  24878,  21251,  24943,  21174,  25008,
+     21097,  25073,  21020,  25138,  20943,  25202,  20865,  25266,
+     20788,  25330,  20710,  25394,  20632,  25457,  20554,  25520,
+     20475,  25583,  20397,  25646,  20318,  25708,  20239,  25771,
+     20160,  25833,  20081,  25894,  20001,  25956,  19921,  26017,
+     19841,  26078,  19761,  26139,  19681,  26199,  19601,  26259,
+     19520,  26320,  19439,  26379,  19358,  26439,  19277,  26498,
+     19195,  26557,  19114,  26616,  19032,  26674,  18950,  26733,
+     18868,  26791,  18786,  26848,  18703,  26906,  18621,  26963,
+     18538,  27020,  18455,  27077,  18372,  27133,  18288,  27190,
+     18205,  27246,  18121,  27301,  18037,  27357,  17953,  27412,
+     17869,  27467,  17785,  27522,  17700,  27576,  17616,  27630,
+     17531,  27684,  17446,  27738,  17361,  27791,  17275,  27844,
+     17190,  27897,  17104,  27950,  17018,  28002,  16932,  28054,
+     16846,  28106,  16760,  28158,  16673,  28209,  16587,  28260,
+     16500,  28311,  16413,  28361,  16326,  28411,  16239,  28461,
+     16151,  28511,  16064,  28560,  15976,  28610,  15888,  28658,
+     15800,  28707,  15712,  28755,  15624,  28803,  15535,  28851,
+     15447,  28899,  15358,  28946,  15269,  28993,  15180,  29040,
+     15091,  29086,  15002,  29132,  14912,  29178,  14823,  29224,
+     14733,  29269,  14643,  29314,  14553,  29359,  14463,  29404,
+     14373,  29448,  14282,  29492,  14192,  29535,  14101,  29579,
+     14010,  29622,  13919,  29665,  13828,  29707,  13737,  29750,
+     13646,  29792,  13554,  29833,  13463,  29875,  13371,  29916,
+     13279,  29957,  13187,  29997,  13095,  30038,  13003,  30078,
+     12910,  30118,  12818,  30157,  12725,  30196,  12633,  30235,
+     12540,  30274,  12447,  30312,  12354,  30350,  12261,  30388,
+     12167,  30425,  12074,  30462,  11980,  30499,  11887,  30536,
+     11793,  30572,  11699,  30608,  11605,  30644,  11511,  30680,
+     11417,  30715,  11323,  30750,  11228,  30784,  11134,  30819,
+     11039,  30853,  10945,  30886,  10850,  30920,  10755,  30953,
+     10660,  30986,  10565,  31018,  10469,  31050,  10374,  31082,
+     10279,  31114,  10183,  31146,  10088,  31177,   9992,  31207,
+      9896,  31238,   9800,  31268,   9704,  31298,   9608,  31328,
+      9512,  31357,   9416,  31386,   9319,  31415,   9223,  31443,
+      9127,  31471,   9030,  31499,   8933,  31527,   8836,  31554,
+      8740,  31581,   8643,  31608,   8546,  31634,   8449,  31660,
+      8351,  31686,   8254,  31711,   8157,  31737,   8059,  31761,
+      7962,  31786,   7864,  31810,   7767,  31834,   7669,  31858,
+      7571,  31881,   7473,  31904,   7376,  31927,   7278,  31950,
+      7180,  31972,   7081,  31994,   6983,  32015,   6885,  32037,
+      6787,  32058,   6688,  32078,   6590,  32099,   6491,  32119,
+      6393,  32138,   6294,  32158,   6195,  32177,   6097,  32196,
+      5998,  32214,   5899,  32233,   5800,  32251,   5701,  32268,
+      5602,  32286,   5503,  32303,   5404,  32319,   5305,  32336,
+      5205,  32352,   5106,  32368,   5007,  32383,   4907,  32398,
+      4808,  32413,   4709,  32428,   4609,  32442,   4510,  32456,
+      4410,  32470,   4310,  32483,   4211,  32496,   4111,  32509,
+      4011,  32522,   3911,  32534,   3812,  32546,   3712,  32557,
+      3612,  32568,   3512,  32579,   3412,  32590,   3312,  32600,
+      3212,  32610,   3112,  32620,   3012,  32629,   2912,  32638,
+      2811,  32647,   2711,  32656,   2611,  32664,   2511,  32672,
+      2411,  32679,   2310,  32686,   2210,  32693,   2110,  32700,
+      2009,  32706,   1909,  32712,   1809,  32718,   1708,  32723,
+      1608,  32729,   1507,  32733,   1407,  32738,   1307,  32742,
+      1206,  32746,   1106,  32749,   1005,  32753,    905,  32756,
+       804,  32758,    704,  32760,    603,  32762,    503,  32764,
+       402,  32766,    302,  32767,    201,  32767,    101,  32767,
+         0,  32767,   -101,  32767,   -201,  32767,   -302,  32767,
+      -402,  32766,   -503,  32764,   -603,  32762,   -704,  32760,
+      -804,  32758,   -905,  32756,  -1005,  32753,  -1106,  32749,
+     -1206,  32746,  -1307,  32742,  -1407,  32738,  -1507,  32733,
+     -1608,  32729,  -1708,  32723,  -1809,  32718,  -1909,  32712,
+     -2009,  32706,  -2110,  32700,  -2210,  32693,  -2310,  32686,
+     -2411,  32679,  -2511,  32672,  -2611,  32664,  -2711,  32656,
+     -2811,  32647,  -2912,  32638,  -3012,  32629,  -3112,  32620,
+     -3212,  32610,  -3312,  32600,  -3412,  32590,  -3512,  32579,
+     -3612,  32568,  -3712,  32557,  -3812,  32546,  -3911,  32534,
+     -4011,  32522,  -4111,  32509,  -4211,  32496,  -4310,  32483,
+     -4410,  32470,  -4510,  32456,  -4609,  32442,  -4709,  32428,
+     -4808,  32413,  -4907,  32398,  -5007,  32383,  -5106,  32368,
+     -5205,  32352,  -5305,  32336,  -5404,  32319,  -5503,  32303,
+     -5602,  32286,  -5701,  32268,  -5800,  32251,  -5899,  32233,
+     -5998,  32214,  -6097,  32196,  -6195,  32177,  -6294,  32158,
+     -6393,  32138,  -6491,  32119,  -6590,  32099,  -6688,  32078,
+     -6787,  32058,  -6885,  32037,  -6983,  32015,  -7081,  31994,
+     -7180,  31972,  -7278,  31950,  -7376,  31927,  -7473,  31904,
+     -7571,  31881,  -7669,  31858,  -7767,  31834,  -7864,  31810,
+     -7962,  31786,  -8059,  31761,  -8157,  31737,  -8254,  31711,
+     -8351,  31686,  -8449,  31660,  -8546,  31634,  -8643,  31608,
+     -8740,  31581,  -8836,  31554,  -8933,  31527,  -9030,  31499,
+     -9127,  31471,  -9223,  31443,  -9319,  31415,  -9416,  31386,
+     -9512,  31357,  -9608,  31328,  -9704,  31298,  -9800,  31268,
+     -9896,  31238,  -9992,  31207, -10088,  31177, -10183,  31146,
+    -10279,  31114, -10374,  31082, -10469,  31050, -10565,  31018,
+    -10660,  30986, -10755,  30953, -10850,  30920, -10945,  30886,
+    -11039,  30853, -11134,  30819, -11228,  30784, -11323,  30750,
+    -11417,  30715, -11511,  30680, -11605,  30644, -11699,  30608,
+    -11793,  30572, -11887,  30536, -11980,  30499, -12074,  30462,
+    -12167,  30425, -12261,  30388, -12354,  30350, -12447,  30312,
+    -12540,  30274, -12633,  30235, -12725,  30196, -12818,  30157,
+    -12910,  30118, -13003,  30078, -13095,  30038, -13187,  29997,
+    -13279,  29957, -13371,  29916, -13463,  29875, -13554,  29833,
+    -13646,  29792, -13737,  29750, -13828,  29707, -13919,  29665,
+    -14010,  29622, -14101,  29579, -14192,  29535, -14282,  29492,
+    -14373,  29448, -14463,  29404, -14553,  29359, -14643,  29314,
+    -14733,  29269, -14823,  29224, -14912,  29178, -15002,  29132,
+    -15091,  29086, -15180,  29040, -15269,  28993, -15358,  28946,
+    -15447,  28899, -15535,  28851, -15624,  28803, -15712,  28755,
+    -15800,  28707, -15888,  28658, -15976,  28610, -16064,  28560,
+    -16151,  28511, -16239,  28461, -16326,  28411, -16413,  28361,
+    -16500,  28311, -16587,  28260, -16673,  28209, -16760,  28158,
+    -16846,  28106, -16932,  28054, -17018,  28002, -17104,  27950,
+    -17190,  27897, -17275,  27844, -17361,  27791, -17446,  27738,
+    -17531,  27684, -17616,  27630, -17700,  27576, -17785,  27522,
+    -17869,  27467, -17953,  27412, -18037,  27357, -18121,  27301,
+    -18205,  27246, -18288,  27190, -18372,  27133, -18455,  27077,
+    -18538,  27020, -18621,  26963, -18703,  26906, -18786,  26848,
+    -18868,  26791, -18950,  26733, -19032,  26674, -19114,  26616,
+    -19195,  26557, -19277,  26498, -19358,  26439, -19439,  26379,
+    -19520,  26320, -19601,  26259, -19681,  26199, -19761,  26139,
+    -19841,  26078, -19921,  26017, -20001,  25956, -20081,  25894,
+    -20160,  25833, -20239,  25771, -20318,  25708, -20397,  25646,
+    -20475,  25583, -20554,  25520, -20632,  25457, -20710,  25394,
+    -20788,  25330, -20865,  25266, -20943,  25202, -21020,  25138,
+    -21097,  25073, -21174,  25008, -21251,  24943, -21327,  24878,
+    -21403,  24812, -21479,  24746, -21555,  24680, -21631,  24614,
+    -21706,  24548, -21781,  24481, -21856,  24414, -21931,  24347,
+    -22006,  24279, -22080,  24212, -22154,  24144, -22228,  24076,
+    -22302,  24008, -22375,  23939, -22449,  23870, -22522,  23801,
+    -22595,  23732, -22668,  23663, -22740,  23593, -22812,  23523,
+    -22884,  23453, -22956,  23383, -23028,  23312, -23099,  23241,
+    -23170,  23170, -23241,  23099, -23312,  23028, -23383,  22956,
+    -23453,  22884, -23523,  22812, -23593,  22740, -23663,  22668,
+    -23732,  22595, -23801,  22522, -23870,  22449, -23939,  22375,
+    -24008,  22302, -24076,  22228, -24144,  22154, -24212,  22080,
+    -24279,  22006, -24347,  21931, -24414,  21856, -24481,  21781,
+    -24548,  21706, -24614,  21631, -24680,  21555, -24746,  21479,
+    -24812,  21403, -24878,  21327, -24943,  21251, -25008,  21174,
+    -25073,  21097, -25138,  21020, -25202,  20943, -25266,  20865,
+    -25330,  20788, -25394,  20710, -25457,  20632, -25520,  20554,
+    -25583,  20475, -25646,  20397, -25708,  20318, -25771,  20239,
+    -25833,  20160, -25894,  20081, -25956,  20001, -26017,  19921,
+    -26078,  19841, -26139,  19761, -26199,  19681, -26259,  19601,
+    -26320,  19520, -26379,  19439, -26439,  19358, -26498,  19277,
+    -26557,  19195, -26616,  19114, -26674,  19032, -26733,  18950,
+    -26791,  18868, -26848,  18786, -26906,  18703, -26963,  18621,
+    -27020,  18538, -27077,  18455, -27133,  18372, -27190,  18288,
+    -27246,  18205, -27301,  18121, -27357,  18037, -27412,  17953,
+    -27467,  17869, -27522,  17785, -27576,  17700, -27630,  17616,
+    -27684,  17531, -27738,  17446, -27791,  17361, -27844,  17275,
+    -27897,  17190, -27950,  17104, -28002,  17018, -28054,  16932,
+    -28106,  16846, -28158,  16760, -28209,  16673, -28260,  16587,
+    -28311,  16500, -28361,  16413, -28411,  16326, -28461,  16239,
+    -28511,  16151, -28560,  16064, -28610,  15976, -28658,  15888,
+    -28707,  15800, -28755,  15712, -28803,  15624, -28851,  15535,
+    -28899,  15447, -28946,  15358, -28993,  15269, -29040,  15180,
+    -29086,  15091, -29132,  15002, -29178,  14912, -29224,  14823,
+    -29269,  14733, -29314,  14643, -29359,  14553, -29404,  14463,
+    -29448,  14373, -29492,  14282, -29535,  14192, -29579,  14101,
+    -29622,  14010, -29665,  13919, -29707,  13828, -29750,  13737,
+    -29792,  13646, -29833,  13554, -29875,  13463, -29916,  13371,
+    -29957,  13279, -29997,  13187, -30038,  13095, -30078,  13003,
+    -30118,  12910, -30157,  12818, -30196,  12725, -30235,  12633,
+    -30274,  12540, -30312,  12447, -30350,  12354, -30388,  12261,
+    -30425,  12167, -30462,  12074, -30499,  11980, -30536,  11887,
+    -30572,  11793, -30608,  11699, -30644,  11605, -30680,  11511,
+    -30715,  11417, -30750,  11323, -30784,  11228, -30819,  11134,
+    -30853,  11039, -30886,  10945, -30920,  10850, -30953,  10755,
+    -30986,  10660, -31018,  10565, -31050,  10469, -31082,  10374,
+    -31114,  10279, -31146,  10183, -31177,  10088, -31207,   9992,
+    -31238,   9896, -31268,   9800, -31298,   9704, -31328,   9608,
+    -31357,   9512, -31386,   9416, -31415,   9319, -31443,   9223,
+    -31471,   9127, -31499,   9030, -31527,   8933, -31554,   8836,
+    -31581,   8740, -31608,   8643, -31634,   8546, -31660,   8449,
+    -31686,   8351, -31711,   8254, -31737,   8157, -31761,   8059,
+    -31786,   7962, -31810,   7864, -31834,   7767, -31858,   7669,
+    -31881,   7571, -31904,   7473, -31927,   7376, -31950,   7278,
+    -31972,   7180, -31994,   7081, -32015,   6983, -32037,   6885,
+    -32058,   6787, -32078,   6688, -32099,   6590, -32119,   6491,
+    -32138,   6393, -32158,   6294, -32177,   6195, -32196,   6097,
+    -32214,   5998, -32233,   5899, -32251,   5800, -32268,   5701,
+    -32286,   5602, -32303,   5503, -32319,   5404, -32336,   5305,
+    -32352,   5205, -32368,   5106, -32383,   5007, -32398,   4907,
+    -32413,   4808, -32428,   4709, -32442,   4609, -32456,   4510,
+    -32470,   4410, -32483,   4310, -32496,   4211, -32509,   4111,
+    -32522,   4011, -32534,   3911, -32546,   3812, -32557,   3712,
+    -32568,   3612, -32579,   3512, -32590,   3412, -32600,   3312,
+    -32610,   3212, -32620,   3112, -32629,   3012, -32638,   2912,
+    -32647,   2811, -32656,   2711, -32664,   2611, -32672,   2511,
+    -32679,   2411, -32686,   2310, -32693,   2210, -32700,   2110,
+    -32706,   2009, -32712,   1909, -32718,   1809, -32723,   1708,
+    -32729,   1608, -32733,   1507, -32738,   1407, -32742,   1307,
+    -32746,   1206, -32749,   1106, -32753,   1005, -32756,    905,
+    -32758,    804, -32760,    704, -32762,    603, -32764,    503,
+    -32766,    402, -32767,    302, -32767,    201, -32767,    101,
+};
+
+const uint16_t fft_bitrev[FFT_MAX_SIZE] = {
+       0, 1024,  512, 1536,  256, 1280,  768, 1792,  128, 1152,  640, 1664,
+     384, 1408,  896, 1920,   64, 1088,  576, 1600,  320, 1344,  832, 1856,
+     192, 1216,  704, 1728,  448, 1472,  960, 1984,   32, 1056,  544, 1568,
+     288, 1312,  800, 1824,  160, 1184,  672, 1696,  416, 1440,  928, 1952,
+      96, 1120,  608, 1632,  352, 1376,  864, 1888,  224, 1248,  736, 1760,
+     480, 1504,  992, 2016,   16, 1040,  528, 1552,  272, 1296,  784, 1808,
+     144, 1168,  656, 1680,  400, 1424,  912, 1936,   80, 1104,  592, 1616,
+     336, 1360,  848, 1872,  208, 1232,  720, 1744,  464, 1488,  976, 2000,
+      48, 1072,  560, 1584,  304, 1328,  816, 1840,  176, 1200,  688, 1712,
+     432, 1456,  944, 1968,  112, 1136,  624, 1648,  368, 1392,  880, 1904,
+     240, 1264,  752, 1776,  496, 1520, 1008, 2032,    8, 1032,  520, 1544,
+     264, 1288,  776, 1800,  136, 1160,  648, 1672,  392, 1416,  904, 1928,
+      72, 1096,  584, 1608,  328, 1352,  840, 1864,  200, 1224,  712, 1736,
+     456, 1480,  968, 1992,   40, 1064,  552, 1576,  296, 1320,  808, 1832,
+     168, 1192,  680, 1704,  424, 1448,  936, 1960,  104, 1128,  616, 1640,
+     360, 1384,  872, 1896,  232, 1256,  744, 1768,  488, 1512, 1000, 2024,
+      24, 1048,  536, 1560,  280, 1304,  792, 1816,  152, 1176,  664, 1688,
+     408, 1432,  920, 1944,   88, 1112,  600, 1624,  344, 1368,  856, 1880,
+     216, 1240,  728, 1752,  472, 1496,  984, 2008,   56, 1080,  568, 1592,
+     312, 1336,  824, 1848,  184, 1208,  696, 1720,  440, 1464,  952, 1976,
+     120, 1144,  632, 1656,  376, 1400,  888, 1912,  248, 1272,  760, 1784,
+     504, 1528, 1016, 2040,    4, 1028,  516, 1540,  260, 1284,  772, 1796,
+     132, 1156,  644, 1668,  388, 1412,  900, 1924,   68, 1092,  580, 1604,
+     324, 1348,  836, 1860,  196, 1220,  708, 1732,  452, 1476,  964, 1988,
+      36, 1060,  548, 1572,  292, 1316,  804, 1828,  164, 1188,  676, 1700,
+     420, 1444,  932, 1956,  100, 1124,  612, 1636,  356, 1380,  868, 1892,
+     228, 1252,  740, 1764,  484, 1508,  996, 2020,   20, 1044,  532, 1556,
+     276, 1300,  788, 1812,  148, 1172,  660, 1684,  404, 1428,  916, 1940,
+      84, 1108,  596, 1620,  340, 1364,  852, 1876,  212, 1236,  724, 1748,
+     468, 1492,  980, 2004,   52, 1076,  564, 1588,  308, 1332,  820, 1844,
+     180, 1204,  692, 1716,  436, 1460,  948, 1972,  116, 1140,  628, 1652,
+     372, 1396,  884, 1908,  244, 1268,  756, 1780,  500, 1524, 1012, 2036,
+      12, 1036,  524, 1548,  268, 1292,  780, 1804,  140, 1164,  652, 1676,
+     396, 1420,  908, 1932,   76, 1100,  588, 1612,  332, 1356,  844, 1868,
+     204, 1228,  716, 1740,  460, 1484,  972, 1996,   44, 1068,  556, 1580,
+     300, 1324,  812, 1836,  172, 1196,  684, 1708,  428, 1452,  940, 1964,
+     108, 1132,  620, 1644,  364, 1388,  876, 1900,  236, 1260,  748, 1772,
+     492, 1516, 1004, 2028,   28, 1052,  540, 1564,  284, 1308,  796, 1820,
+     156, 1180,  668, 1692,  412, 1436,  924, 1948,   92, 1116,  604, 1628,
+     348, 1372,  860, 1884,  220, 1244,  732, 1756,  476, 1500,  988, 2012,
+      60, 1084,  572, 1596,  316, 1340,  828, 1852,  188, 1212,  700, 1724,
+     444, 1468,  956, 1980,  124, 1148,  636, 1660,  380, 1404,  892, 1916,
+     252, 1276,  764, 1788,  508, 1532, 1020, 2044,    2, 1026,  514, 1538,
+     258, 1282,  770, 1794,  130, 1154,  642, 1666,  386, 1410,  898, 1922,
+      66, 1090,  578, 1602,  322, 1346,  834, 1858,  194, 1218,  706, 1730,
+     450, 1474,  962, 1986,   34, 1058,  546, 1570,  290, 1314,  802, 1826,
+     162, 1186,  674, 1698,  418, 1442,  930, 1954,   98, 1122,  610, 1634,
+     354, 1378,  866, 1890,  226, 1250,  738, 1762,  482, 1506,  994, 2018,
+      18, 1042,  530, 1554,  274, 1298,  786, 1810,  146, 1170,  658, 1682,
+     402, 1426,  914, 1938,   82, 1106,  594, 1618,  338, 1362,  850, 1874,
+     210, 1234,  722, 1746,  466, 1490,  978, 2002,   50, 1074,  562, 1586,
+     306, 1330,  818, 1842,  178, 1202,  690, 1714,  434, 1458,  946, 1970,
+     114, 1138,  626, 1650,  370, 1394,  882, 1906,  242, 1266,  754, 1778,
+     498, 1522, 1010, 2034,   10, 1034,  522, 1546,  266, 1290,  778, 1802,
+     138, 1162,  650, 1674,  394, 1418,  906, 1930,   74, 1098,  586, 1610,
+     330, 1354,  842, 1866,  202, 1226,  714, 1738,  458, 1482,  970, 1994,
+      42, 1066,  554, 1578,  298, 1322,  810, 1834,  170, 1194,  682, 1706,
+     426, 1450,  938, 1962,  106, 1130,  618, 1642,  362, 1386,  874, 1898,
+     234, 1258,  746, 1770,  490, 1514, 1002, 2026,   26, 1050,  538, 1562,
+     282, 1306,  794, 1818,  154, 1178,  666, 1690,  410, 1434,  922, 1946,
+      90, 1114,  602, 1626,  346, 1370,  858, 1882,  218, 1242,  730, 1754,
+     474, 1498,  986, 2010,   58, 1082,  570, 1594,  314, 1338,  826, 1850,
+     186, 1210,  698, 1722,  442, 1466,  954, 1978,  122, 1146,  634, 1658,
+     378, 1402,  890, 1914,  250, 1274,  762, 1786,  506, 1530, 1018, 2042,
+       6, 1030,  518, 1542,  262, 1286,  774, 1798,  134, 1158,  646, 1670,
+     390, 1414,  902, 1926,   70, 1094,  582, 1606,  326, 1350,  838, 1862,
+     198, 1222,  710, 1734,  454, 1478,  966, 1990,   38, 1062,  550, 1574,
+     294, 1318,  806, 1830,  166, 1190,  678, 1702,  422, 1446,  934, 1958,
+     102, 1126,  614, 1638,  358, 1382,  870, 1894,  230, 1254,  742, 1766,
+     486, 1510,  998, 2022,   22, 1046,  534, 1558,  278, 1302,  790, 1814,
+     150, 1174,  662, 1686,  406, 1430,  918, 1942,   86, 1110,  598, 1622,
+     342, 1366,  854, 1878,  214, 1238,  726, 1750,  470, 1494,  982, 2006,
+      54, 1078,  566, 1590,  310, 1334,  822, 1846,  182, 1206,  694, 1718,
+     438, 1462,  950, 1974,  118, 1142,  630, 1654,  374, 1398,  886, 1910,
+     246, 1270,  758, 1782,  502, 1526, 1014, 2038,   14, 1038,  526, 1550,
+     270, 1294,  782, 1806,  142, 1166,  654, 1678,  398, 1422,  910, 1934,
+      78, 1102,  590, 1614,  334, 1358,  846, 1870,  206, 1230,  718, 1742,
+     462, 1486,  974, 1998,   46, 1070,  558, 1582,  302, 1326,  814, 1838,
+     174, 1198,  686, 1710,  430, 1454,  942, 1966,  110, 1134,  622, 1646,
+     366, 1390,  878, 1902,  238, 1262,  750, 1774,  494, 1518, 1006, 2030,
+      30, 1054,  542, 1566,  286, 1310,  798, 1822,  158, 1182,  670, 1694,
+     414, 1438,  926, 1950,   94, 1118,  606, 1630,  350, 1374,  862, 1886,
+     222, 1246,  734, 1758,  478, 1502,  990, 2014,   62, 1086,  574, 1598,
+     318, 1342,  830, 1854,  190, 1214,  702, 1726,  446, 1470,  958, 1982,
+     126, 1150,  638, 1662,  382, 1406,  894, 1918,  254, 1278,  766, 1790,
+     510, 1534, 1022, 2046,    1, 1025,  513, 1537,  257, 1281,  769, 1793,
+     129, 1153,  641, 1665,  385, 1409,  897, 1921,   65, 1089,  577, 1601,
+     321, 1345,  833, 1857,  193, 1217,  705, 1729,  449, 1473,  961, 1985,
+      33, 1057,  545, 1569,  289, 1313,  801, 1825,  161, 1185,  673, 1697,
+     417, 1441,  929, 1953,   97, 1121,  609, 1633,  353, 1377,  865, 1889,
+     225, 1249,  737, 1761,  481, 1505,  993, 2017,   17, 1041,  529, 1553,
+     273, 1297,  785, 1809,  145, 1169,  657, 1681,  401, 1425,  913, 1937,
+      81, 1105,  593, 1617,  337, 1361,  849, 1873,  209, 1233,  721, 1745,
+     465, 1489,  977, 2001,   49, 1073,  561, 1585,  305, 1329,  817, 1841,
+     177, 1201,  689, 1713,  433, 1457,  945, 1969,  113, 1137,  625, 1649,
+     369, 1393,  881, 1905,  241, 1265,  753, 1777,  497, 1521, 1009, 2033,
+       9, 1033,  521, 1545,  265, 1289,  777, 1801,  137, 1161,  649, 1673,
+     393, 1417,  905, 1929,   73, 1097,  585, 1609,  329, 1353,  841, 1865,
+     201, 1225,  713, 1737,  457, 1481,  969, 1993,   41, 1065,  553, 1577,
+     297, 1321,  809, 1833,  169, 1193,  681, 1705,  425, 1449,  937, 1961,
+     105, 1129,  617, 1641,  361, 1385,  873, 1897,  233, 1257,  745, 1769,
+     489, 1513, 1001, 2025,   25, 1049,  537, 1561,  281, 1305,  793, 1817,
+     153, 1177,  665, 1689,  409, 1433,  921, 1945,   89, 1113,  601, 1625,
+     345, 1369,  857, 1881,  217, 1241,  729, 1753,  473, 1497,  985, 2009,
+      57, 1081,  569, 1593,  313, 1337,  825, 1849,  185, 1209,  697, 1721,
+     441, 1465,  953, 1977,  121, 1145,  633, 1657,  377, 1401,  889, 1913,
+     249, 1273,  761, 1785,  505, 1529, 1017, 2041,    5, 1029,  517, 1541,
+     261, 1285,  773, 1797,  133, 1157,  645, 1669,  389, 1413,  901, 1925,
+      69, 1093,  581, 1605,  325, 1349,  837, 1861,  197, 1221,  709, 1733,
+     453, 1477,  965, 1989,   37, 1061,  549, 1573,  293, 1317,  805, 1829,
+     165, 1189,  677, 1701,  421, 1445,  933, 1957,  101, 1125,  613, 1637,
+     357, 1381,  869, 1893,  229, 1253,  741, 1765,  485, 1509,  997, 2021,
+      21, 1045,  533, 1557,  277, 1301,  789, 1813,  149, 1173,  661, 1685,
+     405, 1429,  917, 1941,   85, 1109,  597, 1621,  341, 1365,  853, 1877,
+     213, 1237,  725, 1749,  469, 1493,  981, 2005,   53, 1077,  565, 1589,
+     309, 1333,  821, 1845,  181, 1205,  693, 1717,  437, 1461,  949, 1973,
+     117, 1141,  629, 1653,  373, 1397,  885, 1909,  245, 1269,  757, 1781,
+     501, 1525, 1013, 2037,   13, 1037,  525, 1549,  269, 1293,  781, 1805,
+     141, 1165,  653, 1677,  397, 1421,  909, 1933,   77, 1101,  589, 1613,
+     333, 1357,  845, 1869,  205, 1229,  717, 1741,  461, 1485,  973, 1997,
+      45, 1069,  557, 1581,  301, 1325,  813, 1837,  173, 1197,  685, 1709,
+     429, 1453,  941, 1965,  109, 1133,  621, 1645,  365, 1389,  877, 1901,
+     237, 1261,  749, 1773,  493, 1517, 1005, 2029,   29, 1053,  541, 1565,
+     285, 1309,  797, 1821,  157, 1181,  669, 1693,  413, 1437,  925, 1949,
+      93, 1117,  605, 1629,  349, 1373,  861, 1885,  221, 1245,  733, 1757,
+     477, 1501,  989, 2013,   61, 1085,  573, 1597,  317, 1341,  829, 1853,
+     189, 1213,  701, 1725,  445, 1469,  957, 1981,  125, 1149,  637, 1661,
+     381, 1405,  893, 1917,  253, 1277,  765, 1789,  509, 1533, 1021, 2045,
+       3, 1027,  515, 1539,  259, 1283,  771, 1795,  131, 1155,  643, 1667,
+     387, 1411,  899, 1923,   67, 1091,  579, 1603,  323, 1347,  835, 1859,
+     195, 1219,  707, 1731,  451, 1475,  963, 1987,   35, 1059,  547, 1571,
+     291, 1315,  803, 1827,  163, 1187,  675, 1699,  419, 1443,  931, 1955,
+      99, 1123,  611, 1635,  355, 1379,  867, 1891,  227, 1251,  739, 1763,
+     483, 1507,  995, 2019,   19, 1043,  531, 1555,  275, 1299,  787, 1811,
+     147, 1171,  659, 1683,  403, 1427,  915, 1939,   83, 1107,  595, 1619,
+     339, 1363,  851, 1875,  211, 1235,  723, 1747,  467, 1491,  979, 2003,
+      51, 1075,  563, 1587,  307, 1331,  819, 1843,  179, 1203,  691, 1715,
+     435, 1459,  947, 1971,  115, 1139,  627, 1651,  371, 1395,  883, 1907,
+     243, 1267,  755, 1779,  499, 1523, 1011, 2035,   11, 1035,  523, 1547,
+     267, 1291,  779, 1803,  139, 1163,  651, 1675,  395, 1419,  907, 1931,
+      75, 1099,  587, 1611,  331, 1355,  843, 1867,  203, 1227,  715, 1739,
+     459, 1483,  971, 1995,   43, 1067,  555, 1579,  299, 1323,  811, 1835,
+     171, 1195,  683, 1707,  427, 1451,  939, 1963,  107, 1131,  619, 1643,
+     363, 1387,  875, 1899,  235, 1259,  747, 1771,  491, 1515, 1003, 2027,
+      27, 1051,  539, 1563,  283, 1307,  795, 1819,  155, 1179,  667, 1691,
+     411, 1435,  923, 1947,   91, 1115,  603, 1627,  347, 1371,  859, 1883,
+     219, 1243,  731, 1755,  475, 1499,  987, 2011,   59, 1083,  571, 1595,
+     315, 1339,  827, 1851,  187, 1211,  699, 1723,  443, 1467,  955, 1979,
+     123, 1147,  635, 1659,  379, 1403,  891, 1915,  251, 1275,  763, 1787,
+     507, 1531, 1019, 2043,    7, 1031,  519, 1543,  263, 1287,  775, 1799,
+     135, 1159,  647, 1671,  391, 1415,  903, 1927,   71, 1095,  583, 1607,
+     327, 1351,  839, 1863,  199, 1223,  711, 1735,  455, 1479,  967, 1991,
+      39, 1063,  551, 1575,  295, 1319,  807, 1831,  167, 1191,  679, 1703,
+     423, 1447,  935, 1959,  103, 1127,  615, 1639,  359, 1383,  871, 1895,
+     231, 1255,  743, 1767,  487, 1511,  999, 2023,   23, 1047,  535, 1559,
+     279, 1303,  791, 1815,  151, 1175,  663, 1687,  407, 1431,  919, 1943,
+      87, 1111,  599, 1623,  343, 1367,  855, 1879,  215, 1239,  727, 1751,
+     471, 1495,  983, 2007,   55, 1079,  567, 1591,  311, 1335,  823, 1847,
+     183, 1207,  695, 1719,  439, 1463,  951, 1975,  119, 1143,  631, 1655,
+     375, 1399,  887, 1911,  247, 1271,  759, 1783,  503, 1527, 1015, 2039,
+      15, 1039,  527, 1551,  271, 1295,  783, 1807,  143, 1167,  655, 1679,
+     399, 1423,  911, 1935,   79, 1103,  591, 1615,  335, 1359,  847, 1871,
+     207, 1231,  719, 1743,  463, 1487,  975, 1999,   47, 1071,  559, 1583,
+     303, 1327,  815, 1839,  175, 1199,  687, 1711,  431, 1455,  943, 1967,
+     111, 1135,  623, 1647,  367, 1391,  879, 1903,  239, 1263,  751, 1775,
+     495, 1519, 1007, 2031,   31, 1055,  543, 1567,  287, 1311,  799, 1823,
+     159, 1183,  671, 1695,  415, 1439,  927, 1951,   95, 1119,  607, 1631,
+     351, 1375,  863, 1887,  223, 1247,  735, 1759,  479, 1503,  991, 2015,
+      63, 1087,  575, 1599,  319, 1343,  831, 1855,  191, 1215,  703, 1727,
+     447, 1471,  959, 1983,  127, 1151,  639, 1663,  383, 1407,  895, 1919,
+     255, 1279,  767, 1791,  511, 1535, 1023, 2047,
+};
+
@@ -0,0 +1,29 @@
+/**
+ * VibeMon FFT Tables Header
+ * Constant tables shared by all transform sizes (placed in flash)
+ */
+
+#ifndef FFT_TABLES_H
+#define FFT_TABLES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FFT_MAX_LOG2            11
+#define FFT_MAX_SIZE            (1 << FFT_MAX_LOG2)
+
+// W_M^k = cos - i*sin, k < M/2, interleaved {cos, sin}; M = FFT_MAX_SIZE
+extern const float fft_twiddle_f32[FFT_MAX_SIZE];
+extern const int16_t fft_twiddle_q15[FFT_MAX_SIZE];
+
+// Bit reversal of 0..M-1 over FFT_MAX_LOG2 bits
+extern const uint16_t fft_bitrev[FFT_MAX_SIZE];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FFT_TABLES_H
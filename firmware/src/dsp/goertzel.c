@@ -0,0 +1,112 @@
+/**
+ * VibeMon Goertzel Filter Bank Implementation
+ * Each target is a second-order resonator s = x + c s1 - s2. At the end of
+ * a block its squared magnitude is s1^2 + s2^2 - c s1 s2, which holds for
+ * non-integer bin positions too. Cost is one multiply-add pair per target
+ * per sample versus an n log n transform per frame.
+ */
+
+#include "goertzel.h"
+
+#include <string.h>
+#include <math.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static void finish_block(goertzel_bank_t *bank) {
+    // Rectangular window: a sine of amplitude A reads |X| = A N / 2
+    const float scale = 2.0f / bank->block_len;
+    
+    for (uint8_t i = 0; i < bank->count; i++) {
+        const float s1 = bank->s1[i];
+        const float s2 = bank->s2[i];
+        float power = s1 * s1 + s2 * s2 - bank->coeff[i] * s1 * s2;
+        bank->amplitude[i] = sqrtf(power > 0 ? power : 0) * scale;
+        bank->s1[i] = 0;
+        bank->s2[i] = 0;
+    }
+    
+    bank->position = 0;
+    bank->blocks++;
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool goertzel_bank_init(goertzel_bank_t *bank, float sample_rate_hz, uint16_t block_len,
+                        const float *freqs_hz, uint8_t count) {
+    if (!bank || sample_rate_hz <= 0 || block_len == 0 ||
+        count > GOERTZEL_MAX_TARGETS || (count > 0 && !freqs_hz)) {
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < count; i++) {
+        if (freqs_hz[i] <= 0 || freqs_hz[i] >= 0.5f * sample_rate_hz) {
+            return false;
+        }
+    }
+    
+    bank->sample_rate_hz = sample_rate_hz;
+    bank->block_len = block_len;
+    bank->count = count;
+    
+    for (uint8_t i = 0; i < count; i++) {
+        bank->freq_hz[i] = freqs_hz[i];
+        bank->coeff[i] = 2.0f * cosf(2.0f * (float)M_PI * freqs_hz[i] / sample_rate_hz);
+    }
+    
+    memset(bank->amplitude, 0, sizeof(bank->amplitude));
+    bank->blocks = 0;
+    goertzel_bank_reset(bank);
+    
+    return true;
+}
+
+void goertzel_bank_reset(goertzel_bank_t *bank) {
+    memset(bank->s1, 0, sizeof(bank->s1));
+    memset(bank->s2, 0, sizeof(bank->s2));
+    bank->position = 0;
+}
+
+uint32_t goertzel_bank_push(goertzel_bank_t *bank, const float *samples, size_t count) {
+    uint32_t completed = 0;
+    
+    if (bank->count == 0) {
+        return 0;
+    }
+    
+    while (count > 0) {
+        size_t run = bank->block_len - bank->position;
+        if (run > count) {
+            run = count;
+        }
+    
+        // Target-outer loop keeps one resonator's state in registers
+        for (uint8_t i = 0; i < bank->count; i++) {
+            const float c = bank->coeff[i];
+            float s1 = bank->s1[i];
+            float s2 = bank->s2[i];
+            for (size_t j = 0; j < run; j++) {
+                const float s0 = samples[j] + c * s1 - s2;
+                s2 = s1;
+                s1 = s0;
+            }
+            bank->s1[i] = s1;
+            bank->s2[i] = s2;
+        }
+    
+        samples += run;
+        count -= run;
+        bank->position += run;
+    
+        if (bank->position == bank->block_len) {
+            finish_block(bank);
+            completed++;
+        }
+    }
+    
+    return completed;
+}
@@ -0,0 +1,75 @@
+/**
+ * VibeMon Goertzel Filter Bank Header
+ * Amplitudes at a short list of arbitrary frequencies, updated sample by
+ * sample with two state variables per target and no sample buffer
+ */
+
+#ifndef GOERTZEL_H
+#define GOERTZEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Configuration
+// ===========================================
+#define GOERTZEL_MAX_TARGETS    16
+
+// ===========================================
+// Bank State
+// ===========================================
+typedef struct {
+    float coeff[GOERTZEL_MAX_TARGETS];      // 2 cos(2 pi f / fs)
+    float s1[GOERTZEL_MAX_TARGETS];
+    float s2[GOERTZEL_MAX_TARGETS];
+    float freq_hz[GOERTZEL_MAX_TARGETS];
+    float amplitude[GOERTZEL_MAX_TARGETS];  // Latest completed block
+    uint8_t count;
+    
+    float sample_rate_hz;
+    uint16_t block_len;         // Samples per result (resolution fs / block_len)
+    uint16_t position;          // Samples into the current block
+    uint32_t blocks;            // Blocks completed since init
+} goertzel_bank_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Initialize a bank for a list of target frequencies
+ * @param bank Bank
+ * @param sample_rate_hz Input sample rate
+ * @param block_len Samples per evaluation block
+ * @param freqs_hz Target frequencies (0 < f < sample_rate / 2)
+ * @param count Number of targets (<= GOERTZEL_MAX_TARGETS)
+ * @return true on success, false on invalid parameters
+ */
+bool goertzel_bank_init(goertzel_bank_t *bank, float sample_rate_hz, uint16_t block_len,
+                        const float *freqs_hz, uint8_t count);
+
+/**
+ * Clear filter state and discard the partial block
+ * @param bank Bank
+ */
+void goertzel_bank_reset(goertzel_bank_t *bank);
+
+/**
+ * Feed input samples
+ * @param bank Bank
+ * @param samples Input samples
+ * @param count Number of samples
+ * @return Number of blocks completed
+ */
+uint32_t goertzel_bank_push(goertzel_bank_t *bank, const float *samples, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GOERTZEL_H
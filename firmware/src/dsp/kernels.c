@@ -0,0 +1,112 @@
+/**
+ * VibeMon DSP Kernels Implementation
+ */
+
+#include "kernels.h"
+
+#include <math.h>
+
+#if DSP_KERNELS_ESP_DSP
+#include "dsps_dotprod.h"
+#include "dsps_mul.h"
+#endif
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+float dsp_dot_f32(const float *a, const float *b, size_t n) {
+#if DSP_KERNELS_ESP_DSP
+    float result = 0;
+    dsps_dotprod_f32(a, b, &result, (int)n);
+    return result;
+#else
+    // Four chains hide the FPU's multiply-add latency
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    size_t i = 0;
+    
+    for (; i + 4 <= n; i += 4) {
+        s0 += a[i] * b[i];
+        s1 += a[i + 1] * b[i + 1];
+        s2 += a[i + 2] * b[i + 2];
+        s3 += a[i + 3] * b[i + 3];
+    }
+    for (; i < n; i++) {
+        s0 += a[i] * b[i];
+    }
+    
+    return (s0 + s1) + (s2 + s3);
+#endif
+}
+
+void dsp_mul_f32(const float *a, const float *b, float *out, size_t n) {
+#if DSP_KERNELS_ESP_DSP
+    dsps_mul_f32(a, b, out, (int)n, 1, 1, 1);
+#else
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] * b[i];
+    }
+#endif
+}
+
+void dsp_biquad_f32(const float *in, float *out, size_t n,
+                    const float coeffs[5], float state[2]) {
+    // Coefficients and state in locals so they stay in registers
+    const float b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2];
+    const float a1 = coeffs[3], a2 = coeffs[4];
+    float z1 = state[0], z2 = state[1];
+    
+    for (size_t i = 0; i < n; i++) {
+        const float x = in[i];
+        const float y = b0 * x + z1;
+        z1 = b1 * x - a1 * y + z2;
+        z2 = b2 * x - a2 * y;
+        out[i] = y;
+    }
+    
+    state[0] = z1;
+    state[1] = z2;
+}
+
+void dsp_cmag_f32(const float *in, float *out, size_t n, float scale) {
+    for (size_t k = 0; k < n; k++) {
+        const float re = in[2 * k];
+        const float im = in[2 * k + 1];
+        out[k] = sqrtf(re * re + im * im) * scale;
+    }
+}
+
+void dsp_fft2r_stage_f32(float *data, size_t n, size_t half,
+                         const float *twiddle, size_t stride) {
+    const size_t size = half << 1;
+    
+    // First stage: W = 1, no multiplies
+    if (half == 1) {
+        for (size_t a = 0; a < n; a += 2) {
+            const float br = data[2 * a + 2], bi = data[2 * a + 3];
+            data[2 * a + 2] = data[2 * a] - br;
+            data[2 * a + 3] = data[2 * a + 1] - bi;
+            data[2 * a] += br;
+            data[2 * a + 1] += bi;
+        }
+        return;
+    }
+    
+    for (size_t k = 0; k < half; k++) {
+        const float wr = twiddle[2 * k * stride];
+        const float wi = twiddle[2 * k * stride + 1];
+    
+        for (size_t a = k; a < n; a += size) {
+            const size_t b = a + half;
+    
+            // t = (wr - i*wi) * x[b]
+            const float tr = wr * data[2 * b] + wi * data[2 * b + 1];
+            const float ti = wr * data[2 * b + 1] - wi * data[2 * b];
+    
+            data[2 * b] = data[2 * a] - tr;
+            data[2 * b + 1] = data[2 * a + 1] - ti;
+            data[2 * a] += tr;
+            data[2 * a + 1] += ti;
+        }
+    }
+}
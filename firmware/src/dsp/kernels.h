@@ -0,0 +1,93 @@
+/**
+ * VibeMon DSP Kernels Header
+ * Inner loops shared by the FFT, filter and window code. The portable C
+ * versions are single precision (the ESP32 FPU has no double support)
+ * and keep several independent accumulators so the LX6 multiply-add
+ * pipeline stays busy. Host and target run the same operations in the
+ * same order; results are bit-identical as long as the compiler does not
+ * fuse multiply-adds (platformio.ini sets -ffp-contract=off).
+ *
+ * With DSP_KERNELS_ESP_DSP set to 1 (opt-in, and the esp-dsp component
+ * added to the build), dot product and element-wise multiply route to
+ * esp-dsp's Xtensa implementations. Multiply is unchanged; the dot
+ * product accumulates in a single chain, so it differs from the portable
+ * result by rounding only, at most n * FLT_EPSILON * sum(|a[i] * b[i]|).
+ *
+ * Biquad, complex magnitude and the FFT butterfly have no esp-dsp path:
+ * its biquad is direct form II, which loses precision at the 0.5 Hz
+ * gravity corner; it has no complex magnitude; and its FFT has no stage
+ * entry point and a different twiddle layout. There is no block FIR
+ * kernel; the decimator, the only FIR, computes one dot product per kept
+ * output instead.
+ */
+
+#ifndef DSP_KERNELS_H
+#define DSP_KERNELS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef DSP_KERNELS_ESP_DSP
+#define DSP_KERNELS_ESP_DSP     0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Dot product
+ * @param a, b Input vectors
+ * @param n Length
+ * @return sum(a[i] * b[i])
+ */
+float dsp_dot_f32(const float *a, const float *b, size_t n);
+
+/**
+ * Element-wise multiply (windowing)
+ * @param a, b Input vectors
+ * @param out Output, out[i] = a[i] * b[i] (may alias a or b)
+ * @param n Length
+ */
+void dsp_mul_f32(const float *a, const float *b, float *out, size_t n);
+
+/**
+ * Biquad over a block, transposed direct form II
+ * @param in Input samples
+ * @param out Output samples (may alias in)
+ * @param n Number of samples
+ * @param coeffs { b0, b1, b2, a1, a2 } with a0 = 1
+ * @param state { z1, z2 }, updated
+ */
+void dsp_biquad_f32(const float *in, float *out, size_t n,
+                    const float coeffs[5], float state[2]);
+
+/**
+ * Scaled magnitude of interleaved complex values
+ * @param in Complex input, {re, im} pairs
+ * @param out Output, out[k] = |in[k]| * scale
+ * @param n Number of complex values
+ * @param scale Output scale
+ */
+void dsp_cmag_f32(const float *in, float *out, size_t n, float scale);
+
+/**
+ * One radix-2 decimation-in-time stage over bit-reversed data
+ * @param data Interleaved complex data, n values
+ * @param n Transform length
+ * @param half Butterfly span (size of the sub-transforms being merged)
+ * @param twiddle Interleaved {cos, sin} table; W^k at twiddle[2 * k * stride]
+ * @param stride Table step for this stage
+ */
+void dsp_fft2r_stage_f32(float *data, size_t n, size_t half,
+                         const float *twiddle, size_t stride);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DSP_KERNELS_H
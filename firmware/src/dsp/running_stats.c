@@ -0,0 +1,87 @@
+/**
+ * VibeMon Running Statistics Implementation
+ * Update and merge formulas from Pebay, "Formulas for robust, one-pass
+ * parallel computation of covariances and arbitrary-order statistical
+ * moments" (2008).
+ */
+
+#include "running_stats.h"
+
+#include <string.h>
+#include <math.h>
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+void running_stats_reset(running_stats_t *s) {
+    memset(s, 0, sizeof(*s));
+}
+
+void running_stats_add_block(running_stats_t *s, const float *samples, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        running_stats_add(s, samples[i]);
+    }
+}
+
+void running_stats_merge(running_stats_t *s, const running_stats_t *other) {
+    if (other->count == 0) {
+        return;
+    }
+    if (s->count == 0) {
+        *s = *other;
+        return;
+    }
+    
+    const float na = (float)s->count;
+    const float nb = (float)other->count;
+    const float n = na + nb;
+    const float delta = other->mean - s->mean;
+    const float delta2 = delta * delta;
+    const float nab = na * nb / n;
+    
+    // Higher moments first: they need both windows' m2 and m3
+    s->m4 += other->m4 +
+             delta2 * delta2 * nab * (na * na - na * nb + nb * nb) / (n * n) +
+             6.0f * delta2 * (na * na * other->m2 + nb * nb * s->m2) / (n * n) +
+             4.0f * delta * (na * other->m3 - nb * s->m3) / n;
+    s->m3 += other->m3 +
+             delta2 * delta * nab * (na - nb) / n +
+             3.0f * delta * (na * other->m2 - nb * s->m2) / n;
+    s->m2 += other->m2 + delta2 * nab;
+    s->mean += delta * nb / n;
+    
+    s->min = fminf(s->min, other->min);
+    s->max = fmaxf(s->max, other->max);
+    s->count += other->count;
+}
+
+float running_stats_std(const running_stats_t *s) {
+    return (s->count > 0) ? sqrtf(s->m2 / s->count) : 0;
+}
+
+float running_stats_rms(const running_stats_t *s) {
+    return (s->count > 0) ? sqrtf(s->mean * s->mean + s->m2 / s->count) : 0;
+}
+
+float running_stats_peak(const running_stats_t *s) {
+    return (s->count > 0) ? fmaxf(s->max - s->mean, s->mean - s->min) : 0;
+}
+
+float running_stats_peak_to_peak(const running_stats_t *s) {
+    return (s->count > 0) ? s->max - s->min : 0;
+}
+
+float running_stats_skewness(const running_stats_t *s) {
+    if (s->count == 0 || s->m2 <= 0) {
+        return 0;
+    }
+    return sqrtf((float)s->count) * s->m3 / (s->m2 * sqrtf(s->m2));
+}
+
+float running_stats_kurtosis(const running_stats_t *s) {
+    if (s->count == 0 || s->m2 <= 0) {
+        return 0;
+    }
+    return s->count * s->m4 / (s->m2 * s->m2);
+}
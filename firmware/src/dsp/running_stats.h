@@ -0,0 +1,129 @@
+/**
+ * VibeMon Running Statistics Header
+ * Single-pass mean and central moments up to the fourth (Welford updates,
+ * Pebay merge), plus extremes. O(1) memory per channel; two windows can
+ * be merged exactly, so per-second results combine into per-minute ones.
+ */
+
+#ifndef RUNNING_STATS_H
+#define RUNNING_STATS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Accumulator
+// ===========================================
+typedef struct {
+    uint32_t count;
+    float mean;
+    float m2;                   // Sums of powers of deviations from the mean
+    float m3;
+    float m4;
+    float min;
+    float max;
+} running_stats_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Clear an accumulator
+ * @param s Accumulator
+ */
+void running_stats_reset(running_stats_t *s);
+
+/**
+ * Add one sample
+ * @param s Accumulator
+ * @param x Sample
+ */
+static inline void running_stats_add(running_stats_t *s, float x) {
+    const float n1 = (float)s->count;
+    const float n = n1 + 1.0f;
+    const float delta = x - s->mean;
+    const float delta_n = delta / n;
+    const float delta_n2 = delta_n * delta_n;
+    const float term = delta * delta_n * n1;
+    
+    // Higher moments first: they need the previous m2 and m3
+    s->m4 += term * delta_n2 * (n * n - 3.0f * n + 3.0f) +
+             6.0f * delta_n2 * s->m2 - 4.0f * delta_n * s->m3;
+    s->m3 += term * delta_n * (n - 2.0f) - 3.0f * delta_n * s->m2;
+    s->m2 += term;
+    s->mean += delta_n;
+    
+    if (s->count == 0 || x < s->min) s->min = x;
+    if (s->count == 0 || x > s->max) s->max = x;
+    s->count++;
+}
+
+/**
+ * Add a block of samples
+ * @param s Accumulator
+ * @param samples Samples
+ * @param count Number of samples
+ */
+void running_stats_add_block(running_stats_t *s, const float *samples, size_t count);
+
+/**
+ * Merge another window into an accumulator
+ * @param s Accumulator, becomes the combined window
+ * @param other Window to add (unchanged)
+ */
+void running_stats_merge(running_stats_t *s, const running_stats_t *other);
+
+/**
+ * Get RMS about the mean (standard deviation; AC RMS of a signal)
+ * @param s Accumulator
+ * @return Population standard deviation, 0 if empty
+ */
+float running_stats_std(const running_stats_t *s);
+
+/**
+ * Get RMS including the mean
+ * @param s Accumulator
+ * @return sqrt(mean^2 + variance), 0 if empty
+ */
+float running_stats_rms(const running_stats_t *s);
+
+/**
+ * Get largest deviation from the mean
+ * @param s Accumulator
+ * @return max(max - mean, mean - min)
+ */
+float running_stats_peak(const running_stats_t *s);
+
+/**
+ * Get peak-to-peak range
+ * @param s Accumulator
+ * @return max - min
+ */
+float running_stats_peak_to_peak(const running_stats_t *s);
+
+/**
+ * Get skewness
+ * @param s Accumulator
+ * @return Third standardized moment, 0 for a constant signal
+ */
+float running_stats_skewness(const running_stats_t *s);
+
+/**
+ * Get kurtosis
+ * @param s Accumulator
+ * @return Fourth standardized moment (3 for Gaussian noise, 1.5 for a
+ *         sine; impacts push it well above 3), 0 for a constant signal
+ */
+float running_stats_kurtosis(const running_stats_t *s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RUNNING_STATS_H
@@ -0,0 +1,194 @@
+/**
+ * VibeMon Trend Implementation
+ */
+
+#include "trend.h"
+
+#include <math.h>
+#include <string.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+/**
+ * Append a point to a level, evicting the oldest once full
+ * With x = 0 at the oldest point, dropping it shifts every remaining x
+ * down by one, which takes the sum of the remaining y off sum(x y).
+ */
+static void series_push(trend_series_t *s, float value) {
+    const double y = value;
+    const double l = logf(fmaxf(value, TREND_LOG_FLOOR));
+    
+    if (s->count == TREND_POINTS) {
+        const double y0 = s->y[s->head];
+        const double l0 = logf(fmaxf(s->y[s->head], TREND_LOG_FLOOR));
+    
+        s->sxy -= s->sy - y0;
+        s->sy -= y0;
+        s->syy -= y0 * y0;
+        s->sxl -= s->sl - l0;
+        s->sl -= l0;
+        s->sll -= l0 * l0;
+        s->count--;
+    }
+    
+    const double x = s->count;
+    s->sy += y;
+    s->sxy += x * y;
+    s->syy += y * y;
+    s->sl += l;
+    s->sxl += x * l;
+    s->sll += l * l;
+    
+    s->y[s->head] = value;
+    s->head = (s->head + 1) % TREND_POINTS;
+    s->count++;
+}
+
+/**
+ * Fine periods from the newest fine point back to the newest point of a level
+ * A coarse point is the mean of ratio points, so it stands for their
+ * midpoint, (ratio - 1) / 2 periods before the last of them; points
+ * pending since it was formed add to the lag.
+ */
+static float level_lag(const trend_t *t, uint8_t level) {
+    float lag = 0;
+    float period = 1;
+    
+    for (uint8_t lv = 1; lv <= level; lv++) {
+        lag += (t->pending[lv - 1] + 0.5f * (t->ratio - 1)) * period;
+        period *= t->ratio;
+    }
+    
+    return lag;
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool trend_init(trend_t *t, uint16_t ratio) {
+    if (!t || ratio < 2) {
+        return false;
+    }
+    
+    t->ratio = ratio;
+    trend_reset(t);
+    
+    return true;
+}
+
+void trend_reset(trend_t *t) {
+    memset(t->level, 0, sizeof(t->level));
+    memset(t->pending, 0, sizeof(t->pending));
+    memset(t->pending_sum, 0, sizeof(t->pending_sum));
+}
+
+void trend_push(trend_t *t, float value) {
+    if (!isfinite(value)) {
+        return;
+    }
+    
+    series_push(&t->level[0], value);
+    
+    // Each coarser level averages ratio points of the one below
+    for (uint8_t lv = 1; lv < TREND_LEVELS; lv++) {
+        t->pending_sum[lv - 1] += value;
+        if (++t->pending[lv - 1] < t->ratio) {
+            break;
+        }
+        value = t->pending_sum[lv - 1] / t->ratio;
+        t->pending[lv - 1] = 0;
+        t->pending_sum[lv - 1] = 0;
+        series_push(&t->level[lv], value);
+    }
+}
+
+bool trend_fit(const trend_t *t, uint8_t level, trend_model_t model, trend_fit_t *fit) {
+    if (level >= TREND_LEVELS || !fit) {
+        return false;
+    }
+    
+    const trend_series_t *s = &t->level[level];
+    if (s->count < TREND_MIN_POINTS) {
+        return false;
+    }
+    
+    // Closed forms for x = 0 .. n-1
+    const double n = s->count;
+    const double sx = n * (n - 1) / 2;
+    const double sxx = (n - 1) * n * (2 * n - 1) / 6;
+    const double dx = n * sxx - sx * sx;
+    
+    const bool lin = (model == TREND_MODEL_LINEAR);
+    const double sy = lin ? s->sy : s->sl;
+    const double sxy = lin ? s->sxy : s->sxl;
+    const double syy = lin ? s->syy : s->sll;
+    
+    const double cov = n * sxy - sx * sy;
+    const double dy = n * syy - sy * sy;
+    const double slope = cov / dx;
+    const double at_newest = (sy - slope * sx) / n + slope * (n - 1);
+    
+    fit->model = model;
+    fit->slope = (float)slope;
+    fit->current = (float)(lin ? at_newest : exp(at_newest));
+    fit->r2 = (dy > 0) ? (float)(cov * cov / (dx * dy)) : 0;
+    fit->points = s->count;
+    
+    return true;
+}
+
+float trend_points_to(const trend_fit_t *fit, float threshold) {
+    if (fit->current >= threshold) {
+        return 0;
+    }
+    if (fit->slope <= 0) {
+        return INFINITY;
+    }
+    
+    if (fit->model == TREND_MODEL_EXPONENTIAL) {
+        return logf(threshold / fit->current) / fit->slope;
+    }
+    return (threshold - fit->current) / fit->slope;
+}
+
+float trend_time_to(const trend_t *t, float threshold, float fine_period_s, float min_r2) {
+    float period_s = fine_period_s;
+    for (uint8_t lv = 1; lv < TREND_LEVELS; lv++) {
+        period_s *= t->ratio;
+    }
+    
+    bool enough = false;
+    
+    for (int lv = TREND_LEVELS - 1; lv >= 0; lv--) {
+        trend_fit_t lin, exp_fit;
+        const bool fit_lin = trend_fit(t, lv, TREND_MODEL_LINEAR, &lin);
+        const bool fit_exp = trend_fit(t, lv, TREND_MODEL_EXPONENTIAL, &exp_fit);
+        const bool have_lin = fit_lin && lin.r2 >= min_r2;
+        const bool have_exp = fit_exp && exp_fit.r2 >= min_r2;
+    
+        if (have_lin || have_exp) {
+            const trend_fit_t *best = (have_exp && (!have_lin || exp_fit.r2 > lin.r2))
+                                      ? &exp_fit : &lin;
+    
+            // Count from the newest fine point, not the lagging coarse one
+            const float ahead = trend_points_to(best, threshold) * period_s -
+                                level_lag(t, lv) * fine_period_s;
+            return fmaxf(ahead, 0);
+        }
+        enough |= fit_lin;
+    
+        period_s /= t->ratio;
+    }
+    
+    // Enough points but no fit explains them: a steady metric, no trend
+    if (enough) {
+        const trend_series_t *s = &t->level[0];
+        const float latest = s->y[(s->head + TREND_POINTS - 1) % TREND_POINTS];
+        return (latest >= threshold) ? 0 : INFINITY;
+    }
+    
+    return NAN;
+}
@@ -0,0 +1,132 @@
+/**
+ * VibeMon Trend Header
+ * Long-horizon trend of one slowly sampled metric (e.g. one aggregate per
+ * minute). Points are kept in a two-level circular history: every point
+ * enters the fine level, and the mean of each ratio fine points enters
+ * the coarse level, so a few hundred floats cover days.
+ *
+ * Each level keeps least-squares sums over the points it holds, for a
+ * linear model y = a + b x and an exponential model ln y = a + g x, and
+ * updates them in O(1) as points enter and leave. Points are taken to be
+ * evenly spaced.
+ */
+
+#ifndef TREND_H
+#define TREND_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Configuration
+// ===========================================
+#define TREND_LEVELS            2
+#define TREND_POINTS            128     // Points held per level
+#define TREND_MIN_POINTS        8       // Fewer points give no fit
+#define TREND_LOG_FLOOR         1e-6f   // Values clamped to this for ln y
+
+// ===========================================
+// Trend State
+// ===========================================
+typedef struct {
+    float y[TREND_POINTS];      // Circular, oldest at head once full
+    uint16_t head;
+    uint16_t count;
+    
+    // Sums over the held points, x = 0 for the oldest
+    double sy, sxy, syy;        // y
+    double sl, sxl, sll;        // ln y
+} trend_series_t;
+
+typedef struct {
+    trend_series_t level[TREND_LEVELS];
+    uint16_t ratio;             // Fine points per coarse point
+    uint16_t pending[TREND_LEVELS - 1];     // Points since the last one passed up
+    float pending_sum[TREND_LEVELS - 1];
+} trend_t;
+
+typedef enum {
+    TREND_MODEL_LINEAR = 0,
+    TREND_MODEL_EXPONENTIAL
+} trend_model_t;
+
+typedef struct {
+    trend_model_t model;
+    float current;              // Fitted value at the newest point
+    float slope;                // Per point: units (linear) or ln units (exponential)
+    float r2;                   // Coefficient of determination, on the model's scale
+    uint16_t points;
+} trend_fit_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Initialize a trend
+ * @param t Trend
+ * @param ratio Fine points averaged into one coarse point (>= 2)
+ * @return true on success
+ */
+bool trend_init(trend_t *t, uint16_t ratio);
+
+/**
+ * Discard all points
+ * @param t Trend
+ */
+void trend_reset(trend_t *t);
+
+/**
+ * Add one point
+ * Non-finite values are ignored.
+ * @param t Trend
+ * @param value New aggregate
+ */
+void trend_push(trend_t *t, float value);
+
+/**
+ * Fit one model over the points held by a level
+ * @param t Trend
+ * @param level 0 = fine, TREND_LEVELS - 1 = coarsest
+ * @param model Model
+ * @param fit Output
+ * @return true if the level holds at least TREND_MIN_POINTS points
+ */
+bool trend_fit(const trend_t *t, uint8_t level, trend_model_t model, trend_fit_t *fit);
+
+/**
+ * Estimate how long until a fit reaches a threshold (rising metrics)
+ * @param fit Fit from trend_fit()
+ * @param threshold Threshold, in the metric's units
+ * @return Points until the threshold; 0 if already reached, INFINITY if
+ *         the fit is not rising
+ */
+float trend_points_to(const trend_fit_t *fit, float threshold);
+
+/**
+ * Estimate time to a threshold from the best fit available
+ * Uses the coarsest level with enough points (falling back to finer ones
+ * when its fits are poor) and, within a level, the model with the higher
+ * r2. When no fit reaches min_r2 the metric is taken as steady. Times
+ * count from the newest point pushed: a coarse fit ends at the midpoint
+ * of its newest block, so its lag behind that point is subtracted.
+ * @param t Trend
+ * @param threshold Threshold, in the metric's units
+ * @param fine_period_s Spacing of fine points in seconds
+ * @param min_r2 Fits below this r2 are not used
+ * @return Seconds until the threshold; 0 if already reached, INFINITY if
+ *         not rising (or no significant trend), NAN before any level holds
+ *         TREND_MIN_POINTS points
+ */
+float trend_time_to(const trend_t *t, float threshold, float fine_period_s, float min_r2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREND_H
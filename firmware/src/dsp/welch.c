@@ -0,0 +1,153 @@
+/**
+ * VibeMon Welch PSD Implementation
+ * Memory is fixed at init: one circular segment of history, one FFT work
+ * buffer, the window and the averaged spectrum. Each hop costs one real
+ * FFT regardless of how the samples were batched by the caller.
+ */
+
+#include "welch.h"
+
+#include <string.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static void process_segment(welch_t *w) {
+    const uint16_t n = w->config.segment_len;
+    const uint16_t bins = n / 2;
+    
+    // Unroll the circular history, oldest sample first
+    const uint16_t first = n - w->write_pos;
+    memcpy(w->work, &w->history[w->write_pos], first * sizeof(float));
+    memcpy(w->work + first, w->history, w->write_pos * sizeof(float));
+    
+    // Remove the segment mean so gravity/offset stays out of the low bins
+    float mean = 0;
+    for (uint16_t i = 0; i < n; i++) {
+        mean += w->work[i];
+    }
+    mean /= n;
+    for (uint16_t i = 0; i < n; i++) {
+        w->work[i] -= mean;
+    }
+    
+    fft_window_apply_f32(&w->plan, w->work);
+    fft_real_f32(&w->plan, w->work);
+    
+    // Periodogram in place over the first n/2 floats (bin k reads 2k, 2k+1 >= k)
+    w->work[0] = w->work[0] * w->work[0] * w->psd_scale * 0.5f;
+    for (uint16_t k = 1; k < bins; k++) {
+        float re = w->work[2 * k];
+        float im = w->work[2 * k + 1];
+        w->work[k] = (re * re + im * im) * w->psd_scale;
+    }
+    
+    float weight;
+    if (w->segments == 0) {
+        weight = 1.0f;
+    } else if (w->config.averaging == WELCH_AVG_EXPONENTIAL) {
+        weight = w->config.alpha;
+    } else {
+        weight = 1.0f / (w->segments + 1);
+    }
+    
+    for (uint16_t k = 0; k < bins; k++) {
+        w->psd[k] += weight * (w->work[k] - w->psd[k]);
+    }
+    
+    w->segments++;
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool welch_init(welch_t *w, const welch_config_t *config, float *storage) {
+    if (!w || !config || !storage || config->sample_rate_hz <= 0) {
+        return false;
+    }
+    
+    if (config->averaging == WELCH_AVG_EXPONENTIAL &&
+        (config->alpha <= 0 || config->alpha > 1.0f)) {
+        return false;
+    }
+    
+    const uint16_t n = config->segment_len;
+    float *window = storage + 2 * n;
+    
+    if (!fft_plan_init(&w->plan, n, config->window, window, NULL)) {
+        return false;
+    }
+    
+    w->config = *config;
+    w->hop = (config->overlap == WELCH_OVERLAP_75) ? n / 4 : n / 2;
+    w->history = storage;
+    w->work = storage + n;
+    w->psd = storage + 3 * n;
+    
+    // One-sided density: 2 |X|^2 / (fs * sum(w^2)); DC is not doubled
+    w->psd_scale = 2.0f / (config->sample_rate_hz * n * w->plan.power_gain);
+    
+    welch_reset(w);
+    return true;
+}
+
+void welch_reset(welch_t *w) {
+    w->write_pos = 0;
+    w->filled = 0;
+    w->since_segment = 0;
+    w->segments = 0;
+    memset(w->psd, 0, (w->config.segment_len / 2) * sizeof(float));
+}
+
+uint32_t welch_push(welch_t *w, const float *samples, size_t count) {
+    const uint16_t n = w->config.segment_len;
+    uint32_t added = 0;
+    
+    while (count > 0) {
+        // Copy up to the next segment boundary or the end of the history
+        uint16_t need = (w->filled < n) ? n - w->filled : w->hop - w->since_segment;
+        uint16_t run = n - w->write_pos;
+        if (run > need) {
+            run = need;
+        }
+        if (run > count) {
+            run = (uint16_t)count;
+        }
+    
+        memcpy(&w->history[w->write_pos], samples, run * sizeof(float));
+        samples += run;
+        count -= run;
+    
+        w->write_pos = (w->write_pos + run) & (n - 1);
+        if (w->filled < n) {
+            w->filled += run;
+        } else {
+            w->since_segment += run;
+        }
+    
+        if (run == need) {
+            process_segment(w);
+            w->since_segment = 0;
+            added++;
+        }
+    }
+    
+    return added;
+}
+
+const float *welch_psd(const welch_t *w, uint16_t *bins) {
+    if (bins) {
+        *bins = w->config.segment_len / 2;
+    }
+    return w->psd;
+}
+
+uint32_t welch_segment_count(const welch_t *w) {
+    return w->segments;
+}
+
+float welch_bin_hz(const welch_t *w) {
+    return w->config.sample_rate_hz / w->config.segment_len;
+}
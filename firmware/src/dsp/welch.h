@@ -0,0 +1,122 @@
+/**
+ * VibeMon Welch PSD Header
+ * Streaming averaged power spectral density over overlapped, windowed
+ * segments. Samples are pushed as they arrive; each completed segment is
+ * transformed once and folded into the running average.
+ */
+
+#ifndef WELCH_H
+#define WELCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "fft.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Configuration
+// ===========================================
+
+// Floats of caller storage needed for a segment length n:
+// sample history (n) + FFT work (n) + window (n) + PSD (n/2)
+#define WELCH_STORAGE_SIZE(n)   (3 * (n) + (n) / 2)
+
+typedef enum {
+    WELCH_OVERLAP_50 = 0,       // Hop n/2
+    WELCH_OVERLAP_75,           // Hop n/4
+} welch_overlap_t;
+
+typedef enum {
+    WELCH_AVG_LINEAR = 0,       // Equal weight for every segment since reset
+    WELCH_AVG_EXPONENTIAL,      // Newest segment weighted by alpha
+} welch_averaging_t;
+
+typedef struct {
+    uint16_t segment_len;       // FFT length (power of two)
+    welch_overlap_t overlap;
+    welch_averaging_t averaging;
+    float alpha;                // Exponential weight (0 < alpha <= 1)
+    fft_window_t window;
+    float sample_rate_hz;
+} welch_config_t;
+
+// ===========================================
+// Estimator State
+// ===========================================
+typedef struct {
+    welch_config_t config;
+    fft_plan_t plan;
+    uint16_t hop;
+    
+    // Sample history, circular over one segment
+    float *history;
+    uint16_t write_pos;
+    uint16_t filled;            // Valid samples in history (<= segment_len)
+    uint16_t since_segment;     // Samples pushed since the last segment
+    
+    float *work;                // FFT scratch
+    float *psd;                 // Averaged one-sided PSD, segment_len/2 bins
+    float psd_scale;            // |X|^2 -> units^2/Hz
+    uint32_t segments;          // Segments averaged since reset
+} welch_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Initialize an estimator over caller-provided storage
+ * @param w Estimator
+ * @param config Segment, overlap and averaging settings
+ * @param storage WELCH_STORAGE_SIZE(config->segment_len) floats
+ * @return true on success, false on invalid configuration
+ */
+bool welch_init(welch_t *w, const welch_config_t *config, float *storage);
+
+/**
+ * Discard sample history and the accumulated average
+ * @param w Estimator
+ */
+void welch_reset(welch_t *w);
+
+/**
+ * Append samples, transforming every segment completed along the way
+ * @param w Estimator
+ * @param samples Input samples
+ * @param count Number of samples
+ * @return Number of segments added to the average
+ */
+uint32_t welch_push(welch_t *w, const float *samples, size_t count);
+
+/**
+ * Get the averaged PSD
+ * @param w Estimator
+ * @param bins Optional output, number of bins (segment_len / 2)
+ * @return PSD in units^2/Hz, bin k at k * welch_bin_hz(); valid once
+ *         welch_segment_count() > 0
+ */
+const float *welch_psd(const welch_t *w, uint16_t *bins);
+
+/**
+ * Get number of segments averaged since reset
+ * @param w Estimator
+ * @return Segment count
+ */
+uint32_t welch_segment_count(const welch_t *w);
+
+/**
+ * Get frequency resolution
+ * @param w Estimator
+ * @return Bin spacing in Hz
+ */
+float welch_bin_hz(const welch_t *w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WELCH_H
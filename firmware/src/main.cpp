@@ -17,6 +17,7 @@
 #include "config.h"
 #include "ble/ble_manager.h"
 #include "sensors/sensor_manager.h"
+#include "dsp/decimator.h"
 #include "power/power_manager.h"
 #include "storage/nvs_storage.h"
 #include "utils/led_indicator.h"
@@ -27,32 +28,327 @@ static const char *TAG = "VIBEMON_MAIN";
 static TaskHandle_t sensor_task_handle = NULL;
 static TaskHandle_t ble_task_handle = NULL;
 
+// Analysis records, built on the sensor task; the PSD is the largest
+static uint8_t analysis_buf[16 + 4 * (VIB_PSD_SEGMENT_MAX / 2 + 1)];
+static float analysis_psd[VIB_PSD_SEGMENT_MAX / 2 + 1];
+static vibration_stats_t analysis_stats;
+static envelope_stats_t analysis_env;
+static float decim_x[DECIMATOR_QUEUE_LEN];
+static float decim_y[DECIMATOR_QUEUE_LEN];
+static float decim_z[DECIMATOR_QUEUE_LEN];
+static TickType_t analysis_last = 0;
+
+/**
+ * Little-endian record fields (the ESP32 is little-endian)
+ */
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+    memcpy(p, &v, sizeof(v));
+    return p + sizeof(v);
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+    memcpy(p, &v, sizeof(v));
+    return p + sizeof(v);
+}
+
+static uint8_t *put_f32(uint8_t *p, float v) {
+    memcpy(p, &v, sizeof(v));
+    return p + sizeof(v);
+}
+
+static uint8_t *put_axis(uint8_t *p, const vibration_axis_stats_t *a) {
+    p = put_f32(p, a->rms);
+    p = put_f32(p, a->peak);
+    p = put_f32(p, a->crest_factor);
+    p = put_f32(p, a->peak_to_peak);
+    p = put_f32(p, a->skewness);
+    return put_f32(p, a->kurtosis);
+}
+
+static void analysis_send(uint8_t type, const uint8_t *end) {
+    ble_manager_send_analysis(type, analysis_buf, (uint16_t)(end - analysis_buf));
+}
+
+/**
+ * Publish the analysis results over BLE while a client is connected
+ * Rides the telemetry cadence, at most once per ANALYSIS_INTERVAL_MS.
+ * Runs on the sensor task, which owns the analysis state.
+ */
+static void analysis_publish(uint32_t timestamp) {
+    const TickType_t now = xTaskGetTickCount();
+    if (!ble_manager_is_connected() ||
+        now - analysis_last < pdMS_TO_TICKS(ANALYSIS_INTERVAL_MS)) {
+        return;
+    }
+    analysis_last = now;
+    
+    uint8_t *p;
+    
+    // Statistics and spectrum of the recent sample store
+    sensor_manager_calc_vibration_stats(sensor_manager_get_sample_store(), VIB_STORE_SIZE,
+                                        &analysis_stats);
+    p = put_u32(analysis_buf, timestamp);
+    p = put_f32(p, analysis_stats.rms);
+    p = put_f32(p, analysis_stats.peak);
+    p = put_f32(p, analysis_stats.crest_factor);
+    p = put_f32(p, analysis_stats.dominant_freq);
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        p = put_axis(p, &analysis_stats.axis[a]);
+        p = put_f32(p, analysis_stats.axis[a].dominant_freq);
+    }
+    *p++ = VIB_SPECTRUM_BINS;
+    for (int k = 0; k < VIB_SPECTRUM_BINS; k++) {
+        p = put_f32(p, analysis_stats.spectrum[k]);
+    }
+    analysis_send(BLE_ANALYSIS_VIBRATION, p);
+    
+    // Streaming short and long window statistics (raw acquisition only)
+    vibration_axis_stats_t window[VIB_AXIS_COUNT];
+    for (uint8_t w = 0; w < 2; w++) {
+        if (sensor_manager_get_window_stats(w == 1, window) != ESP_OK) {
+            continue;
+        }
+        p = put_u32(analysis_buf, timestamp);
+        *p++ = w;
+        for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+            p = put_axis(p, &window[a]);
+        }
+        analysis_send(BLE_ANALYSIS_WINDOW, p);
+    }
+    
+    // Averaged PSD
+    float bin_hz = 0;
+    uint32_t segments = 0;
+    size_t bins = sensor_manager_get_psd(analysis_psd, sizeof(analysis_psd) / sizeof(float),
+                                         &bin_hz, &segments);
+    if (bins > 0) {
+        p = put_u32(analysis_buf, timestamp);
+        p = put_f32(p, bin_hz);
+        p = put_u32(p, segments);
+        p = put_u16(p, (uint16_t)bins);
+        for (size_t k = 0; k < bins; k++) {
+            p = put_f32(p, analysis_psd[k]);
+        }
+        analysis_send(BLE_ANALYSIS_PSD, p);
+    }
+    
+    // Slowest decimated stream in mg; faster stages are not sent
+    const uint8_t stage = VIB_DECIM_STAGES - 1;
+    for (uint8_t s = 0; s < stage; s++) {
+        sensor_manager_read_decimated(s, NULL, NULL, NULL, DECIMATOR_QUEUE_LEN);
+    }
+    size_t count = sensor_manager_read_decimated(stage, decim_x, decim_y, decim_z,
+                                                 DECIMATOR_QUEUE_LEN);
+    if (count > 0) {
+        p = put_u32(analysis_buf, timestamp);
+        p = put_f32(p, sensor_manager_get_decimated_rate_hz(stage));
+        p = put_u16(p, (uint16_t)count);
+        for (size_t i = 0; i < count; i++) {
+            p = put_u16(p, (uint16_t)(int16_t)(decim_x[i] * 1000));
+            p = put_u16(p, (uint16_t)(int16_t)(decim_y[i] * 1000));
+            p = put_u16(p, (uint16_t)(int16_t)(decim_z[i] * 1000));
+        }
+        analysis_send(BLE_ANALYSIS_DECIMATED, p);
+    }
+    
+    // Envelope spectrum with the bearing defect lines
+    if (sensor_manager_get_envelope(&analysis_env) == ESP_OK) {
+        p = put_u32(analysis_buf, timestamp);
+        p = put_f32(p, analysis_env.envelope_rms);
+        p = put_f32(p, analysis_env.dominant_freq);
+        p = put_f32(p, analysis_env.resolution_hz);
+        for (int i = 0; i < VIB_BEARING_TARGETS; i++) {
+            p = put_f32(p, analysis_env.bearing_freq_hz[i]);
+            p = put_f32(p, analysis_env.bearing_amplitude[i]);
+        }
+        *p++ = VIB_SPECTRUM_BINS;
+        for (int k = 0; k < VIB_SPECTRUM_BINS; k++) {
+            p = put_f32(p, analysis_env.spectrum[k]);
+        }
+        analysis_send(BLE_ANALYSIS_ENVELOPE, p);
+    }
+    
+    // Amplitudes at the machine's fault frequencies, evaluated targets only
+    fault_amplitudes_t faults;
+    if (sensor_manager_get_fault_amplitudes(&faults) == ESP_OK) {
+        p = put_u32(analysis_buf, timestamp);
+        p = put_u16(p, faults.valid_mask);
+        for (int t = 0; t < FAULT_TARGET_COUNT; t++) {
+            if (faults.valid_mask & (1u << t)) {
+                p = put_f32(p, faults.freq_hz[t]);
+                p = put_f32(p, faults.amplitude[t]);
+            }
+        }
+        analysis_send(BLE_ANALYSIS_FAULTS, p);
+    }
+}
+
+/**
+ * Publish one telemetry sample
+ */
+static void sensor_publish(sensor_data_t *data) {
+    // Debounced alert levels; flags carry the levels, events the changes
+    alert_event_t events[ALERT_METRIC_COUNT];
+    size_t changes = sensor_manager_update_alerts(data, events, ALERT_METRIC_COUNT);
+    
+    // Queue data for BLE transmission
+    ble_manager_queue_data(data);
+    
+    // Store in local buffer if not connected; alert changes are always kept
+    if (!ble_manager_is_connected() || changes > 0) {
+        nvs_storage_buffer_data(data);
+    }
+    
+    analysis_publish(data->timestamp);
+}
+
+/**
+ * Decode a little-endian float from a command payload
+ */
+static float read_f32_le(const uint8_t *p) {
+    float v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/**
+ * Handle control service commands
+ * Runs in the BLE stack context; only hands data to thread-safe setters.
+ */
+static void ble_event_handler(ble_event_t *event) {
+    if (event->type != BLE_EVENT_COMMAND || event->data.len == 0) {
+        return;
+    }
+    
+    const uint8_t *p = event->data.data;
+    
+    switch (p[0]) {
+        case BLE_CMD_MACHINE_PROFILE: {
+            if (event->data.len < BLE_CMD_MACHINE_PROFILE_LEN) {
+                ESP_LOGW(TAG, "Machine profile too short (%d bytes)", event->data.len);
+                break;
+            }
+            
+            machine_profile_t profile = {};
+            profile.shaft_rpm = read_f32_le(&p[1]);
+            profile.line_hz = read_f32_le(&p[5]);
+            profile.rolling_elements = p[9];
+            profile.ball_diameter_mm = read_f32_le(&p[10]);
+            profile.pitch_diameter_mm = read_f32_le(&p[14]);
+            profile.contact_angle_deg = read_f32_le(&p[18]);
+            
+            if (sensor_manager_set_machine_profile(&profile) == ESP_OK) {
+                ESP_LOGI(TAG, "Machine profile: %.0f rpm, %d elements",
+                         profile.shaft_rpm, profile.rolling_elements);
+            }
+            break;
+        }
+        
+        default:
+            ESP_LOGW(TAG, "Unknown command 0x%02x", p[0]);
+            break;
+    }
+}
+
+// Converted raw batches, kept off the task stack
+static float raw_x[RAW_DRAIN_BATCH];
+static float raw_y[RAW_DRAIN_BATCH];
+static float raw_z[RAW_DRAIN_BATCH];
+
+/**
+ * Drain the accelerometer FIFOs and feed every sample to the analysis
+ * chain (PSD, envelope, fault bank, decimators, window stats, trend)
+ * Read errors are counted in the device status.
+ * @return Primary-sensor samples acquired
+ */
+static size_t sensor_drain(void) {
+    size_t added = 0;
+    sensor_manager_acquire_raw(&added);
+    
+    for (uint8_t s = 0; s < sensor_manager_get_accel_count(); s++) {
+        while (sensor_manager_read_raw_float(s, raw_x, raw_y, raw_z, RAW_DRAIN_BATCH) > 0) {
+        }
+    }
+    
+    return added;
+}
+
 /**
  * Sensor reading task
- * Periodically reads vibration and temperature data
+ * Drains the MPU6050 FIFOs in bursts every RAW_DRAIN_INTERVAL_MS and
+ * publishes telemetry at the configured sample interval, counted in
+ * sensor samples. Without the FIFO it runs on the data-ready interrupt,
+ * and falls back to timed polling if that cannot be enabled either.
  */
 void sensor_task(void *pvParameters) {
     ESP_LOGI(TAG, "Sensor task started");
     
     sensor_data_t data;
     
-    while (1) {
-        // Read sensors
-        if (sensor_manager_read(&data) == ESP_OK) {
-            // Check thresholds and generate alerts if needed
-            sensor_manager_check_thresholds(&data);
+    if (sensor_manager_start_raw_acquisition() == ESP_OK) {
+        const uint32_t rate_hz = sensor_manager_get_sample_rate_hz();
+        uint32_t samples_since_publish = 0;
+        TickType_t wake = xTaskGetTickCount();
+        
+        while (1) {
+            vTaskDelayUntil(&wake, pdMS_TO_TICKS(RAW_DRAIN_INTERVAL_MS));
+            samples_since_publish += sensor_drain();
             
-            // Queue data for BLE transmission
-            ble_manager_queue_data(&data);
+            uint32_t samples_per_publish = config_get_sample_interval() * rate_hz / 1000;
+            if (samples_per_publish == 0) {
+                samples_per_publish = 1;
+            }
             
-            // Store in local buffer if not connected
-            if (!ble_manager_is_connected()) {
-                nvs_storage_buffer_data(&data);
+            if (samples_since_publish >= samples_per_publish) {
+                samples_since_publish = 0;
+                if (sensor_manager_read(&data) == ESP_OK) {
+                    sensor_publish(&data);
+                }
+            }
+        }
+    }
+    
+    ESP_LOGW(TAG, "Raw acquisition unavailable, sampling per data-ready edge");
+    
+    if (sensor_manager_enable_data_ready() != ESP_OK) {
+        ESP_LOGW(TAG, "Data-ready interrupt unavailable, using timed polling");
+        
+        while (1) {
+            // Read sensors
+            if (sensor_manager_read(&data) == ESP_OK) {
+                sensor_publish(&data);
             }
+            
+            // Delay based on configured sample rate
+            vTaskDelay(pdMS_TO_TICKS(config_get_sample_interval()));
+        }
+    }
+    
+    const uint32_t rate_hz = sensor_manager_get_sample_rate_hz();
+    const uint32_t timeout_ms = 2000 / rate_hz + 10;
+    uint32_t samples_since_publish = 0;
+    
+    while (1) {
+        if (sensor_manager_wait_data_ready(timeout_ms) != ESP_OK) {
+            ESP_LOGW(TAG, "Data-ready timeout");
+            continue;
+        }
+        
+        // Telemetry cadence is derived from the sensor clock, not the tick
+        uint32_t samples_per_publish = config_get_sample_interval() * rate_hz / 1000;
+        if (samples_per_publish == 0) {
+            samples_per_publish = 1;
         }
         
-        // Delay based on configured sample rate
-        vTaskDelay(pdMS_TO_TICKS(config_get_sample_interval()));
+        if (++samples_since_publish >= samples_per_publish) {
+            samples_since_publish = 0;
+            if (sensor_manager_read(&data) == ESP_OK) {
+                sensor_publish(&data);
+            }
+        } else {
+            // Keep vibration processing on every sample
+            sensor_manager_read_vibration(&data);
+        }
     }
 }
 
@@ -116,6 +412,7 @@ esp_err_t system_init(void) {
         led_indicator_set_state(LED_STATE_ERROR);
         return ret;
     }
+    ble_manager_register_callback(ble_event_handler);
     
     ESP_LOGI(TAG, "System initialization complete!");
     return ESP_OK;
@@ -167,6 +464,9 @@ void app_main(void) {
         // Check for sleep conditions
         power_manager_check_sleep();
         
+        // Persist background calibration off the sampling path
+        sensor_manager_save_calibration();
+        
         // Delay
         vTaskDelay(pdMS_TO_TICKS(1000));
     }
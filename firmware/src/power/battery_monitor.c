@@ -0,0 +1,173 @@
+/**
+ * VibeMon Battery Monitor Implementation
+ * An esp_timer takes a short ADC burst every BATTERY_SAMPLE_INTERVAL_MS and
+ * updates an EWMA voltage; state of charge is looked up from a LiPo
+ * discharge curve at the same time, so readers only copy cached values.
+ */
+
+#include "battery_monitor.h"
+#include "../config.h"
+
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/adc.h"
+#include "esp_adc_cal.h"
+
+static const char *TAG = "BATTERY";
+
+// ===========================================
+// Constants
+// ===========================================
+#define BATTERY_BURST_SAMPLES   8       // Per timer tick
+#define BATTERY_SEED_SAMPLES    64      // Initial measurement
+#define BATTERY_EWMA_ALPHA      0.1f    // ~10 s time constant at 1 Hz
+#define BATTERY_VOLTAGE_DIVIDER 2.0f    // Voltage divider ratio
+
+// Typical single-cell LiPo resting voltage vs. state of charge
+typedef struct {
+    float voltage;
+    uint8_t percent;
+} lipo_point_t;
+
+static const lipo_point_t lipo_curve[] = {
+    { 3.27f,   0 }, { 3.61f,   5 }, { 3.69f,  10 }, { 3.71f,  15 },
+    { 3.73f,  20 }, { 3.75f,  25 }, { 3.77f,  30 }, { 3.79f,  35 },
+    { 3.80f,  40 }, { 3.82f,  45 }, { 3.84f,  50 }, { 3.85f,  55 },
+    { 3.87f,  60 }, { 3.91f,  65 }, { 3.95f,  70 }, { 3.98f,  75 },
+    { 4.02f,  80 }, { 4.08f,  85 }, { 4.11f,  90 }, { 4.15f,  95 },
+    { 4.20f, 100 },
+};
+
+#define LIPO_CURVE_POINTS (sizeof(lipo_curve) / sizeof(lipo_curve[0]))
+
+// ===========================================
+// Private Variables
+// ===========================================
+static bool running = false;
+static esp_adc_cal_characteristics_t adc_chars;
+static esp_timer_handle_t sample_timer = NULL;
+static portMUX_TYPE state_mux = portMUX_INITIALIZER_UNLOCKED;
+static float filtered_voltage = 0.0f;
+static uint8_t cached_level = 0;
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static float measure_voltage(int samples) {
+    uint32_t adc_reading = 0;
+    
+    for (int i = 0; i < samples; i++) {
+        adc_reading += adc1_get_raw(BATTERY_ADC_CHANNEL);
+    }
+    adc_reading /= samples;
+    
+    uint32_t voltage_mv = esp_adc_cal_raw_to_voltage(adc_reading, &adc_chars);
+    
+    // Apply voltage divider correction
+    return (voltage_mv / 1000.0f) * BATTERY_VOLTAGE_DIVIDER;
+}
+
+static void publish(float voltage) {
+    uint8_t level = battery_monitor_voltage_to_percent(voltage);
+    
+    portENTER_CRITICAL(&state_mux);
+    filtered_voltage = voltage;
+    cached_level = level;
+    portEXIT_CRITICAL(&state_mux);
+}
+
+static void sample_timer_cb(void *arg) {
+    (void)arg;
+    
+    float v = measure_voltage(BATTERY_BURST_SAMPLES);
+    publish(filtered_voltage + BATTERY_EWMA_ALPHA * (v - filtered_voltage));
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+esp_err_t battery_monitor_init(void) {
+    if (running) {
+        return ESP_OK;
+    }
+    
+    // Configure ADC
+    adc1_config_width(ADC_WIDTH_BIT_12);
+    adc1_config_channel_atten(BATTERY_ADC_CHANNEL, BATTERY_ADC_ATTEN);
+    
+    // Characterize ADC
+    esp_adc_cal_characterize(ADC_UNIT_1, BATTERY_ADC_ATTEN,
+                             ADC_WIDTH_BIT_12, 1100, &adc_chars);
+    
+    // Seed the filter so the first reads are meaningful
+    publish(measure_voltage(BATTERY_SEED_SAMPLES));
+    
+    const esp_timer_create_args_t timer_args = {
+        .callback = sample_timer_cb,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "battery",
+        .skip_unhandled_events = true,
+    };
+    
+    esp_err_t ret = esp_timer_create(&timer_args, &sample_timer);
+    if (ret != ESP_OK) return ret;
+    
+    ret = esp_timer_start_periodic(sample_timer, (uint64_t)BATTERY_SAMPLE_INTERVAL_MS * 1000);
+    if (ret != ESP_OK) {
+        esp_timer_delete(sample_timer);
+        sample_timer = NULL;
+        return ret;
+    }
+    
+    running = true;
+    ESP_LOGI(TAG, "Battery monitor started (%.2f V, %d%%)", filtered_voltage, cached_level);
+    
+    return ESP_OK;
+}
+
+esp_err_t battery_monitor_deinit(void) {
+    if (!running) {
+        return ESP_OK;
+    }
+    
+    esp_timer_stop(sample_timer);
+    esp_timer_delete(sample_timer);
+    sample_timer = NULL;
+    running = false;
+    
+    return ESP_OK;
+}
+
+esp_err_t battery_monitor_get(float *voltage, uint8_t *level) {
+    if (!running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    portENTER_CRITICAL(&state_mux);
+    if (voltage) *voltage = filtered_voltage;
+    if (level) *level = cached_level;
+    portEXIT_CRITICAL(&state_mux);
+    
+    return ESP_OK;
+}
+
+uint8_t battery_monitor_voltage_to_percent(float voltage) {
+    if (voltage <= lipo_curve[0].voltage) return 0;
+    if (voltage >= lipo_curve[LIPO_CURVE_POINTS - 1].voltage) return 100;
+    
+    // Piecewise-linear between curve points
+    for (size_t i = 1; i < LIPO_CURVE_POINTS; i++) {
+        if (voltage < lipo_curve[i].voltage) {
+            const lipo_point_t *lo = &lipo_curve[i - 1];
+            const lipo_point_t *hi = &lipo_curve[i];
+            float t = (voltage - lo->voltage) / (hi->voltage - lo->voltage);
+            return (uint8_t)(lo->percent + t * (hi->percent - lo->percent));
+        }
+    }
+    
+    return 100;
+}
@@ -0,0 +1,49 @@
+/**
+ * VibeMon Battery Monitor Header
+ * Low-rate background battery sampling with cached, filtered results
+ */
+
+#ifndef BATTERY_MONITOR_H
+#define BATTERY_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initialize battery ADC and start periodic sampling
+ * Takes one seeded measurement so values are valid on return.
+ * @return ESP_OK on success
+ */
+esp_err_t battery_monitor_init(void);
+
+/**
+ * Stop periodic sampling
+ * @return ESP_OK on success
+ */
+esp_err_t battery_monitor_deinit(void);
+
+/**
+ * Get cached battery state (no ADC access)
+ * @param voltage Optional output for filtered voltage (V)
+ * @param level Optional output for state of charge (0-100%)
+ * @return ESP_OK if the monitor is running
+ */
+esp_err_t battery_monitor_get(float *voltage, uint8_t *level);
+
+/**
+ * Convert LiPo resting voltage to state of charge
+ * @param voltage Cell voltage (V)
+ * @return State of charge (0-100%)
+ */
+uint8_t battery_monitor_voltage_to_percent(float voltage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BATTERY_MONITOR_H
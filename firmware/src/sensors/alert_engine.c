@@ -0,0 +1,177 @@
+/**
+ * VibeMon Alert Engine Implementation
+ */
+
+#include "alert_engine.h"
+#include "sensor_types.h"
+
+#include <math.h>
+#include <string.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+/**
+ * Level a value points to, given the current level
+ * Limits are entered at the limit and left only below limit - hysteresis.
+ */
+static alert_level_t classify(const alert_limits_t *limits, alert_level_t level, float value) {
+    float v = value;
+    float warning = limits->warning;
+    float critical = limits->critical;
+    
+    // Mirror falling metrics so larger is always worse
+    if (limits->falling) {
+        v = -v;
+        warning = -warning;
+        critical = -critical;
+    }
+    
+    if (v >= critical || (level == ALERT_LEVEL_CRITICAL && v > critical - limits->hysteresis)) {
+        return ALERT_LEVEL_CRITICAL;
+    }
+    if (v >= warning || (level != ALERT_LEVEL_NORMAL && v > warning - limits->hysteresis)) {
+        return ALERT_LEVEL_WARNING;
+    }
+    return ALERT_LEVEL_NORMAL;
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+void alert_engine_reset(alert_engine_t *engine) {
+    memset(engine, 0, sizeof(*engine));
+}
+
+bool alert_engine_set_limits(alert_engine_t *engine, alert_metric_t metric,
+                             const alert_limits_t *limits) {
+    if (!engine || !limits || metric >= ALERT_METRIC_COUNT) {
+        return false;
+    }
+    
+    if (!isfinite(limits->warning) || !isfinite(limits->critical) ||
+        !isfinite(limits->hysteresis) || limits->hysteresis < 0) {
+        return false;
+    }
+    
+    if (limits->falling ? (limits->critical > limits->warning)
+                        : (limits->critical < limits->warning)) {
+        return false;
+    }
+    
+    alert_channel_t *ch = &engine->channel[metric];
+    ch->limits = *limits;
+    ch->enabled = true;
+    
+    return true;
+}
+
+bool alert_engine_update(alert_engine_t *engine, alert_metric_t metric,
+                         float value, uint32_t now_ms, alert_event_t *event) {
+    alert_channel_t *ch = &engine->channel[metric];
+    if (!ch->enabled || !isfinite(value)) {
+        return false;
+    }
+    
+    const alert_level_t target = classify(&ch->limits, ch->level, value);
+    if (target == ch->level) {
+        ch->pending = ch->level;
+        return false;
+    }
+    
+    // The dwell restarts only when the value turns around; moving between
+    // warning and critical on the way up (or down) keeps the excursion
+    const bool raising = target > ch->level;
+    if (ch->pending == ch->level || (ch->pending > ch->level) != raising) {
+        ch->pending_since_ms = now_ms;
+    }
+    ch->pending = target;
+    
+    const uint32_t dwell = raising ? ch->limits.raise_dwell_ms : ch->limits.clear_dwell_ms;
+    if ((uint32_t)(now_ms - ch->pending_since_ms) < dwell) {
+        return false;
+    }
+    
+    if (event) {
+        event->metric = metric;
+        event->from = ch->level;
+        event->to = target;
+        event->value = value;
+        event->time_ms = now_ms;
+    }
+    ch->level = target;
+    
+    return true;
+}
+
+alert_level_t alert_engine_level(const alert_engine_t *engine, alert_metric_t metric) {
+    return engine->channel[metric].level;
+}
+
+uint8_t alert_engine_flags(const alert_engine_t *engine) {
+    uint8_t flags = ALERT_FLAG_NONE;
+    
+    switch (engine->channel[ALERT_METRIC_VIBRATION].level) {
+        case ALERT_LEVEL_CRITICAL: flags |= ALERT_FLAG_VIBRATION_CRIT; break;
+        case ALERT_LEVEL_WARNING:  flags |= ALERT_FLAG_VIBRATION_WARN; break;
+        default: break;
+    }
+    
+    switch (engine->channel[ALERT_METRIC_TEMPERATURE].level) {
+        case ALERT_LEVEL_CRITICAL: flags |= ALERT_FLAG_TEMP_CRIT; break;
+        case ALERT_LEVEL_WARNING:  flags |= ALERT_FLAG_TEMP_WARN; break;
+        default: break;
+    }
+    
+    if (engine->channel[ALERT_METRIC_BATTERY].level != ALERT_LEVEL_NORMAL) {
+        flags |= ALERT_FLAG_BATTERY_LOW;
+    }
+    
+    return flags;
+}
+
+const char *alert_metric_name(alert_metric_t metric) {
+    switch (metric) {
+        case ALERT_METRIC_VIBRATION:   return "vibration";
+        case ALERT_METRIC_TEMPERATURE: return "temperature";
+        case ALERT_METRIC_BATTERY:     return "battery";
+        default:                       return "?";
+    }
+}
+
+const char *alert_level_name(alert_level_t level) {
+    switch (level) {
+        case ALERT_LEVEL_NORMAL:   return "normal";
+        case ALERT_LEVEL_WARNING:  return "WARNING";
+        case ALERT_LEVEL_CRITICAL: return "CRITICAL";
+        default:                   return "?";
+    }
+}
+
+void alert_log_limiter_init(alert_log_limiter_t *limiter, uint16_t burst, uint32_t window_ms) {
+    memset(limiter, 0, sizeof(*limiter));
+    limiter->burst = burst;
+    limiter->window_ms = window_ms;
+}
+
+bool alert_log_allow(alert_log_limiter_t *limiter, uint32_t now_ms, uint32_t *suppressed) {
+    if ((uint32_t)(now_ms - limiter->window_start_ms) >= limiter->window_ms) {
+        limiter->window_start_ms = now_ms;
+        limiter->lines = 0;
+    }
+    
+    if (limiter->lines >= limiter->burst) {
+        limiter->suppressed++;
+        return false;
+    }
+    
+    limiter->lines++;
+    if (suppressed) {
+        *suppressed = limiter->suppressed;
+    }
+    limiter->suppressed = 0;
+    
+    return true;
+}
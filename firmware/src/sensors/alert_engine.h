@@ -0,0 +1,164 @@
+/**
+ * VibeMon Alert Engine Header
+ * Debounced warning/critical levels per metric. A level is entered only
+ * after the value has stayed beyond its limit for the raise dwell, and
+ * left only after it has stayed inside the hysteresis band for the clear
+ * dwell, so a value hovering near a limit produces no chatter. Level
+ * changes are reported once, as events.
+ */
+
+#ifndef ALERT_ENGINE_H
+#define ALERT_ENGINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Metrics and Levels
+// ===========================================
+typedef enum {
+    ALERT_METRIC_VIBRATION = 0,     // Dynamic acceleration (g)
+    ALERT_METRIC_TEMPERATURE,       // °C
+    ALERT_METRIC_BATTERY,           // Charge (%), low is bad
+    ALERT_METRIC_COUNT
+} alert_metric_t;
+
+typedef enum {
+    ALERT_LEVEL_NORMAL = 0,
+    ALERT_LEVEL_WARNING,
+    ALERT_LEVEL_CRITICAL
+} alert_level_t;
+
+// ===========================================
+// Limits
+// ===========================================
+// For rising metrics critical >= warning; for falling ones (falling set)
+// critical <= warning and the comparisons are mirrored.
+typedef struct {
+    float warning;
+    float critical;
+    float hysteresis;           // Clear band inside a limit, metric units (>= 0)
+    uint32_t raise_dwell_ms;    // Time beyond a limit before entering a level
+    uint32_t clear_dwell_ms;    // Time inside the band before leaving a level
+    bool falling;
+} alert_limits_t;
+
+// ===========================================
+// Events
+// ===========================================
+typedef struct {
+    alert_metric_t metric;
+    alert_level_t from;
+    alert_level_t to;
+    float value;                // Value that completed the dwell
+    uint32_t time_ms;
+} alert_event_t;
+
+// ===========================================
+// Engine State
+// ===========================================
+typedef struct {
+    alert_limits_t limits;
+    bool enabled;
+    alert_level_t level;        // Reported level
+    alert_level_t pending;      // Level the value currently points to
+    uint32_t pending_since_ms;  // Start of the excursion towards pending
+} alert_channel_t;
+
+typedef struct {
+    alert_channel_t channel[ALERT_METRIC_COUNT];
+} alert_engine_t;
+
+// Counter-based log limiter: at most burst lines per window
+typedef struct {
+    uint32_t window_start_ms;
+    uint16_t lines;
+    uint16_t burst;
+    uint32_t window_ms;
+    uint32_t suppressed;        // Lines dropped since the last one allowed
+} alert_log_limiter_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Reset all metrics to normal and disable them
+ * @param engine Engine
+ */
+void alert_engine_reset(alert_engine_t *engine);
+
+/**
+ * Set the limits of a metric and enable it
+ * The current level is kept; the new limits apply from the next update.
+ * @param engine Engine
+ * @param metric Metric
+ * @param limits Limits
+ * @return true on success, false if the limits are inconsistent
+ */
+bool alert_engine_set_limits(alert_engine_t *engine, alert_metric_t metric,
+                             const alert_limits_t *limits);
+
+/**
+ * Feed one value of a metric
+ * Non-finite values are ignored.
+ * @param engine Engine
+ * @param metric Metric
+ * @param value Current value
+ * @param now_ms Monotonic time (wraps)
+ * @param event Output, filled when the level changes (may be NULL)
+ * @return true if the level changed
+ */
+bool alert_engine_update(alert_engine_t *engine, alert_metric_t metric,
+                         float value, uint32_t now_ms, alert_event_t *event);
+
+/**
+ * Get the current level of a metric
+ * @param engine Engine
+ * @param metric Metric
+ * @return Debounced level
+ */
+alert_level_t alert_engine_level(const alert_engine_t *engine, alert_metric_t metric);
+
+/**
+ * Get the current levels as telemetry alert flags
+ * @param engine Engine
+ * @return ALERT_FLAG_* bits (battery warning and critical both map to
+ *         ALERT_FLAG_BATTERY_LOW)
+ */
+uint8_t alert_engine_flags(const alert_engine_t *engine);
+
+/**
+ * Get a short name for a metric or level (for logs)
+ */
+const char *alert_metric_name(alert_metric_t metric);
+const char *alert_level_name(alert_level_t level);
+
+/**
+ * Initialize a log limiter
+ * @param limiter Limiter
+ * @param burst Lines allowed per window
+ * @param window_ms Window length
+ */
+void alert_log_limiter_init(alert_log_limiter_t *limiter, uint16_t burst, uint32_t window_ms);
+
+/**
+ * Check whether a log line may be emitted now
+ * @param limiter Limiter
+ * @param now_ms Monotonic time (wraps)
+ * @param suppressed Output, lines dropped before this one (valid when
+ *                   true is returned, may be NULL)
+ * @return true if the line may be emitted
+ */
+bool alert_log_allow(alert_log_limiter_t *limiter, uint32_t now_ms, uint32_t *suppressed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ALERT_ENGINE_H
@@ -0,0 +1,128 @@
+/**
+ * VibeMon Background Calibration Estimator Implementation
+ * Per-block mean/variance; a block counts as stationary when every axis is
+ * quiet and gravity sits on +Z. Means of consecutive still blocks are
+ * averaged into the residual bias.
+ */
+
+#include "calibration_estimator.h"
+
+#include <string.h>
+#include <math.h>
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static void finish_block(calibration_estimator_t *est) {
+    const float n = (float)est->block_count;
+    const float accel_var_max = CAL_EST_ACCEL_STD_MAX_G * CAL_EST_ACCEL_STD_MAX_G;
+    const float gyro_var_max = CAL_EST_GYRO_STD_MAX_DPS * CAL_EST_GYRO_STD_MAX_DPS;
+    const bool has_gyro = (est->block_gyro_count == est->block_count);
+    const int axes = has_gyro ? 6 : 3;
+    
+    float mean[6];
+    bool still = true;
+    
+    for (int i = 0; i < axes; i++) {
+        mean[i] = est->sum[i] / n;
+        float var = est->sum_sq[i] / n - mean[i] * mean[i];
+        if (var > (i < 3 ? accel_var_max : gyro_var_max)) {
+            still = false;
+        }
+    }
+    
+    // Bias is only separable from gravity in the Z-up mounting
+    if (fabsf(mean[0]) > CAL_EST_ACCEL_RESIDUAL_MAX ||
+        fabsf(mean[1]) > CAL_EST_ACCEL_RESIDUAL_MAX ||
+        fabsf(mean[2] - 1.0f) > CAL_EST_ACCEL_RESIDUAL_MAX) {
+        still = false;
+    }
+    
+    if (!still) {
+        est->still_blocks = 0;
+        est->still_gyro_blocks = 0;
+        est->moving_blocks++;
+    } else {
+        // Running mean of block means
+        est->still_blocks++;
+        for (int i = 0; i < 3; i++) {
+            est->still_mean[i] += (mean[i] - est->still_mean[i]) / est->still_blocks;
+        }
+    
+        if (has_gyro) {
+            est->still_gyro_blocks++;
+            for (int i = 3; i < 6; i++) {
+                est->still_mean[i] += (mean[i] - est->still_mean[i]) / est->still_gyro_blocks;
+            }
+        } else {
+            est->still_gyro_blocks = 0;
+        }
+    }
+    
+    est->block_count = 0;
+    est->block_gyro_count = 0;
+    memset(est->sum, 0, sizeof(est->sum));
+    memset(est->sum_sq, 0, sizeof(est->sum_sq));
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+void calibration_estimator_reset(calibration_estimator_t *est) {
+    memset(est, 0, sizeof(*est));
+}
+
+bool calibration_estimator_add(calibration_estimator_t *est, float ax, float ay, float az,
+                               const float *gyro) {
+    est->sum[0] += ax;
+    est->sum[1] += ay;
+    est->sum[2] += az;
+    est->sum_sq[0] += ax * ax;
+    est->sum_sq[1] += ay * ay;
+    est->sum_sq[2] += az * az;
+    
+    if (gyro) {
+        for (int i = 0; i < 3; i++) {
+            est->sum[3 + i] += gyro[i];
+            est->sum_sq[3 + i] += gyro[i] * gyro[i];
+        }
+        est->block_gyro_count++;
+    }
+    
+    if (++est->block_count >= CAL_EST_BLOCK_SAMPLES) {
+        finish_block(est);
+    }
+    
+    return est->still_blocks >= CAL_EST_BLOCKS_REQUIRED;
+}
+
+bool calibration_estimator_add_block(calibration_estimator_t *est, const float *x,
+                                     const float *y, const float *z, size_t count) {
+    bool ready = est->still_blocks >= CAL_EST_BLOCKS_REQUIRED;
+    
+    for (size_t i = 0; i < count; i++) {
+        ready = calibration_estimator_add(est, x[i], y[i], z[i], NULL);
+    }
+    
+    return ready;
+}
+
+bool calibration_estimator_take(calibration_estimator_t *est, mpu6050_offsets_t *residual) {
+    if (est->still_blocks < CAL_EST_BLOCKS_REQUIRED) {
+        return false;
+    }
+    
+    residual->accel_x = est->still_mean[0];
+    residual->accel_y = est->still_mean[1];
+    residual->accel_z = est->still_mean[2] - 1.0f;  // Remove 1g gravity on Z
+    
+    bool gyro_ready = est->still_gyro_blocks >= CAL_EST_BLOCKS_REQUIRED;
+    residual->gyro_x = gyro_ready ? est->still_mean[3] : 0.0f;
+    residual->gyro_y = gyro_ready ? est->still_mean[4] : 0.0f;
+    residual->gyro_z = gyro_ready ? est->still_mean[5] : 0.0f;
+    
+    calibration_estimator_reset(est);
+    return true;
+}
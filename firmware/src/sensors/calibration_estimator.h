@@ -0,0 +1,88 @@
+/**
+ * VibeMon Background Calibration Estimator Header
+ * Streams live samples, detects stationary periods by variance and
+ * estimates the residual sensor bias without blocking the caller.
+ */
+
+#ifndef CALIBRATION_ESTIMATOR_H
+#define CALIBRATION_ESTIMATOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "mpu6050.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Configuration
+// ===========================================
+#define CAL_EST_BLOCK_SAMPLES       256     // Samples per variance block
+#define CAL_EST_BLOCKS_REQUIRED     8       // Consecutive still blocks to converge
+#define CAL_EST_ACCEL_STD_MAX_G     0.02f   // Per-axis std dev limit when still
+#define CAL_EST_GYRO_STD_MAX_DPS    0.5f    // Per-axis std dev limit when still
+#define CAL_EST_ACCEL_RESIDUAL_MAX  0.15f   // Reject block unless Z-up within this (g)
+
+// ===========================================
+// Estimator State
+// ===========================================
+// Input samples are already offset-corrected, so the result is the
+// correction to add to the current offsets (zero once calibrated).
+typedef struct {
+    // Current block
+    uint32_t block_count;
+    uint32_t block_gyro_count;
+    float sum[6];               // ax, ay, az, gx, gy, gz
+    float sum_sq[6];
+    
+    // Consecutive stationary blocks
+    uint32_t still_blocks;
+    uint32_t still_gyro_blocks;
+    float still_mean[6];
+    
+    // Diagnostics
+    uint32_t moving_blocks;
+} calibration_estimator_t;
+
+/**
+ * Reset estimator state
+ * @param est Estimator
+ */
+void calibration_estimator_reset(calibration_estimator_t *est);
+
+/**
+ * Add one offset-corrected sample
+ * @param est Estimator
+ * @param ax, ay, az Acceleration in g
+ * @param gyro Angular rate x/y/z in deg/s, or NULL when gyro is off
+ * @return true if a new residual estimate is ready
+ */
+bool calibration_estimator_add(calibration_estimator_t *est, float ax, float ay, float az,
+                               const float *gyro);
+
+/**
+ * Add a block of offset-corrected accelerometer samples
+ * @param est Estimator
+ * @param x, y, z Acceleration arrays in g
+ * @param count Number of samples
+ * @return true if a new residual estimate is ready
+ */
+bool calibration_estimator_add_block(calibration_estimator_t *est, const float *x,
+                                     const float *y, const float *z, size_t count);
+
+/**
+ * Take the converged residual and start a new estimate
+ * Gyro fields are zero unless every sample of the window carried gyro data.
+ * @param est Estimator
+ * @param residual Output correction to add to current offsets
+ * @return true if a converged estimate was available
+ */
+bool calibration_estimator_take(calibration_estimator_t *est, mpu6050_offsets_t *residual);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CALIBRATION_ESTIMATOR_H
@@ -1,9 +1,12 @@
 /**
  * VibeMon DS18B20 Temperature Sensor Implementation
  * OneWire driver for DS18B20 digital temperature sensor
+ * Conversions run as a start / poll / collect state machine so the 750 ms
+ * conversion time never blocks the caller.
  */
 
 #include "ds18b20.h"
+#include "onewire_rmt.h"
 #include "../config.h"
 
 #include <string.h>
@@ -43,10 +46,31 @@ static const char *TAG = "DS18B20";
 // ===========================================
 // Private Variables
 // ===========================================
+typedef struct {
+    uint8_t rom[8];
+    float latest_temp;
+    int64_t latest_us;
+    bool latest_valid;
+    esp_err_t last_error;
+} ds18b20_device_t;
+
 static bool initialized = false;
-static uint8_t rom_code[8] = {0};
+static bool use_rmt = false;    // RMT backend active, else bit-bang
+static ds18b20_device_t devices[DS18B20_MAX_DEVICES];
+static uint8_t device_count = 0;
 static uint8_t resolution = 12;  // Default 12-bit resolution
 
+// Results are stepped by the temperature task and read from any task
+static portMUX_TYPE result_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Conversion state machine
+static ds18b20_state_t state = DS18B20_STATE_IDLE;
+static int64_t conv_start_us = 0;
+static int64_t conv_ready_us = 0;
+static uint8_t collect_index = 0;     // Sensor being collected
+static uint8_t collect_step = 0;      // Bus operation within that sensor
+static uint8_t collect_buf[9];        // Scratchpad being read
+
 // ===========================================
 // Private Functions - OneWire Low Level
 // ===========================================
@@ -79,6 +103,11 @@ static int ow_read(void) {
 static bool ow_reset(void) {
     bool presence = false;
     
+    if (use_rmt) {
+        onewire_rmt_reset(&presence);
+        return presence;
+    }
+    
     // Pull low for reset pulse
     ow_set_output();
     ow_write_low();
@@ -100,6 +129,11 @@ static bool ow_reset(void) {
 }
 
 static void ow_write_bit(uint8_t bit) {
+    if (use_rmt) {
+        onewire_rmt_write_bits(bit, 1);
+        return;
+    }
+    
     ow_set_output();
     ow_write_low();
     
@@ -118,6 +152,11 @@ static void ow_write_bit(uint8_t bit) {
 static uint8_t ow_read_bit(void) {
     uint8_t bit = 0;
     
+    if (use_rmt) {
+        // Idle bus reads as 1
+        return onewire_rmt_read_bits(&bit, 1) == ESP_OK ? bit : 1;
+    }
+    
     ow_set_output();
     ow_write_low();
     ow_delay_us(OW_WRITE_1_LOW);
@@ -135,6 +174,11 @@ static uint8_t ow_read_bit(void) {
 }
 
 static void ow_write_byte(uint8_t byte) {
+    if (use_rmt) {
+        onewire_rmt_write_bits(byte, 8);
+        return;
+    }
+    
     for (int i = 0; i < 8; i++) {
         ow_write_bit(byte & 0x01);
         byte >>= 1;
@@ -144,6 +188,11 @@ static void ow_write_byte(uint8_t byte) {
 static uint8_t ow_read_byte(void) {
     uint8_t byte = 0;
     
+    if (use_rmt) {
+        // A failed transfer reads as an idle bus; CRC rejects it
+        return onewire_rmt_read_bits(&byte, 8) == ESP_OK ? byte : 0xFF;
+    }
+    
     for (int i = 0; i < 8; i++) {
         byte >>= 1;
         if (ow_read_bit()) {
@@ -157,22 +206,212 @@ static uint8_t ow_read_byte(void) {
 // ===========================================
 // CRC8 Calculation
 // ===========================================
+// Dallas/Maxim CRC8 (x^8 + x^5 + x^4 + 1, reflected 0x8C), one lookup per byte
+static const uint8_t crc8_table[256] = {
+    0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83,
+    0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41,
+    0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E,
+    0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC,
+    0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0,
+    0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62,
+    0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D,
+    0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF,
+    0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5,
+    0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07,
+    0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58,
+    0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A,
+    0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6,
+    0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24,
+    0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B,
+    0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9,
+    0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F,
+    0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD,
+    0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92,
+    0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50,
+    0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C,
+    0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE,
+    0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1,
+    0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73,
+    0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49,
+    0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B,
+    0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4,
+    0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16,
+    0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A,
+    0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8,
+    0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7,
+    0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35,
+};
+
 static uint8_t crc8(const uint8_t *data, uint8_t len) {
     uint8_t crc = 0;
     
     for (uint8_t i = 0; i < len; i++) {
-        uint8_t byte = data[i];
-        for (uint8_t j = 0; j < 8; j++) {
-            uint8_t mix = (crc ^ byte) & 0x01;
-            crc >>= 1;
-            if (mix) {
-                crc ^= 0x8C;
+        crc = crc8_table[crc ^ data[i]];
+    }
+    
+    return crc;
+}
+
+// ===========================================
+// ROM Search (Maxim AN187)
+// ===========================================
+// rom holds the previous result on entry and the next device on exit.
+// last_discrepancy starts at 0; search is complete when last_device is set.
+static bool ow_search_next(uint8_t *rom, int *last_discrepancy, bool *last_device) {
+    if (*last_device || !ow_reset()) {
+        return false;
+    }
+    
+    int last_zero = 0;
+    ow_write_byte(DS18B20_CMD_SEARCH_ROM);
+    
+    for (int bit = 1; bit <= 64; bit++) {
+        uint8_t *byte = &rom[(bit - 1) / 8];
+        uint8_t mask = 1 << ((bit - 1) % 8);
+        
+        uint8_t id_bit = ow_read_bit();
+        uint8_t cmp_bit = ow_read_bit();
+        
+        // No device answered
+        if (id_bit && cmp_bit) {
+            return false;
+        }
+        
+        uint8_t direction;
+        if (id_bit != cmp_bit) {
+            // All remaining devices agree on this bit
+            direction = id_bit;
+        } else {
+            // Discrepancy: repeat the previous path, branch to 1 at the
+            // last discrepancy, take 0 beyond it
+            if (bit < *last_discrepancy) {
+                direction = (*byte & mask) ? 1 : 0;
+            } else {
+                direction = (bit == *last_discrepancy) ? 1 : 0;
             }
-            byte >>= 1;
+            if (direction == 0) {
+                last_zero = bit;
+            }
+        }
+        
+        if (direction) {
+            *byte |= mask;
+        } else {
+            *byte &= ~mask;
         }
+        ow_write_bit(direction);
     }
     
-    return crc;
+    *last_discrepancy = last_zero;
+    if (last_zero == 0) {
+        *last_device = true;
+    }
+    
+    return true;
+}
+
+static void ow_match_rom(const uint8_t *rom) {
+    ow_write_byte(DS18B20_CMD_MATCH_ROM);
+    for (int i = 0; i < 8; i++) {
+        ow_write_byte(rom[i]);
+    }
+}
+
+// ===========================================
+// Private Functions - Conversion
+// ===========================================
+
+static uint32_t conversion_time_ms(void) {
+    switch (resolution) {
+        case 9:  return 94;
+        case 10: return 188;
+        case 11: return 375;
+        case 12:
+        default: return 750;
+    }
+}
+
+static esp_err_t scratchpad_temperature(const uint8_t *scratchpad, float *temperature) {
+    // Verify CRC
+    if (crc8(scratchpad, 8) != scratchpad[8]) {
+        ESP_LOGE(TAG, "Scratchpad CRC error");
+        return ESP_ERR_INVALID_CRC;
+    }
+    
+    // Calculate temperature
+    int16_t raw = (scratchpad[1] << 8) | scratchpad[0];
+    
+    // Handle negative temperatures
+    if (raw & 0x8000) {
+        raw = ~raw + 1;
+        *temperature = -(raw / 16.0f);
+    } else {
+        *temperature = raw / 16.0f;
+    }
+    
+    return ESP_OK;
+}
+
+static esp_err_t read_scratchpad_temperature(const ds18b20_device_t *dev, float *temperature) {
+    if (!ow_reset()) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    
+    ow_match_rom(dev->rom);
+    ow_write_byte(DS18B20_CMD_READ_SCRATCHPAD);
+    
+    uint8_t scratchpad[9];
+    for (int i = 0; i < 9; i++) {
+        scratchpad[i] = ow_read_byte();
+    }
+    
+    return scratchpad_temperature(scratchpad, temperature);
+}
+
+static void store_result(ds18b20_device_t *dev, esp_err_t ret, float temperature) {
+    int64_t now_us = esp_timer_get_time();
+    
+    portENTER_CRITICAL(&result_lock);
+    dev->last_error = ret;
+    if (ret == ESP_OK) {
+        dev->latest_temp = temperature;
+        dev->latest_us = now_us;
+        dev->latest_valid = true;
+    }
+    portEXIT_CRITICAL(&result_lock);
+}
+
+/**
+ * Perform the next bus operation of collecting devices[collect_index]
+ * Steps: reset, MATCH_ROM, 8 ROM bytes, READ_SCRATCHPAD, 9 scratchpad bytes.
+ * @return true once the device's result has been stored
+ */
+static bool collect_next(void) {
+    ds18b20_device_t *dev = &devices[collect_index];
+    const uint8_t step = collect_step++;
+    
+    if (step == 0) {
+        if (!ow_reset()) {
+            store_result(dev, ESP_ERR_NOT_FOUND, 0.0f);
+            return true;
+        }
+    } else if (step == 1) {
+        ow_write_byte(DS18B20_CMD_MATCH_ROM);
+    } else if (step < 10) {
+        ow_write_byte(dev->rom[step - 2]);
+    } else if (step == 10) {
+        ow_write_byte(DS18B20_CMD_READ_SCRATCHPAD);
+    } else {
+        collect_buf[step - 11] = ow_read_byte();
+        if (step == 19) {
+            float temperature = 0.0f;
+            esp_err_t ret = scratchpad_temperature(collect_buf, &temperature);
+            store_result(dev, ret, temperature);
+            return true;
+        }
+    }
+    
+    return false;
 }
 
 // ===========================================
@@ -182,15 +421,25 @@ static uint8_t crc8(const uint8_t *data, uint8_t len) {
 esp_err_t ds18b20_init(void) {
     ESP_LOGI(TAG, "Initializing DS18B20...");
     
-    // Configure GPIO
-    gpio_config_t io_conf = {
-        .pin_bit_mask = (1ULL << ONEWIRE_GPIO),
-        .mode = GPIO_MODE_INPUT,
-        .pull_up_en = GPIO_PULLUP_ENABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE
-    };
-    gpio_config(&io_conf);
+#if ONEWIRE_USE_RMT
+    use_rmt = (onewire_rmt_init(ONEWIRE_GPIO, ONEWIRE_RMT_TX_CHANNEL,
+                                ONEWIRE_RMT_RX_CHANNEL) == ESP_OK);
+    if (!use_rmt) {
+        ESP_LOGW(TAG, "RMT OneWire unavailable, using bit-bang");
+    }
+#endif
+    
+    if (!use_rmt) {
+        // Configure GPIO
+        gpio_config_t io_conf = {
+            .pin_bit_mask = (1ULL << ONEWIRE_GPIO),
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = GPIO_PULLUP_ENABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = GPIO_INTR_DISABLE
+        };
+        gpio_config(&io_conf);
+    }
     
     // Check for device presence
     if (!ow_reset()) {
@@ -198,41 +447,58 @@ esp_err_t ds18b20_init(void) {
         return ESP_ERR_NOT_FOUND;
     }
     
-    // Read ROM code
-    ow_reset();
-    ow_write_byte(DS18B20_CMD_READ_ROM);
+    // Enumerate every DS18B20 on the bus
+    uint8_t rom[8] = {0};
+    int last_discrepancy = 0;
+    bool last_device = false;
     
-    for (int i = 0; i < 8; i++) {
-        rom_code[i] = ow_read_byte();
-    }
+    memset(devices, 0, sizeof(devices));
+    device_count = 0;
     
-    // Verify CRC
-    if (crc8(rom_code, 7) != rom_code[7]) {
-        ESP_LOGE(TAG, "ROM CRC error");
-        return ESP_ERR_INVALID_CRC;
+    while (device_count < DS18B20_MAX_DEVICES &&
+           ow_search_next(rom, &last_discrepancy, &last_device)) {
+        if (crc8(rom, 7) != rom[7]) {
+            ESP_LOGE(TAG, "ROM CRC error");
+            continue;
+        }
+        
+        // Skip other OneWire families (0x28 is DS18B20)
+        if (rom[0] != 0x28) {
+            ESP_LOGW(TAG, "Ignoring device with family code 0x%02X", rom[0]);
+            continue;
+        }
+        
+        memcpy(devices[device_count].rom, rom, 8);
+        ESP_LOGI(TAG, "DS18B20 #%d found: %02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
+                 device_count, rom[0], rom[1], rom[2], rom[3],
+                 rom[4], rom[5], rom[6], rom[7]);
+        device_count++;
     }
     
-    // Verify family code (0x28 for DS18B20)
-    if (rom_code[0] != 0x28) {
-        ESP_LOGE(TAG, "Invalid family code: 0x%02X", rom_code[0]);
+    if (device_count == 0) {
+        ESP_LOGE(TAG, "No DS18B20 found on OneWire bus");
         return ESP_ERR_NOT_FOUND;
     }
     
-    ESP_LOGI(TAG, "DS18B20 found: %02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-             rom_code[0], rom_code[1], rom_code[2], rom_code[3],
-             rom_code[4], rom_code[5], rom_code[6], rom_code[7]);
-    
     // Set default resolution
     ds18b20_set_resolution(DS18B20_RESOLUTION);
     
     initialized = true;
-    ESP_LOGI(TAG, "DS18B20 initialized successfully");
+    ESP_LOGI(TAG, "DS18B20 initialized successfully (%d sensor(s))", device_count);
     
     return ESP_OK;
 }
 
 esp_err_t ds18b20_deinit(void) {
     initialized = false;
+    state = DS18B20_STATE_IDLE;
+    device_count = 0;
+    
+    if (use_rmt) {
+        onewire_rmt_deinit();
+        use_rmt = false;
+    }
+    
     return ESP_OK;
 }
 
@@ -245,57 +511,117 @@ esp_err_t ds18b20_read_temperature(float *temperature) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    // Start temperature conversion
-    if (!ow_reset()) {
-        return ESP_ERR_NOT_FOUND;
+    // Blocking path: start, sleep for the full conversion, collect all
+    esp_err_t ret = ds18b20_start_conversion();
+    if (ret != ESP_OK) {
+        return ret;
     }
     
-    ow_write_byte(DS18B20_CMD_SKIP_ROM);
-    ow_write_byte(DS18B20_CMD_CONVERT_T);
+    vTaskDelay(pdMS_TO_TICKS(conversion_time_ms()));
     
-    // Wait for conversion (depends on resolution)
-    uint16_t wait_ms;
-    switch (resolution) {
-        case 9:  wait_ms = 94; break;
-        case 10: wait_ms = 188; break;
-        case 11: wait_ms = 375; break;
-        case 12:
-        default: wait_ms = 750; break;
+    for (uint8_t i = 0; i < device_count; i++) {
+        float temp = 0.0f;
+        store_result(&devices[i], read_scratchpad_temperature(&devices[i], &temp), temp);
     }
+    state = DS18B20_STATE_IDLE;
     
-    vTaskDelay(pdMS_TO_TICKS(wait_ms));
+    portENTER_CRITICAL(&result_lock);
+    *temperature = devices[0].latest_temp;
+    ret = devices[0].last_error;
+    portEXIT_CRITICAL(&result_lock);
+    return ret;
+}
+
+esp_err_t ds18b20_start_conversion(void) {
+    if (!initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // Stamped before the attempt so a missing probe is retried only once
+    // per interval instead of costing a reset on every update
+    conv_start_us = esp_timer_get_time();
     
-    // Read scratchpad
     if (!ow_reset()) {
+        portENTER_CRITICAL(&result_lock);
+        for (uint8_t i = 0; i < device_count; i++) {
+            devices[i].last_error = ESP_ERR_NOT_FOUND;
+        }
+        portEXIT_CRITICAL(&result_lock);
         return ESP_ERR_NOT_FOUND;
     }
     
+    // Broadcast: every sensor converts in parallel
     ow_write_byte(DS18B20_CMD_SKIP_ROM);
-    ow_write_byte(DS18B20_CMD_READ_SCRATCHPAD);
+    ow_write_byte(DS18B20_CMD_CONVERT_T);
     
-    uint8_t scratchpad[9];
-    for (int i = 0; i < 9; i++) {
-        scratchpad[i] = ow_read_byte();
+    conv_ready_us = conv_start_us + (int64_t)conversion_time_ms() * 1000;
+    state = DS18B20_STATE_CONVERTING;
+    
+    return ESP_OK;
+}
+
+ds18b20_state_t ds18b20_update(void) {
+    if (!initialized) {
+        return DS18B20_STATE_IDLE;
     }
     
-    // Verify CRC
-    if (crc8(scratchpad, 8) != scratchpad[8]) {
-        ESP_LOGE(TAG, "Scratchpad CRC error");
-        return ESP_ERR_INVALID_CRC;
+    int64_t now = esp_timer_get_time();
+    
+    switch (state) {
+        case DS18B20_STATE_IDLE:
+            // Pace conversions; the first one starts immediately
+            if (conv_start_us == 0 ||
+                now - conv_start_us >= (int64_t)DS18B20_INTERVAL_MS * 1000) {
+                ds18b20_start_conversion();
+            }
+            break;
+            
+        case DS18B20_STATE_CONVERTING:
+            if (now >= conv_ready_us) {
+                collect_index = 0;
+                collect_step = 0;
+                state = DS18B20_STATE_COLLECTING;
+            }
+            break;
+            
+        case DS18B20_STATE_COLLECTING:
+            // One bus byte per step keeps each call short
+            if (collect_next()) {
+                if (++collect_index >= device_count) {
+                    state = DS18B20_STATE_IDLE;
+                }
+                collect_step = 0;
+            }
+            break;
     }
     
-    // Calculate temperature
-    int16_t raw = (scratchpad[1] << 8) | scratchpad[0];
+    return state;
+}
+
+esp_err_t ds18b20_get_latest(uint8_t index, float *temperature, uint32_t *age_ms) {
+    if (!temperature || index >= device_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
     
-    // Handle negative temperatures
-    if (raw & 0x8000) {
-        raw = ~raw + 1;
-        *temperature = -(raw / 16.0f);
-    } else {
-        *temperature = raw / 16.0f;
+    portENTER_CRITICAL(&result_lock);
+    ds18b20_device_t dev = devices[index];
+    portEXIT_CRITICAL(&result_lock);
+    
+    if (!dev.latest_valid) {
+        return dev.last_error != ESP_OK ? dev.last_error : ESP_ERR_INVALID_STATE;
     }
     
-    return ESP_OK;
+    *temperature = dev.latest_temp;
+    if (age_ms) {
+        *age_ms = (uint32_t)((esp_timer_get_time() - dev.latest_us) / 1000);
+    }
+    
+    // A failed collect after a good one keeps the old value but reports it
+    return dev.last_error;
+}
+
+uint8_t ds18b20_get_count(void) {
+    return device_count;
 }
 
 esp_err_t ds18b20_set_resolution(uint8_t res) {
@@ -328,16 +654,16 @@ esp_err_t ds18b20_set_resolution(uint8_t res) {
     return ESP_OK;
 }
 
-esp_err_t ds18b20_get_rom_code(uint8_t *rom) {
+esp_err_t ds18b20_get_rom_code(uint8_t index, uint8_t *rom) {
     if (!initialized) {
         return ESP_ERR_INVALID_STATE;
     }
     
-    if (!rom) {
+    if (!rom || index >= device_count) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    memcpy(rom, rom_code, 8);
+    memcpy(rom, devices[index].rom, 8);
     return ESP_OK;
 }
 
@@ -6,15 +6,27 @@
 #define DS18B20_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "esp_err.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Maximum sensors enumerated on the bus
+#define DS18B20_MAX_DEVICES     8
+
+// Conversion state machine
+typedef enum {
+    DS18B20_STATE_IDLE = 0,         // No conversion running
+    DS18B20_STATE_CONVERTING,       // CONVERT_T issued, waiting for completion
+    DS18B20_STATE_COLLECTING,       // Reading scratchpads one bus byte per step
+} ds18b20_state_t;
+
 /**
- * Initialize DS18B20 sensor
- * @return ESP_OK on success
+ * Initialize DS18B20 sensors
+ * Enumerates every DS18B20 on the bus with the OneWire ROM search.
+ * @return ESP_OK if at least one sensor was found
  */
 esp_err_t ds18b20_init(void);
 
@@ -25,12 +37,45 @@ esp_err_t ds18b20_init(void);
 esp_err_t ds18b20_deinit(void);
 
 /**
- * Read temperature from DS18B20
- * @param temperature Output for temperature in °C
+ * Convert and read all sensors (blocking, up to 750 ms)
+ * @param temperature Output for temperature of sensor 0 in °C
  * @return ESP_OK on success
  */
 esp_err_t ds18b20_read_temperature(float *temperature);
 
+/**
+ * Issue a broadcast CONVERT_T to all sensors and return immediately
+ * A failed attempt also counts as a start for ds18b20_update() pacing.
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND without a presence pulse
+ */
+esp_err_t ds18b20_start_conversion(void);
+
+/**
+ * Advance the conversion state machine (non-blocking)
+ * Starts a conversion every DS18B20_INTERVAL_MS and, once the conversion
+ * time has elapsed, collects the scratchpads one OneWire byte (or reset)
+ * per call, so no call holds the bus for more than about 0.8 ms. A
+ * missing probe is retried once per DS18B20_INTERVAL_MS. Call often.
+ * @return State after this step
+ */
+ds18b20_state_t ds18b20_update(void);
+
+/**
+ * Get the latest completed temperature of a sensor
+ * @param index Sensor index (0 .. ds18b20_get_count() - 1)
+ * @param temperature Output for temperature in °C
+ * @param age_ms Optional output for time since the reading completed
+ * @return ESP_OK if fresh, error of the last collect if it failed,
+ *         ESP_ERR_INVALID_STATE if no reading has completed yet
+ */
+esp_err_t ds18b20_get_latest(uint8_t index, float *temperature, uint32_t *age_ms);
+
+/**
+ * Get number of sensors found on the bus
+ * @return Sensor count
+ */
+uint8_t ds18b20_get_count(void);
+
 /**
  * Set temperature resolution
  * @param resolution Resolution in bits (9-12)
@@ -40,10 +85,11 @@ esp_err_t ds18b20_set_resolution(uint8_t resolution);
 
 /**
  * Get sensor ROM code (64-bit unique ID)
+ * @param index Sensor index
  * @param rom_code Output buffer (8 bytes)
  * @return ESP_OK on success
  */
-esp_err_t ds18b20_get_rom_code(uint8_t *rom_code);
+esp_err_t ds18b20_get_rom_code(uint8_t index, uint8_t *rom_code);
 
 /**
  * Check if sensor is connected
@@ -0,0 +1,328 @@
+/**
+ * VibeMon I2C Bus Implementation
+ * Register transactions built in static command links. Blocking calls run
+ * in the caller's context; async reads are executed by a per-port worker
+ * into a descriptor-owned buffer and copied out by the waiter, so a waiter
+ * that gives up never leaves the worker writing into its memory.
+ */
+
+#include "i2c_bus.h"
+
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+
+static const char *TAG = "I2C_BUS";
+
+// ===========================================
+// Constants
+// ===========================================
+// Longest transaction: START, addr+W, reg, RESTART, addr+R, read, STOP
+#define I2C_BUS_LINK_OPS        7
+#define I2C_BUS_LINK_SIZE       I2C_LINK_RECOMMENDED_SIZE(I2C_BUS_LINK_OPS)
+#define I2C_BUS_WORKER_STACK    2048
+#define I2C_BUS_WORKER_PRIO     10
+
+// ===========================================
+// Private Types
+// ===========================================
+struct i2c_bus_txn {
+    i2c_port_t port;
+    uint8_t addr;
+    uint8_t reg;
+    uint8_t *data;
+    size_t len;
+    esp_err_t result;
+    bool in_use;
+    bool completed;     // Worker finished; waiter still owns the descriptor
+    bool abandoned;     // Waiter timed out; worker releases the descriptor
+    uint8_t buf[I2C_BUS_MAX_READ];
+    uint8_t link[I2C_BUS_LINK_SIZE];
+    SemaphoreHandle_t done;
+    StaticSemaphore_t done_buf;
+};
+
+typedef struct {
+    bool initialized;
+    
+    // Blocking path
+    uint8_t link[I2C_BUS_LINK_SIZE];
+    SemaphoreHandle_t lock;
+    StaticSemaphore_t lock_buf;
+    
+    // Async path; the extra queue slot is for the shutdown marker
+    struct i2c_bus_txn txns[I2C_BUS_MAX_PENDING];
+    QueueHandle_t queue;
+    StaticQueue_t queue_buf;
+    uint8_t queue_storage[(I2C_BUS_MAX_PENDING + 1) * sizeof(struct i2c_bus_txn *)];
+    SemaphoreHandle_t drained;
+    StaticSemaphore_t drained_buf;
+    TaskHandle_t worker;
+    StaticTask_t worker_buf;
+    StackType_t worker_stack[I2C_BUS_WORKER_STACK];
+} i2c_bus_port_t;
+
+// ===========================================
+// Private Variables
+// ===========================================
+static i2c_bus_port_t ports[I2C_NUM_MAX];
+static portMUX_TYPE pool_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static TickType_t bus_timeout_ticks(void) {
+    TickType_t ticks = pdMS_TO_TICKS(I2C_BUS_TIMEOUT_MS);
+    return ticks > 0 ? ticks : 1;
+}
+
+static esp_err_t run_transaction(i2c_port_t port, uint8_t *link, uint8_t addr,
+                                 uint8_t reg, uint8_t *data, size_t len, bool read) {
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(link, I2C_BUS_LINK_SIZE);
+    if (!cmd) {
+        return ESP_ERR_NO_MEM;
+    }
+    
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (addr << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_write_byte(cmd, reg, true);
+    
+    if (read) {
+        i2c_master_start(cmd);
+        i2c_master_write_byte(cmd, (addr << 1) | I2C_MASTER_READ, true);
+        i2c_master_read(cmd, data, len, I2C_MASTER_LAST_NACK);
+    } else if (len > 0) {
+        i2c_master_write(cmd, data, len, true);
+    }
+    
+    i2c_master_stop(cmd);
+    
+    esp_err_t ret = i2c_master_cmd_begin(port, cmd, bus_timeout_ticks());
+    i2c_cmd_link_delete_static(cmd);
+    
+    return ret;
+}
+
+static void i2c_bus_worker(void *arg) {
+    i2c_bus_port_t *p = (i2c_bus_port_t *)arg;
+    struct i2c_bus_txn *txn;
+    
+    while (1) {
+        if (xQueueReceive(p->queue, &txn, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        
+        // Shutdown marker: everything queued before it has completed
+        if (!txn) {
+            xSemaphoreGive(p->drained);
+            continue;
+        }
+        
+        txn->result = run_transaction(txn->port, txn->link, txn->addr,
+                                      txn->reg, txn->buf, txn->len, true);
+        
+        // A waiter that timed out is gone; nobody will collect the result
+        portENTER_CRITICAL(&pool_mux);
+        const bool abandoned = txn->abandoned;
+        if (abandoned) {
+            txn->in_use = false;
+        } else {
+            txn->completed = true;
+        }
+        portEXIT_CRITICAL(&pool_mux);
+        
+        if (!abandoned) {
+            xSemaphoreGive(txn->done);
+        }
+    }
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+esp_err_t i2c_bus_init(i2c_port_t port, int sda_io, int scl_io, uint32_t freq_hz) {
+    if (port < 0 || port >= I2C_NUM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    i2c_bus_port_t *p = &ports[port];
+    if (p->initialized) {
+        return ESP_OK;
+    }
+    
+    i2c_config_t conf = {
+        .mode = I2C_MODE_MASTER,
+        .sda_io_num = sda_io,
+        .scl_io_num = scl_io,
+        .sda_pullup_en = GPIO_PULLUP_ENABLE,
+        .scl_pullup_en = GPIO_PULLUP_ENABLE,
+        .master.clk_speed = freq_hz,
+    };
+    
+    esp_err_t ret = i2c_param_config(port, &conf);
+    if (ret != ESP_OK) return ret;
+    
+    ret = i2c_driver_install(port, conf.mode, 0, 0, 0);
+    if (ret != ESP_OK) return ret;
+    
+    p->lock = xSemaphoreCreateMutexStatic(&p->lock_buf);
+    p->queue = xQueueCreateStatic(I2C_BUS_MAX_PENDING + 1, sizeof(struct i2c_bus_txn *),
+                                  p->queue_storage, &p->queue_buf);
+    p->drained = xSemaphoreCreateBinaryStatic(&p->drained_buf);
+    
+    for (int i = 0; i < I2C_BUS_MAX_PENDING; i++) {
+        p->txns[i].port = port;
+        p->txns[i].in_use = false;
+        p->txns[i].done = xSemaphoreCreateBinaryStatic(&p->txns[i].done_buf);
+    }
+    
+    p->worker = xTaskCreateStatic(i2c_bus_worker, "i2c_bus", I2C_BUS_WORKER_STACK,
+                                  p, I2C_BUS_WORKER_PRIO, p->worker_stack, &p->worker_buf);
+    
+    p->initialized = true;
+    ESP_LOGI(TAG, "I2C port %d initialized (%lu Hz)", port, (unsigned long)freq_hz);
+    
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_deinit(i2c_port_t port) {
+    if (port < 0 || port >= I2C_NUM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    i2c_bus_port_t *p = &ports[port];
+    if (!p->initialized) {
+        return ESP_OK;
+    }
+    
+    // Refuse new work, then let the worker finish what is queued and any
+    // blocking transaction complete before the driver goes away
+    p->initialized = false;
+    
+    struct i2c_bus_txn *marker = NULL;
+    xQueueSend(p->queue, &marker, portMAX_DELAY);
+    xSemaphoreTake(p->drained, portMAX_DELAY);
+    xSemaphoreTake(p->lock, portMAX_DELAY);
+    
+    vTaskDelete(p->worker);
+    i2c_driver_delete(port);
+    xSemaphoreGive(p->lock);
+    
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_write_reg(i2c_port_t port, uint8_t addr, uint8_t reg,
+                            const uint8_t *data, size_t len) {
+    if (port < 0 || port >= I2C_NUM_MAX || !ports[port].initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    i2c_bus_port_t *p = &ports[port];
+    xSemaphoreTake(p->lock, portMAX_DELAY);
+    esp_err_t ret = run_transaction(port, p->link, addr, reg, (uint8_t *)data, len, false);
+    xSemaphoreGive(p->lock);
+    
+    return ret;
+}
+
+esp_err_t i2c_bus_read_reg(i2c_port_t port, uint8_t addr, uint8_t reg,
+                           uint8_t *data, size_t len) {
+    if (port < 0 || port >= I2C_NUM_MAX || !ports[port].initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!data || len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    i2c_bus_port_t *p = &ports[port];
+    xSemaphoreTake(p->lock, portMAX_DELAY);
+    esp_err_t ret = run_transaction(port, p->link, addr, reg, data, len, true);
+    xSemaphoreGive(p->lock);
+    
+    return ret;
+}
+
+esp_err_t i2c_bus_submit_read(i2c_port_t port, uint8_t addr, uint8_t reg,
+                              uint8_t *data, size_t len, i2c_bus_txn_handle_t *txn) {
+    if (port < 0 || port >= I2C_NUM_MAX || !ports[port].initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!data || len == 0 || !txn) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (len > I2C_BUS_MAX_READ) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    
+    i2c_bus_port_t *p = &ports[port];
+    struct i2c_bus_txn *t = NULL;
+    
+    portENTER_CRITICAL(&pool_mux);
+    for (int i = 0; i < I2C_BUS_MAX_PENDING; i++) {
+        if (!p->txns[i].in_use) {
+            t = &p->txns[i];
+            t->in_use = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&pool_mux);
+    
+    if (!t) {
+        return ESP_ERR_NO_MEM;
+    }
+    
+    t->addr = addr;
+    t->reg = reg;
+    t->data = data;
+    t->len = len;
+    t->result = ESP_ERR_INVALID_STATE;
+    t->completed = false;
+    t->abandoned = false;
+    
+    // Queue has a slot per descriptor, so this never blocks
+    xQueueSend(p->queue, &t, 0);
+    *txn = t;
+    
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_wait(i2c_bus_txn_handle_t txn, uint32_t timeout_ms) {
+    if (!txn || !txn->in_use) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (xSemaphoreTake(txn->done, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+        // Hand the descriptor to the worker unless it finished meanwhile,
+        // in which case its done signal is already on the way
+        portENTER_CRITICAL(&pool_mux);
+        const bool completed = txn->completed;
+        if (!completed) {
+            txn->abandoned = true;
+        }
+        portEXIT_CRITICAL(&pool_mux);
+        
+        if (!completed) {
+            return ESP_ERR_TIMEOUT;
+        }
+        xSemaphoreTake(txn->done, portMAX_DELAY);
+    }
+    
+    esp_err_t ret = txn->result;
+    if (ret == ESP_OK) {
+        memcpy(txn->data, txn->buf, txn->len);
+    }
+    
+    portENTER_CRITICAL(&pool_mux);
+    txn->in_use = false;
+    portEXIT_CRITICAL(&pool_mux);
+    
+    return ret;
+}
@@ -0,0 +1,106 @@
+/**
+ * VibeMon I2C Bus Header
+ * Allocation-free I2C register transactions with an async submit/wait API
+ */
+
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "driver/i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Configuration
+// ===========================================
+#define I2C_BUS_MAX_PENDING     4       // Async descriptors per port
+#define I2C_BUS_TIMEOUT_MS      20      // Per-transaction bus timeout
+#define I2C_BUS_MAX_READ        256     // Largest async read
+
+// Opaque handle to a submitted transaction
+typedef struct i2c_bus_txn *i2c_bus_txn_handle_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Initialize I2C master port and its transaction worker
+ * All command links, descriptors, queue and worker stack are statically
+ * allocated, so no heap is used after this call.
+ * @param port I2C controller
+ * @param sda_io SDA GPIO
+ * @param scl_io SCL GPIO
+ * @param freq_hz Bus clock
+ * @return ESP_OK on success
+ */
+esp_err_t i2c_bus_init(i2c_port_t port, int sda_io, int scl_io, uint32_t freq_hz);
+
+/**
+ * Deinitialize I2C master port
+ * Blocks until queued async reads and any blocking transaction have
+ * finished, then stops the worker and removes the driver.
+ * @param port I2C controller
+ * @return ESP_OK on success
+ */
+esp_err_t i2c_bus_deinit(i2c_port_t port);
+
+/**
+ * Write bytes to consecutive device registers (blocking)
+ * @param port I2C controller
+ * @param addr 7-bit device address
+ * @param reg First register
+ * @param data Bytes to write
+ * @param len Number of bytes
+ * @return ESP_OK on success
+ */
+esp_err_t i2c_bus_write_reg(i2c_port_t port, uint8_t addr, uint8_t reg,
+                            const uint8_t *data, size_t len);
+
+/**
+ * Read bytes from consecutive device registers (blocking)
+ * @param port I2C controller
+ * @param addr 7-bit device address
+ * @param reg First register
+ * @param data Output buffer
+ * @param len Number of bytes
+ * @return ESP_OK on success
+ */
+esp_err_t i2c_bus_read_reg(i2c_port_t port, uint8_t addr, uint8_t reg,
+                           uint8_t *data, size_t len);
+
+/**
+ * Queue a register read and return immediately
+ * The bus is read into the descriptor; i2c_bus_wait() copies it to the
+ * buffer, so the buffer is not touched after a wait that timed out.
+ * @param port I2C controller
+ * @param addr 7-bit device address
+ * @param reg First register
+ * @param data Output buffer
+ * @param len Number of bytes (<= I2C_BUS_MAX_READ)
+ * @param txn Output transaction handle
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if all descriptors are in use
+ */
+esp_err_t i2c_bus_submit_read(i2c_port_t port, uint8_t addr, uint8_t reg,
+                              uint8_t *data, size_t len, i2c_bus_txn_handle_t *txn);
+
+/**
+ * Wait for a submitted transaction, copy out its data and release it
+ * On timeout the descriptor is abandoned: the worker releases it when the
+ * transaction ends and the handle must not be used again.
+ * @param txn Transaction handle from i2c_bus_submit_read()
+ * @param timeout_ms Maximum time to wait
+ * @return Transaction result, or ESP_ERR_TIMEOUT
+ */
+esp_err_t i2c_bus_wait(i2c_bus_txn_handle_t txn, uint32_t timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // I2C_BUS_H
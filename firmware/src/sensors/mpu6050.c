@@ -4,12 +4,11 @@
  */
 
 #include "mpu6050.h"
-#include "../config.h"
+#include "i2c_bus.h"
 
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "driver/i2c.h"
 #include "esp_log.h"
 
 static const char *TAG = "MPU6050";
@@ -46,144 +45,231 @@ static const char *TAG = "MPU6050";
 #define MPU6050_REG_USER_CTRL       0x6A
 #define MPU6050_REG_PWR_MGMT_1      0x6B
 #define MPU6050_REG_PWR_MGMT_2      0x6C
+#define MPU6050_REG_FIFO_COUNTH     0x72
+#define MPU6050_REG_FIFO_COUNTL     0x73
+#define MPU6050_REG_FIFO_R_W        0x74
 #define MPU6050_REG_WHO_AM_I        0x75
 
+// USER_CTRL bits
+#define MPU6050_USER_CTRL_FIFO_EN   0x40
+#define MPU6050_USER_CTRL_FIFO_RST  0x04
+
+// FIFO_EN bits
+#define MPU6050_FIFO_EN_TEMP        0x80
+#define MPU6050_FIFO_EN_XG          0x40
+#define MPU6050_FIFO_EN_YG          0x20
+#define MPU6050_FIFO_EN_ZG          0x10
+#define MPU6050_FIFO_EN_ACCEL       0x08
+
+// PWR_MGMT_1 bits
+#define MPU6050_PWR1_SLEEP          0x40
+#define MPU6050_PWR1_TEMP_DIS       0x08
+#define MPU6050_PWR1_CLK_INTERNAL   0x00
+#define MPU6050_PWR1_CLK_PLL_XGYRO  0x01
+
+// PWR_MGMT_2 bits
+#define MPU6050_PWR2_STBY_GYRO      0x07    // STBY_XG | STBY_YG | STBY_ZG
+
+// INT_ENABLE bits
+#define MPU6050_INT_DATA_RDY_EN     0x01
+
+// Burst buffer for FIFO drains (multiple of 2, 6, 12 and 14 byte frames)
+#define MPU6050_FIFO_BURST_BYTES    252
+
+#if MPU6050_FIFO_BURST_BYTES > I2C_BUS_MAX_READ
+#error "FIFO burst does not fit an async I2C read"
+#endif
+
+// ===========================================
+// Private Types
+// ===========================================
+struct mpu6050_dev {
+    bool in_use;
+    bool initialized;
+    i2c_port_t port;
+    uint8_t addr;
+    mpu6050_accel_range_t accel_range;
+    mpu6050_gyro_range_t gyro_range;
+    mpu6050_dlpf_t dlpf;
+    uint8_t sample_rate_div;
+    
+    // Accelerometer-only mode (saved full-mode settings are restored on exit)
+    bool accel_only;
+    mpu6050_dlpf_t saved_dlpf;
+    uint8_t saved_sample_rate_div;
+    uint8_t saved_fifo_sources;     // FIFO_EN before entering, 0 if FIFO was off
+    
+    // Calibration offsets
+    float accel_offset_x;
+    float accel_offset_y;
+    float accel_offset_z;
+    float gyro_offset_x;
+    float gyro_offset_y;
+    float gyro_offset_z;
+    
+    // Scale factors
+    float accel_scale;
+    float gyro_scale;
+    
+    // FIFO state
+    uint8_t fifo_sources;
+    size_t fifo_frame_size;
+    uint32_t fifo_overflows;
+    uint32_t fifo_dropped;          // Whole frames discarded by overflow resets
+    uint8_t fifo_burst[2][MPU6050_FIFO_BURST_BYTES];
+};
+
 // ===========================================
 // Private Variables
 // ===========================================
-static bool initialized = false;
-static mpu6050_accel_range_t current_accel_range = MPU6050_ACCEL_RANGE_4G;
-static mpu6050_gyro_range_t current_gyro_range = MPU6050_GYRO_RANGE_500DPS;
-
-// Calibration offsets
-static float accel_offset_x = 0;
-static float accel_offset_y = 0;
-static float accel_offset_z = 0;
-static float gyro_offset_x = 0;
-static float gyro_offset_y = 0;
-static float gyro_offset_z = 0;
-
-// Scale factors
-static float accel_scale = 8192.0f;  // For ±4g
-static float gyro_scale = 65.5f;     // For ±500 deg/s
+static struct mpu6050_dev devices[MPU6050_MAX_DEVICES];
 
 // ===========================================
 // Private Functions
 // ===========================================
 
-static esp_err_t i2c_master_init(void) {
-    i2c_config_t conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = I2C_MASTER_SDA_IO,
-        .scl_io_num = I2C_MASTER_SCL_IO,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = I2C_MASTER_FREQ_HZ,
-    };
-    
-    esp_err_t ret = i2c_param_config(I2C_MASTER_NUM, &conf);
-    if (ret != ESP_OK) return ret;
-    
-    return i2c_driver_install(I2C_MASTER_NUM, conf.mode, 0, 0, 0);
+static esp_err_t mpu6050_write_byte(mpu6050_handle_t dev, uint8_t reg, uint8_t data) {
+    return i2c_bus_write_reg(dev->port, dev->addr, reg, &data, 1);
 }
 
-static esp_err_t mpu6050_write_byte(uint8_t reg, uint8_t data) {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (MPU6050_ADDR << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_write_byte(cmd, reg, true);
-    i2c_master_write_byte(cmd, data, true);
-    i2c_master_stop(cmd);
-    
-    esp_err_t ret = i2c_master_cmd_begin(I2C_MASTER_NUM, cmd, pdMS_TO_TICKS(100));
-    i2c_cmd_link_delete(cmd);
-    
-    return ret;
+static esp_err_t mpu6050_read_byte(mpu6050_handle_t dev, uint8_t reg, uint8_t *data) {
+    return i2c_bus_read_reg(dev->port, dev->addr, reg, data, 1);
 }
 
-static esp_err_t mpu6050_read_byte(uint8_t reg, uint8_t *data) {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (MPU6050_ADDR << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_write_byte(cmd, reg, true);
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (MPU6050_ADDR << 1) | I2C_MASTER_READ, true);
-    i2c_master_read_byte(cmd, data, I2C_MASTER_NACK);
-    i2c_master_stop(cmd);
-    
-    esp_err_t ret = i2c_master_cmd_begin(I2C_MASTER_NUM, cmd, pdMS_TO_TICKS(100));
-    i2c_cmd_link_delete(cmd);
-    
-    return ret;
+static esp_err_t mpu6050_read_bytes(mpu6050_handle_t dev, uint8_t reg, uint8_t *data, size_t len) {
+    return i2c_bus_read_reg(dev->port, dev->addr, reg, data, len);
 }
 
-static esp_err_t mpu6050_read_bytes(uint8_t reg, uint8_t *data, size_t len) {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+static esp_err_t fifo_submit_burst(mpu6050_handle_t dev, i2c_bus_txn_handle_t *txn, uint8_t *buffer,
+                                   size_t available, size_t *submitted, size_t *frames) {
+    *txn = NULL;
+    *frames = 0;
+    
+    if (*submitted >= available) {
+        return ESP_OK;
+    }
     
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (MPU6050_ADDR << 1) | I2C_MASTER_WRITE, true);
-    i2c_master_write_byte(cmd, reg, true);
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (MPU6050_ADDR << 1) | I2C_MASTER_READ, true);
-    i2c_master_read(cmd, data, len, I2C_MASTER_LAST_NACK);
-    i2c_master_stop(cmd);
+    size_t n = available - *submitted;
+    const size_t frames_per_burst = MPU6050_FIFO_BURST_BYTES / dev->fifo_frame_size;
+    if (n > frames_per_burst) {
+        n = frames_per_burst;
+    }
     
-    esp_err_t ret = i2c_master_cmd_begin(I2C_MASTER_NUM, cmd, pdMS_TO_TICKS(100));
-    i2c_cmd_link_delete(cmd);
+    esp_err_t ret = i2c_bus_submit_read(dev->port, dev->addr, MPU6050_REG_FIFO_R_W,
+                                        buffer, n * dev->fifo_frame_size, txn);
+    if (ret == ESP_OK) {
+        *submitted += n;
+        *frames = n;
+    }
     
     return ret;
 }
 
-static void update_scale_factors(void) {
+static void update_scale_factors(mpu6050_handle_t dev) {
     // Accelerometer scale (LSB/g)
-    switch (current_accel_range) {
-        case MPU6050_ACCEL_RANGE_2G:  accel_scale = 16384.0f; break;
-        case MPU6050_ACCEL_RANGE_4G:  accel_scale = 8192.0f; break;
-        case MPU6050_ACCEL_RANGE_8G:  accel_scale = 4096.0f; break;
-        case MPU6050_ACCEL_RANGE_16G: accel_scale = 2048.0f; break;
+    switch (dev->accel_range) {
+        case MPU6050_ACCEL_RANGE_2G:  dev->accel_scale = 16384.0f; break;
+        case MPU6050_ACCEL_RANGE_4G:  dev->accel_scale = 8192.0f; break;
+        case MPU6050_ACCEL_RANGE_8G:  dev->accel_scale = 4096.0f; break;
+        case MPU6050_ACCEL_RANGE_16G: dev->accel_scale = 2048.0f; break;
     }
     
     // Gyroscope scale (LSB/(deg/s))
-    switch (current_gyro_range) {
-        case MPU6050_GYRO_RANGE_250DPS:  gyro_scale = 131.0f; break;
-        case MPU6050_GYRO_RANGE_500DPS:  gyro_scale = 65.5f; break;
-        case MPU6050_GYRO_RANGE_1000DPS: gyro_scale = 32.8f; break;
-        case MPU6050_GYRO_RANGE_2000DPS: gyro_scale = 16.4f; break;
+    switch (dev->gyro_range) {
+        case MPU6050_GYRO_RANGE_250DPS:  dev->gyro_scale = 131.0f; break;
+        case MPU6050_GYRO_RANGE_500DPS:  dev->gyro_scale = 65.5f; break;
+        case MPU6050_GYRO_RANGE_1000DPS: dev->gyro_scale = 32.8f; break;
+        case MPU6050_GYRO_RANGE_2000DPS: dev->gyro_scale = 16.4f; break;
+    }
+}
+
+/**
+ * Write the clock, power, DLPF and divider registers of one mode
+ * Full mode uses the settings saved on entering accel-only mode. The
+ * cached dlpf/divider only change once every write has gone through.
+ */
+static esp_err_t accel_only_write(mpu6050_handle_t dev, bool enable) {
+    const mpu6050_dlpf_t dlpf = enable ? MPU6050_DLPF_BW_184 : dev->saved_dlpf;
+    const uint8_t div = enable ? 0 : dev->saved_sample_rate_div;
+    esp_err_t ret;
+    
+    if (enable) {
+        // PLL is derived from the X gyro, so use the internal oscillator
+        ret = mpu6050_write_byte(dev, MPU6050_REG_PWR_MGMT_1,
+                                 MPU6050_PWR1_CLK_INTERNAL | MPU6050_PWR1_TEMP_DIS);
+        if (ret != ESP_OK) return ret;
+        
+        ret = mpu6050_write_byte(dev, MPU6050_REG_PWR_MGMT_2, MPU6050_PWR2_STBY_GYRO);
+        if (ret != ESP_OK) return ret;
+    } else {
+        ret = mpu6050_write_byte(dev, MPU6050_REG_PWR_MGMT_2, 0x00);
+        if (ret != ESP_OK) return ret;
+        
+        ret = mpu6050_write_byte(dev, MPU6050_REG_PWR_MGMT_1, MPU6050_PWR1_CLK_PLL_XGYRO);
+        if (ret != ESP_OK) return ret;
     }
+    
+    // Accel-only: 1 kHz output, DLPF enabled (1 kHz base rate), divider 0
+    ret = mpu6050_write_byte(dev, MPU6050_REG_CONFIG, dlpf);
+    if (ret != ESP_OK) return ret;
+    
+    ret = mpu6050_write_byte(dev, MPU6050_REG_SMPLRT_DIV, div);
+    if (ret != ESP_OK) return ret;
+    
+    dev->dlpf = dlpf;
+    dev->sample_rate_div = div;
+    
+    return ESP_OK;
 }
 
 // ===========================================
 // Public Functions
 // ===========================================
 
-esp_err_t mpu6050_init(void) {
+esp_err_t mpu6050_init(i2c_port_t port, uint8_t address, mpu6050_handle_t *out) {
     mpu6050_config_t config = {
+        .i2c_port = port,
+        .address = address,
         .accel_range = MPU6050_ACCEL_RANGE_4G,
         .gyro_range = MPU6050_GYRO_RANGE_500DPS,
         .dlpf = MPU6050_DLPF_BW_44,
         .sample_rate_div = 9  // 100Hz (1000 / (1 + 9))
     };
     
-    return mpu6050_init_with_config(&config);
+    return mpu6050_init_with_config(&config, out);
 }
 
-esp_err_t mpu6050_init_with_config(const mpu6050_config_t *config) {
+esp_err_t mpu6050_init_with_config(const mpu6050_config_t *config, mpu6050_handle_t *out) {
     esp_err_t ret;
     
-    ESP_LOGI(TAG, "Initializing MPU6050...");
+    if (!config || !out) {
+        return ESP_ERR_INVALID_ARG;
+    }
     
-    // Initialize I2C
-    ret = i2c_master_init();
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "I2C init failed: %s", esp_err_to_name(ret));
-        return ret;
+    // Claim a device slot
+    mpu6050_handle_t dev = NULL;
+    for (int i = 0; i < MPU6050_MAX_DEVICES; i++) {
+        if (devices[i].in_use && devices[i].port == config->i2c_port &&
+            devices[i].addr == config->address) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        if (!dev && !devices[i].in_use) {
+            dev = &devices[i];
+        }
+    }
+    if (!dev) {
+        return ESP_ERR_NO_MEM;
     }
     
-    // Check device ID
+    memset(dev, 0, sizeof(*dev));
+    dev->port = config->i2c_port;
+    dev->addr = config->address;
+    
+    ESP_LOGI(TAG, "Initializing MPU6050 (port %d, addr 0x%02X)...", dev->port, dev->addr);
+    
+    // Check device ID (WHO_AM_I ignores the AD0 pin)
     uint8_t who_am_i;
-    ret = mpu6050_read_byte(MPU6050_REG_WHO_AM_I, &who_am_i);
+    ret = mpu6050_read_byte(dev, MPU6050_REG_WHO_AM_I, &who_am_i);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to read WHO_AM_I register");
         return ret;
@@ -197,98 +283,91 @@ esp_err_t mpu6050_init_with_config(const mpu6050_config_t *config) {
     ESP_LOGI(TAG, "MPU6050 found (WHO_AM_I: 0x%02X)", who_am_i);
     
     // Reset device
-    ret = mpu6050_write_byte(MPU6050_REG_PWR_MGMT_1, 0x80);
+    ret = mpu6050_write_byte(dev, MPU6050_REG_PWR_MGMT_1, 0x80);
     if (ret != ESP_OK) return ret;
     vTaskDelay(pdMS_TO_TICKS(100));
     
     // Wake up and set clock source to PLL with X-axis gyro
-    ret = mpu6050_write_byte(MPU6050_REG_PWR_MGMT_1, 0x01);
+    ret = mpu6050_write_byte(dev, MPU6050_REG_PWR_MGMT_1, 0x01);
     if (ret != ESP_OK) return ret;
     vTaskDelay(pdMS_TO_TICKS(10));
     
     // Set sample rate divider
-    ret = mpu6050_write_byte(MPU6050_REG_SMPLRT_DIV, config->sample_rate_div);
+    ret = mpu6050_write_byte(dev, MPU6050_REG_SMPLRT_DIV, config->sample_rate_div);
     if (ret != ESP_OK) return ret;
+    dev->sample_rate_div = config->sample_rate_div;
     
     // Set DLPF
-    ret = mpu6050_write_byte(MPU6050_REG_CONFIG, config->dlpf);
+    ret = mpu6050_write_byte(dev, MPU6050_REG_CONFIG, config->dlpf);
     if (ret != ESP_OK) return ret;
+    dev->dlpf = config->dlpf;
     
     // Set accelerometer range
-    current_accel_range = config->accel_range;
-    ret = mpu6050_write_byte(MPU6050_REG_ACCEL_CONFIG, current_accel_range << 3);
+    dev->accel_range = config->accel_range;
+    ret = mpu6050_write_byte(dev, MPU6050_REG_ACCEL_CONFIG, dev->accel_range << 3);
     if (ret != ESP_OK) return ret;
     
     // Set gyroscope range
-    current_gyro_range = config->gyro_range;
-    ret = mpu6050_write_byte(MPU6050_REG_GYRO_CONFIG, current_gyro_range << 3);
+    dev->gyro_range = config->gyro_range;
+    ret = mpu6050_write_byte(dev, MPU6050_REG_GYRO_CONFIG, dev->gyro_range << 3);
     if (ret != ESP_OK) return ret;
     
     // Update scale factors
-    update_scale_factors();
+    update_scale_factors(dev);
     
-    initialized = true;
+    dev->in_use = true;
+    dev->initialized = true;
+    *out = dev;
     ESP_LOGI(TAG, "MPU6050 initialized successfully");
     
     return ESP_OK;
 }
 
-esp_err_t mpu6050_deinit(void) {
-    if (!initialized) return ESP_OK;
+esp_err_t mpu6050_deinit(mpu6050_handle_t dev) {
+    if (!dev || !dev->initialized) return ESP_OK;
     
-    mpu6050_sleep();
-    i2c_driver_delete(I2C_MASTER_NUM);
-    initialized = false;
+    // The I2C bus is shared and owned by the caller
+    mpu6050_sleep(dev);
+    dev->initialized = false;
+    dev->in_use = false;
     
     return ESP_OK;
 }
 
-esp_err_t mpu6050_read(mpu6050_data_t *data) {
-    if (!initialized) {
+esp_err_t mpu6050_read(mpu6050_handle_t dev, mpu6050_data_t *data) {
+    if (!dev->initialized) {
         return ESP_ERR_INVALID_STATE;
     }
     
+    // Gyro and temperature are in standby: read only the 6 accel bytes
+    if (dev->accel_only) {
+        memset(data, 0, sizeof(*data));
+        return mpu6050_read_accel(dev, &data->accel_x, &data->accel_y, &data->accel_z);
+    }
+    
     uint8_t buffer[14];
-    esp_err_t ret = mpu6050_read_bytes(MPU6050_REG_ACCEL_XOUT_H, buffer, 14);
+    esp_err_t ret = mpu6050_read_bytes(dev, MPU6050_REG_ACCEL_XOUT_H, buffer, 14);
     if (ret != ESP_OK) {
         return ret;
     }
     
-    // Parse accelerometer data
-    int16_t ax_raw = (buffer[0] << 8) | buffer[1];
-    int16_t ay_raw = (buffer[2] << 8) | buffer[3];
-    int16_t az_raw = (buffer[4] << 8) | buffer[5];
-    
-    // Parse temperature data
-    int16_t temp_raw = (buffer[6] << 8) | buffer[7];
-    
-    // Parse gyroscope data
-    int16_t gx_raw = (buffer[8] << 8) | buffer[9];
-    int16_t gy_raw = (buffer[10] << 8) | buffer[11];
-    int16_t gz_raw = (buffer[12] << 8) | buffer[13];
-    
-    // Convert to physical units with calibration
-    data->accel_x = (ax_raw / accel_scale) - accel_offset_x;
-    data->accel_y = (ay_raw / accel_scale) - accel_offset_y;
-    data->accel_z = (az_raw / accel_scale) - accel_offset_z;
-    
-    data->gyro_x = (gx_raw / gyro_scale) - gyro_offset_x;
-    data->gyro_y = (gy_raw / gyro_scale) - gyro_offset_y;
-    data->gyro_z = (gz_raw / gyro_scale) - gyro_offset_z;
-    
-    // Temperature: Temp in °C = (TEMP_OUT / 340) + 36.53
-    data->temp = (temp_raw / 340.0f) + 36.53f;
+    // Register layout matches a full FIFO frame: accel, temp, gyro
+    mpu6050_raw_data_t raw;
+    mpu6050_fifo_parse(buffer, 1,
+                       MPU6050_FIFO_SRC_ACCEL | MPU6050_FIFO_SRC_TEMP | MPU6050_FIFO_SRC_GYRO,
+                       &raw);
+    mpu6050_convert_raw(dev, &raw, data);
     
     return ESP_OK;
 }
 
-esp_err_t mpu6050_read_accel(float *ax, float *ay, float *az) {
-    if (!initialized) {
+esp_err_t mpu6050_read_accel(mpu6050_handle_t dev, float *ax, float *ay, float *az) {
+    if (!dev->initialized) {
         return ESP_ERR_INVALID_STATE;
     }
     
     uint8_t buffer[6];
-    esp_err_t ret = mpu6050_read_bytes(MPU6050_REG_ACCEL_XOUT_H, buffer, 6);
+    esp_err_t ret = mpu6050_read_bytes(dev, MPU6050_REG_ACCEL_XOUT_H, buffer, 6);
     if (ret != ESP_OK) {
         return ret;
     }
@@ -297,20 +376,20 @@ esp_err_t mpu6050_read_accel(float *ax, float *ay, float *az) {
     int16_t ay_raw = (buffer[2] << 8) | buffer[3];
     int16_t az_raw = (buffer[4] << 8) | buffer[5];
     
-    *ax = (ax_raw / accel_scale) - accel_offset_x;
-    *ay = (ay_raw / accel_scale) - accel_offset_y;
-    *az = (az_raw / accel_scale) - accel_offset_z;
+    *ax = (ax_raw / dev->accel_scale) - dev->accel_offset_x;
+    *ay = (ay_raw / dev->accel_scale) - dev->accel_offset_y;
+    *az = (az_raw / dev->accel_scale) - dev->accel_offset_z;
     
     return ESP_OK;
 }
 
-esp_err_t mpu6050_read_gyro(float *gx, float *gy, float *gz) {
-    if (!initialized) {
+esp_err_t mpu6050_read_gyro(mpu6050_handle_t dev, float *gx, float *gy, float *gz) {
+    if (!dev->initialized || dev->accel_only) {
         return ESP_ERR_INVALID_STATE;
     }
     
     uint8_t buffer[6];
-    esp_err_t ret = mpu6050_read_bytes(MPU6050_REG_GYRO_XOUT_H, buffer, 6);
+    esp_err_t ret = mpu6050_read_bytes(dev, MPU6050_REG_GYRO_XOUT_H, buffer, 6);
     if (ret != ESP_OK) {
         return ret;
     }
@@ -319,20 +398,20 @@ esp_err_t mpu6050_read_gyro(float *gx, float *gy, float *gz) {
     int16_t gy_raw = (buffer[2] << 8) | buffer[3];
     int16_t gz_raw = (buffer[4] << 8) | buffer[5];
     
-    *gx = (gx_raw / gyro_scale) - gyro_offset_x;
-    *gy = (gy_raw / gyro_scale) - gyro_offset_y;
-    *gz = (gz_raw / gyro_scale) - gyro_offset_z;
+    *gx = (gx_raw / dev->gyro_scale) - dev->gyro_offset_x;
+    *gy = (gy_raw / dev->gyro_scale) - dev->gyro_offset_y;
+    *gz = (gz_raw / dev->gyro_scale) - dev->gyro_offset_z;
     
     return ESP_OK;
 }
 
-esp_err_t mpu6050_read_temperature(float *temp) {
-    if (!initialized) {
+esp_err_t mpu6050_read_temperature(mpu6050_handle_t dev, float *temp) {
+    if (!dev->initialized || dev->accel_only) {
         return ESP_ERR_INVALID_STATE;
     }
     
     uint8_t buffer[2];
-    esp_err_t ret = mpu6050_read_bytes(MPU6050_REG_TEMP_OUT_H, buffer, 2);
+    esp_err_t ret = mpu6050_read_bytes(dev, MPU6050_REG_TEMP_OUT_H, buffer, 2);
     if (ret != ESP_OK) {
         return ret;
     }
@@ -343,29 +422,111 @@ esp_err_t mpu6050_read_temperature(float *temp) {
     return ESP_OK;
 }
 
-esp_err_t mpu6050_set_accel_range(mpu6050_accel_range_t range) {
-    esp_err_t ret = mpu6050_write_byte(MPU6050_REG_ACCEL_CONFIG, range << 3);
+esp_err_t mpu6050_set_accel_range(mpu6050_handle_t dev, mpu6050_accel_range_t range) {
+    esp_err_t ret = mpu6050_write_byte(dev, MPU6050_REG_ACCEL_CONFIG, range << 3);
+    if (ret == ESP_OK) {
+        dev->accel_range = range;
+        update_scale_factors(dev);
+    }
+    return ret;
+}
+
+esp_err_t mpu6050_set_gyro_range(mpu6050_handle_t dev, mpu6050_gyro_range_t range) {
+    esp_err_t ret = mpu6050_write_byte(dev, MPU6050_REG_GYRO_CONFIG, range << 3);
     if (ret == ESP_OK) {
-        current_accel_range = range;
-        update_scale_factors();
+        dev->gyro_range = range;
+        update_scale_factors(dev);
     }
     return ret;
 }
 
-esp_err_t mpu6050_set_gyro_range(mpu6050_gyro_range_t range) {
-    esp_err_t ret = mpu6050_write_byte(MPU6050_REG_GYRO_CONFIG, range << 3);
+esp_err_t mpu6050_set_dlpf(mpu6050_handle_t dev, mpu6050_dlpf_t dlpf) {
+    esp_err_t ret = mpu6050_write_byte(dev, MPU6050_REG_CONFIG, dlpf);
     if (ret == ESP_OK) {
-        current_gyro_range = range;
-        update_scale_factors();
+        dev->dlpf = dlpf;
     }
     return ret;
 }
 
-esp_err_t mpu6050_set_dlpf(mpu6050_dlpf_t dlpf) {
-    return mpu6050_write_byte(MPU6050_REG_CONFIG, dlpf);
+uint32_t mpu6050_get_sample_rate_hz(mpu6050_handle_t dev) {
+    // Gyro output rate is 8 kHz with DLPF disabled, 1 kHz otherwise
+    uint32_t output_rate = (dev->dlpf == MPU6050_DLPF_BW_260) ? 8000 : 1000;
+    return output_rate / (1 + dev->sample_rate_div);
+}
+
+float mpu6050_get_accel_bandwidth_hz(mpu6050_handle_t dev) {
+    // Accelerometer column of the DLPF_CFG table, indexed by setting
+    static const float bandwidth_hz[] = { 260, 184, 94, 44, 21, 10, 5 };
+    
+    if (dev->dlpf >= sizeof(bandwidth_hz) / sizeof(bandwidth_hz[0])) {
+        return bandwidth_hz[0];
+    }
+    return bandwidth_hz[dev->dlpf];
+}
+
+esp_err_t mpu6050_set_accel_only(mpu6050_handle_t dev, bool enable) {
+    if (!dev->initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (enable == dev->accel_only) {
+        return ESP_OK;
+    }
+    
+    const uint8_t fifo_sources = dev->fifo_sources;
+    if (enable) {
+        dev->saved_dlpf = dev->dlpf;
+        dev->saved_sample_rate_div = dev->sample_rate_div;
+        dev->saved_fifo_sources = fifo_sources;
+    }
+    
+    esp_err_t ret = accel_only_write(dev, enable);
+    
+    // Gyro and temperature no longer produce data, keep FIFO frames at 6 bytes;
+    // leaving brings back the sources that were buffered before
+    const uint8_t want = enable ? MPU6050_FIFO_EN_ACCEL : dev->saved_fifo_sources;
+    const bool fifo_change = dev->fifo_frame_size > 0 && want != 0 && want != fifo_sources;
+    if (ret == ESP_OK && fifo_change) {
+        ret = mpu6050_fifo_enable(dev, want);
+    }
+    
+    if (ret != ESP_OK) {
+        // Best effort: put PWR_MGMT and FIFO_EN back in step for the old mode
+        ESP_LOGE(TAG, "Accelerometer-only switch failed (%s), rolling back",
+                 esp_err_to_name(ret));
+        accel_only_write(dev, !enable);
+        if (fifo_change) {
+            mpu6050_fifo_enable(dev, fifo_sources);
+        }
+        return ret;
+    }
+    
+    dev->accel_only = enable;
+    
+    ESP_LOGI(TAG, "Accelerometer-only mode %s (%lu Hz)", enable ? "enabled" : "disabled",
+             (unsigned long)mpu6050_get_sample_rate_hz(dev));
+    
+    return ESP_OK;
 }
 
-esp_err_t mpu6050_calibrate(void) {
+bool mpu6050_is_accel_only(mpu6050_handle_t dev) {
+    return dev->accel_only;
+}
+
+esp_err_t mpu6050_set_data_ready_int(mpu6050_handle_t dev, bool enable) {
+    if (!dev->initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // Active high, push-pull, 50 us pulse (no latch, nothing to clear)
+    esp_err_t ret = mpu6050_write_byte(dev, MPU6050_REG_INT_PIN_CFG, 0x00);
+    if (ret != ESP_OK) return ret;
+    
+    return mpu6050_write_byte(dev, MPU6050_REG_INT_ENABLE,
+                              enable ? MPU6050_INT_DATA_RDY_EN : 0x00);
+}
+
+esp_err_t mpu6050_calibrate(mpu6050_handle_t dev) {
     ESP_LOGI(TAG, "Calibrating MPU6050 (keep device stationary)...");
     
     float ax_sum = 0, ay_sum = 0, az_sum = 0;
@@ -375,15 +536,15 @@ esp_err_t mpu6050_calibrate(void) {
     mpu6050_data_t data;
     
     // Temporarily disable offsets
-    accel_offset_x = 0;
-    accel_offset_y = 0;
-    accel_offset_z = 0;
-    gyro_offset_x = 0;
-    gyro_offset_y = 0;
-    gyro_offset_z = 0;
+    dev->accel_offset_x = 0;
+    dev->accel_offset_y = 0;
+    dev->accel_offset_z = 0;
+    dev->gyro_offset_x = 0;
+    dev->gyro_offset_y = 0;
+    dev->gyro_offset_z = 0;
     
     for (int i = 0; i < samples; i++) {
-        if (mpu6050_read(&data) == ESP_OK) {
+        if (mpu6050_read(dev, &data) == ESP_OK) {
             ax_sum += data.accel_x;
             ay_sum += data.accel_y;
             az_sum += data.accel_z;
@@ -395,36 +556,36 @@ esp_err_t mpu6050_calibrate(void) {
     }
     
     // Calculate offsets (Z-axis should be 1g at rest)
-    accel_offset_x = ax_sum / samples;
-    accel_offset_y = ay_sum / samples;
-    accel_offset_z = (az_sum / samples) - 1.0f;  // Subtract 1g for gravity
+    dev->accel_offset_x = ax_sum / samples;
+    dev->accel_offset_y = ay_sum / samples;
+    dev->accel_offset_z = (az_sum / samples) - 1.0f;  // Subtract 1g for gravity
     
-    gyro_offset_x = gx_sum / samples;
-    gyro_offset_y = gy_sum / samples;
-    gyro_offset_z = gz_sum / samples;
+    dev->gyro_offset_x = gx_sum / samples;
+    dev->gyro_offset_y = gy_sum / samples;
+    dev->gyro_offset_z = gz_sum / samples;
     
     ESP_LOGI(TAG, "Calibration complete:");
     ESP_LOGI(TAG, "  Accel offsets: %.4f, %.4f, %.4f", 
-             accel_offset_x, accel_offset_y, accel_offset_z);
+             dev->accel_offset_x, dev->accel_offset_y, dev->accel_offset_z);
     ESP_LOGI(TAG, "  Gyro offsets: %.2f, %.2f, %.2f", 
-             gyro_offset_x, gyro_offset_y, gyro_offset_z);
+             dev->gyro_offset_x, dev->gyro_offset_y, dev->gyro_offset_z);
     
     return ESP_OK;
 }
 
-esp_err_t mpu6050_self_test(void) {
+esp_err_t mpu6050_self_test(mpu6050_handle_t dev) {
     ESP_LOGI(TAG, "Running self-test...");
     
     // Read self-test registers
     uint8_t st_x, st_y, st_z, st_a;
-    mpu6050_read_byte(MPU6050_REG_SELF_TEST_X, &st_x);
-    mpu6050_read_byte(MPU6050_REG_SELF_TEST_Y, &st_y);
-    mpu6050_read_byte(MPU6050_REG_SELF_TEST_Z, &st_z);
-    mpu6050_read_byte(MPU6050_REG_SELF_TEST_A, &st_a);
+    mpu6050_read_byte(dev, MPU6050_REG_SELF_TEST_X, &st_x);
+    mpu6050_read_byte(dev, MPU6050_REG_SELF_TEST_Y, &st_y);
+    mpu6050_read_byte(dev, MPU6050_REG_SELF_TEST_Z, &st_z);
+    mpu6050_read_byte(dev, MPU6050_REG_SELF_TEST_A, &st_a);
     
     // Basic check - read some data
     mpu6050_data_t data;
-    esp_err_t ret = mpu6050_read(&data);
+    esp_err_t ret = mpu6050_read(dev, &data);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Self-test FAILED: Cannot read data");
         return ESP_FAIL;
@@ -442,16 +603,252 @@ esp_err_t mpu6050_self_test(void) {
     return ESP_OK;
 }
 
-esp_err_t mpu6050_sleep(void) {
-    return mpu6050_write_byte(MPU6050_REG_PWR_MGMT_1, 0x40);  // Set SLEEP bit
+esp_err_t mpu6050_sleep(mpu6050_handle_t dev) {
+    uint8_t pwr = dev->accel_only ? (MPU6050_PWR1_CLK_INTERNAL | MPU6050_PWR1_TEMP_DIS)
+                             : MPU6050_PWR1_CLK_PLL_XGYRO;
+    return mpu6050_write_byte(dev, MPU6050_REG_PWR_MGMT_1, pwr | MPU6050_PWR1_SLEEP);  // Set SLEEP bit
+}
+
+esp_err_t mpu6050_wake(mpu6050_handle_t dev) {
+    // Clear SLEEP, keep the clock source of the active mode
+    uint8_t pwr = dev->accel_only ? (MPU6050_PWR1_CLK_INTERNAL | MPU6050_PWR1_TEMP_DIS)
+                             : MPU6050_PWR1_CLK_PLL_XGYRO;
+    return mpu6050_write_byte(dev, MPU6050_REG_PWR_MGMT_1, pwr);
+}
+
+void mpu6050_convert_raw(mpu6050_handle_t dev, const mpu6050_raw_data_t *raw, mpu6050_data_t *data) {
+    // Convert to physical units with calibration
+    data->accel_x = (raw->accel_x_raw / dev->accel_scale) - dev->accel_offset_x;
+    data->accel_y = (raw->accel_y_raw / dev->accel_scale) - dev->accel_offset_y;
+    data->accel_z = (raw->accel_z_raw / dev->accel_scale) - dev->accel_offset_z;
+    
+    data->gyro_x = (raw->gyro_x_raw / dev->gyro_scale) - dev->gyro_offset_x;
+    data->gyro_y = (raw->gyro_y_raw / dev->gyro_scale) - dev->gyro_offset_y;
+    data->gyro_z = (raw->gyro_z_raw / dev->gyro_scale) - dev->gyro_offset_z;
+    
+    // Temperature: Temp in °C = (TEMP_OUT / 340) + 36.53
+    data->temp = (raw->temp_raw / 340.0f) + 36.53f;
+}
+
+void mpu6050_get_accel_calibration(mpu6050_handle_t dev, accel_calibration_t *cal) {
+    cal->lsb_per_g = dev->accel_scale;
+    cal->offset_x = dev->accel_offset_x;
+    cal->offset_y = dev->accel_offset_y;
+    cal->offset_z = dev->accel_offset_z;
+}
+
+void mpu6050_get_offsets(mpu6050_handle_t dev, mpu6050_offsets_t *offsets) {
+    offsets->accel_x = dev->accel_offset_x;
+    offsets->accel_y = dev->accel_offset_y;
+    offsets->accel_z = dev->accel_offset_z;
+    offsets->gyro_x = dev->gyro_offset_x;
+    offsets->gyro_y = dev->gyro_offset_y;
+    offsets->gyro_z = dev->gyro_offset_z;
+}
+
+void mpu6050_set_offsets(mpu6050_handle_t dev, const mpu6050_offsets_t *offsets) {
+    dev->accel_offset_x = offsets->accel_x;
+    dev->accel_offset_y = offsets->accel_y;
+    dev->accel_offset_z = offsets->accel_z;
+    dev->gyro_offset_x = offsets->gyro_x;
+    dev->gyro_offset_y = offsets->gyro_y;
+    dev->gyro_offset_z = offsets->gyro_z;
+}
+
+esp_err_t mpu6050_fifo_enable(mpu6050_handle_t dev, uint8_t sources) {
+    if (!dev->initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    sources &= MPU6050_FIFO_EN_TEMP | MPU6050_FIFO_EN_XG | MPU6050_FIFO_EN_YG |
+               MPU6050_FIFO_EN_ZG | MPU6050_FIFO_EN_ACCEL;
+    if (sources == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    // Stop FIFO writes before changing the frame layout
+    esp_err_t ret = mpu6050_write_byte(dev, MPU6050_REG_FIFO_EN, 0);
+    if (ret != ESP_OK) return ret;
+    
+    ret = mpu6050_write_byte(dev, MPU6050_REG_USER_CTRL, MPU6050_USER_CTRL_FIFO_RST);
+    if (ret != ESP_OK) return ret;
+    
+    ret = mpu6050_write_byte(dev, MPU6050_REG_FIFO_EN, sources);
+    if (ret != ESP_OK) return ret;
+    
+    ret = mpu6050_write_byte(dev, MPU6050_REG_USER_CTRL, MPU6050_USER_CTRL_FIFO_EN);
+    if (ret != ESP_OK) return ret;
+    
+    dev->fifo_sources = sources;
+    dev->fifo_frame_size = 0;
+    if (sources & MPU6050_FIFO_EN_ACCEL) dev->fifo_frame_size += 6;
+    if (sources & MPU6050_FIFO_EN_TEMP)  dev->fifo_frame_size += 2;
+    if (sources & MPU6050_FIFO_EN_XG)    dev->fifo_frame_size += 2;
+    if (sources & MPU6050_FIFO_EN_YG)    dev->fifo_frame_size += 2;
+    if (sources & MPU6050_FIFO_EN_ZG)    dev->fifo_frame_size += 2;
+    
+    ESP_LOGI(TAG, "FIFO enabled (sources: 0x%02X, frame: %d bytes)",
+             sources, (int)dev->fifo_frame_size);
+    
+    return ESP_OK;
+}
+
+esp_err_t mpu6050_fifo_disable(mpu6050_handle_t dev) {
+    esp_err_t ret = mpu6050_write_byte(dev, MPU6050_REG_FIFO_EN, 0);
+    if (ret != ESP_OK) return ret;
+    
+    ret = mpu6050_write_byte(dev, MPU6050_REG_USER_CTRL, MPU6050_USER_CTRL_FIFO_RST);
+    if (ret != ESP_OK) return ret;
+    
+    dev->fifo_sources = 0;
+    dev->fifo_frame_size = 0;
+    
+    return ESP_OK;
+}
+
+esp_err_t mpu6050_fifo_reset(mpu6050_handle_t dev) {
+    if (dev->fifo_frame_size == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // FIFO_RST clears FIFO_EN, so re-enable afterwards
+    esp_err_t ret = mpu6050_write_byte(dev, MPU6050_REG_USER_CTRL, MPU6050_USER_CTRL_FIFO_RST);
+    if (ret != ESP_OK) return ret;
+    
+    return mpu6050_write_byte(dev, MPU6050_REG_USER_CTRL, MPU6050_USER_CTRL_FIFO_EN);
+}
+
+esp_err_t mpu6050_fifo_get_count(mpu6050_handle_t dev, uint16_t *count) {
+    if (!count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    uint8_t buffer[2];
+    esp_err_t ret = mpu6050_read_bytes(dev, MPU6050_REG_FIFO_COUNTH, buffer, 2);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    *count = ((uint16_t)buffer[0] << 8) | buffer[1];
+    return ESP_OK;
+}
+
+size_t mpu6050_fifo_frame_size(mpu6050_handle_t dev) {
+    return dev->fifo_frame_size;
+}
+
+esp_err_t mpu6050_fifo_read(mpu6050_handle_t dev, mpu6050_raw_data_t *frames, size_t max_frames,
+                            size_t *frames_read) {
+    if (!dev->initialized || dev->fifo_frame_size == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!frames || !frames_read) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    *frames_read = 0;
+    
+    uint16_t count;
+    esp_err_t ret = mpu6050_fifo_get_count(dev, &count);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    // A full FIFO has overwritten its oldest bytes, so frame alignment is lost
+    if (count >= MPU6050_FIFO_SIZE) {
+        dev->fifo_overflows++;
+        dev->fifo_dropped += count / dev->fifo_frame_size;
+        ESP_LOGW(TAG, "FIFO overflow, resetting");
+        mpu6050_fifo_reset(dev);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    
+    // Only whole frames are read; a partial frame completes by the next drain
+    size_t available = count / dev->fifo_frame_size;
+    if (available > max_frames) {
+        available = max_frames;
+    }
+    
+    // Double-buffered drain: the next burst is queued on the bus before the
+    // current one is decoded
+    i2c_bus_txn_handle_t txn[2] = {NULL, NULL};
+    size_t burst_frames[2] = {0, 0};
+    size_t submitted = 0;
+    int cur = 0;
+    
+    ret = fifo_submit_burst(dev, &txn[cur], dev->fifo_burst[cur], available, &submitted, &burst_frames[cur]);
+    
+    while (ret == ESP_OK && txn[cur]) {
+        int next = cur ^ 1;
+        ret = fifo_submit_burst(dev, &txn[next], dev->fifo_burst[next], available, &submitted, &burst_frames[next]);
+        
+        // Bus transactions time out on their own, so this wait is bounded
+        esp_err_t wait_ret = i2c_bus_wait(txn[cur], I2C_BUS_TIMEOUT_MS * (I2C_BUS_MAX_PENDING + 1));
+        txn[cur] = NULL;
+        if (ret == ESP_OK) {
+            ret = wait_ret;
+        }
+        
+        if (ret == ESP_OK) {
+            mpu6050_fifo_parse(dev->fifo_burst[cur], burst_frames[cur], dev->fifo_sources,
+                               &frames[*frames_read]);
+            *frames_read += burst_frames[cur];
+        }
+        
+        cur = next;
+    }
+    
+    // Do not leave a descriptor owned if the drain stopped early
+    if (txn[cur]) {
+        i2c_bus_wait(txn[cur], I2C_BUS_TIMEOUT_MS * (I2C_BUS_MAX_PENDING + 1));
+    }
+    
+    return ret;
+}
+
+void mpu6050_fifo_parse(const uint8_t *bytes, size_t count, uint8_t sources,
+                        mpu6050_raw_data_t *frames) {
+    for (size_t i = 0; i < count; i++) {
+        mpu6050_raw_data_t *f = &frames[i];
+        memset(f, 0, sizeof(*f));
+        
+        // FIFO order follows register order: accel, temp, gyro X/Y/Z
+        if (sources & MPU6050_FIFO_EN_ACCEL) {
+            f->accel_x_raw = (int16_t)((bytes[0] << 8) | bytes[1]);
+            f->accel_y_raw = (int16_t)((bytes[2] << 8) | bytes[3]);
+            f->accel_z_raw = (int16_t)((bytes[4] << 8) | bytes[5]);
+            bytes += 6;
+        }
+        if (sources & MPU6050_FIFO_EN_TEMP) {
+            f->temp_raw = (int16_t)((bytes[0] << 8) | bytes[1]);
+            bytes += 2;
+        }
+        if (sources & MPU6050_FIFO_EN_XG) {
+            f->gyro_x_raw = (int16_t)((bytes[0] << 8) | bytes[1]);
+            bytes += 2;
+        }
+        if (sources & MPU6050_FIFO_EN_YG) {
+            f->gyro_y_raw = (int16_t)((bytes[0] << 8) | bytes[1]);
+            bytes += 2;
+        }
+        if (sources & MPU6050_FIFO_EN_ZG) {
+            f->gyro_z_raw = (int16_t)((bytes[0] << 8) | bytes[1]);
+            bytes += 2;
+        }
+    }
+}
+
+uint32_t mpu6050_fifo_get_overflow_count(mpu6050_handle_t dev) {
+    return dev->fifo_overflows;
 }
 
-esp_err_t mpu6050_wake(void) {
-    return mpu6050_write_byte(MPU6050_REG_PWR_MGMT_1, 0x01);  // Clear SLEEP, use PLL
+uint32_t mpu6050_fifo_get_dropped_frames(mpu6050_handle_t dev) {
+    return dev->fifo_dropped;
 }
 
-uint8_t mpu6050_get_device_id(void) {
+uint8_t mpu6050_get_device_id(mpu6050_handle_t dev) {
     uint8_t id;
-    mpu6050_read_byte(MPU6050_REG_WHO_AM_I, &id);
+    mpu6050_read_byte(dev, MPU6050_REG_WHO_AM_I, &id);
     return id;
 }
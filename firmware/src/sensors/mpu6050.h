@@ -7,7 +7,11 @@
 #define MPU6050_H
 
 #include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
 #include "esp_err.h"
+#include "driver/i2c.h"
+#include "sensor_types.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +44,26 @@ typedef enum {
     MPU6050_DLPF_BW_5 = 6
 } mpu6050_dlpf_t;
 
+// FIFO data sources (FIFO_EN register bits)
+typedef enum {
+    MPU6050_FIFO_SRC_ACCEL = 0x08,  // ACCEL_XOUT..ACCEL_ZOUT (6 bytes)
+    MPU6050_FIFO_SRC_GYRO = 0x70,   // GYRO_XOUT..GYRO_ZOUT (6 bytes)
+    MPU6050_FIFO_SRC_TEMP = 0x80    // TEMP_OUT (2 bytes)
+} mpu6050_fifo_src_t;
+
+// Hardware FIFO depth in bytes
+#define MPU6050_FIFO_SIZE       1024
+
+// I2C addresses selected by the AD0 pin
+#define MPU6050_ADDR_AD0_LOW    0x68
+#define MPU6050_ADDR_AD0_HIGH   0x69
+
+// Maximum simultaneously open devices (two addresses on two controllers)
+#define MPU6050_MAX_DEVICES     4
+
+// Opaque device handle
+typedef struct mpu6050_dev *mpu6050_handle_t;
+
 // ===========================================
 // Data Structures
 // ===========================================
@@ -54,6 +78,17 @@ typedef struct {
 } mpu6050_data_t;
 
 typedef struct {
+    float accel_x;      // Accelerometer bias in g
+    float accel_y;
+    float accel_z;
+    float gyro_x;       // Gyroscope bias in deg/s
+    float gyro_y;
+    float gyro_z;
+} mpu6050_offsets_t;
+
+typedef struct {
+    i2c_port_t i2c_port;        // Controller (bus initialized with i2c_bus_init)
+    uint8_t address;            // MPU6050_ADDR_AD0_LOW or MPU6050_ADDR_AD0_HIGH
     mpu6050_accel_range_t accel_range;
     mpu6050_gyro_range_t gyro_range;
     mpu6050_dlpf_t dlpf;
@@ -66,101 +101,275 @@ typedef struct {
 
 /**
  * Initialize MPU6050 with default configuration
+ * The I2C port must already be initialized with i2c_bus_init().
+ * @param port I2C controller
+ * @param address Device address (AD0 low/high)
+ * @param dev Output device handle
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_init(void);
+esp_err_t mpu6050_init(i2c_port_t port, uint8_t address, mpu6050_handle_t *dev);
 
 /**
  * Initialize MPU6050 with custom configuration
  * @param config Configuration structure
+ * @param dev Output device handle
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_init_with_config(const mpu6050_config_t *config);
+esp_err_t mpu6050_init_with_config(const mpu6050_config_t *config, mpu6050_handle_t *dev);
 
 /**
- * Deinitialize MPU6050
+ * Deinitialize MPU6050 (puts it to sleep, leaves the I2C bus running)
+ * @param dev Device handle
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_deinit(void);
+esp_err_t mpu6050_deinit(mpu6050_handle_t dev);
 
 /**
  * Read all sensor data
+ * @param dev Device handle
  * @param data Output structure
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_read(mpu6050_data_t *data);
+esp_err_t mpu6050_read(mpu6050_handle_t dev, mpu6050_data_t *data);
 
 /**
  * Read only accelerometer data
+ * @param dev Device handle
  * @param ax, ay, az Acceleration outputs in g
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_read_accel(float *ax, float *ay, float *az);
+esp_err_t mpu6050_read_accel(mpu6050_handle_t dev, float *ax, float *ay, float *az);
 
 /**
  * Read only gyroscope data
+ * @param dev Device handle
  * @param gx, gy, gz Angular velocity outputs in deg/s
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_read_gyro(float *gx, float *gy, float *gz);
+esp_err_t mpu6050_read_gyro(mpu6050_handle_t dev, float *gx, float *gy, float *gz);
 
 /**
  * Read temperature
+ * @param dev Device handle
  * @param temp Temperature output in °C
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_read_temperature(float *temp);
+esp_err_t mpu6050_read_temperature(mpu6050_handle_t dev, float *temp);
 
 /**
  * Set accelerometer range
+ * @param dev Device handle
  * @param range Accelerometer range
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_set_accel_range(mpu6050_accel_range_t range);
+esp_err_t mpu6050_set_accel_range(mpu6050_handle_t dev, mpu6050_accel_range_t range);
 
 /**
  * Set gyroscope range
+ * @param dev Device handle
  * @param range Gyroscope range
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_set_gyro_range(mpu6050_gyro_range_t range);
+esp_err_t mpu6050_set_gyro_range(mpu6050_handle_t dev, mpu6050_gyro_range_t range);
 
 /**
  * Set digital low-pass filter
+ * @param dev Device handle
  * @param dlpf DLPF setting
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_set_dlpf(mpu6050_dlpf_t dlpf);
+esp_err_t mpu6050_set_dlpf(mpu6050_handle_t dev, mpu6050_dlpf_t dlpf);
+
+/**
+ * Get output data rate for the current DLPF and divider settings
+ * @param dev Device handle
+ * @return Sample rate in Hz
+ */
+uint32_t mpu6050_get_sample_rate_hz(mpu6050_handle_t dev);
+
+/**
+ * Get accelerometer bandwidth of the current DLPF setting
+ * @param dev Device handle
+ * @return -3 dB corner in Hz (260, 184, 94, 44, 21, 10 or 5)
+ */
+float mpu6050_get_accel_bandwidth_hz(mpu6050_handle_t dev);
+
+/**
+ * Enable/disable data-ready interrupt on the INT pin
+ * INT is configured active-high, push-pull, 50 us pulse per sample.
+ * @param dev Device handle
+ * @param enable True to enable
+ * @return ESP_OK on success
+ */
+esp_err_t mpu6050_set_data_ready_int(mpu6050_handle_t dev, bool enable);
+
+/**
+ * Enable/disable accelerometer-only high-rate mode
+ * Puts the gyroscope axes in standby (PWR_MGMT_2), disables the
+ * temperature sensor, switches to the internal oscillator and selects a
+ * 1 kHz output rate with the 184 Hz DLPF. Only 6-byte accelerometer
+ * frames are read and, if the FIFO is active, buffered.
+ * Disabling restores the previous clock, DLPF and divider settings and
+ * the FIFO sources buffered before. If a write fails, the registers and
+ * FIFO sources are rolled back to the previous mode.
+ * @param dev Device handle
+ * @param enable True to enable
+ * @return ESP_OK on success
+ */
+esp_err_t mpu6050_set_accel_only(mpu6050_handle_t dev, bool enable);
+
+/**
+ * Check if accelerometer-only mode is active
+ * @param dev Device handle
+ * @return true if gyroscope and temperature are in standby
+ */
+bool mpu6050_is_accel_only(mpu6050_handle_t dev);
 
 /**
  * Calibrate sensor (device must be stationary)
+ * @param dev Device handle
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_calibrate(void);
+esp_err_t mpu6050_calibrate(mpu6050_handle_t dev);
 
 /**
  * Perform self-test
+ * @param dev Device handle
  * @return ESP_OK if self-test passes
  */
-esp_err_t mpu6050_self_test(void);
+esp_err_t mpu6050_self_test(mpu6050_handle_t dev);
 
 /**
  * Enter sleep mode
+ * @param dev Device handle
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_sleep(void);
+esp_err_t mpu6050_sleep(mpu6050_handle_t dev);
 
 /**
  * Wake up from sleep mode
+ * @param dev Device handle
+ * @return ESP_OK on success
+ */
+esp_err_t mpu6050_wake(mpu6050_handle_t dev);
+
+/**
+ * Convert a raw sample to physical units with calibration applied
+ * @param dev Device handle
+ * @param raw Raw register values
+ * @param data Output structure
+ */
+void mpu6050_convert_raw(mpu6050_handle_t dev, const mpu6050_raw_data_t *raw, mpu6050_data_t *data);
+
+/**
+ * Get raw-to-g conversion for the current range and calibration
+ * Used to convert buffered raw samples in batches.
+ * @param dev Device handle
+ * @param cal Output conversion parameters
+ */
+void mpu6050_get_accel_calibration(mpu6050_handle_t dev, accel_calibration_t *cal);
+
+/**
+ * Get current calibration offsets
+ * @param dev Device handle
+ * @param offsets Output offsets
+ */
+void mpu6050_get_offsets(mpu6050_handle_t dev, mpu6050_offsets_t *offsets);
+
+/**
+ * Apply calibration offsets (e.g. restored from NVS)
+ * @param dev Device handle
+ * @param offsets Offsets subtracted from every converted sample
+ */
+void mpu6050_set_offsets(mpu6050_handle_t dev, const mpu6050_offsets_t *offsets);
+
+/**
+ * Enable FIFO acquisition
+ * Samples are written to the on-chip FIFO at the configured sample rate
+ * and drained in bursts with mpu6050_fifo_read().
+ * @param dev Device handle
+ * @param sources Bitmask of mpu6050_fifo_src_t values
  * @return ESP_OK on success
  */
-esp_err_t mpu6050_wake(void);
+esp_err_t mpu6050_fifo_enable(mpu6050_handle_t dev, uint8_t sources);
+
+/**
+ * Disable FIFO acquisition
+ * @param dev Device handle
+ * @return ESP_OK on success
+ */
+esp_err_t mpu6050_fifo_disable(mpu6050_handle_t dev);
+
+/**
+ * Discard FIFO contents and realign to a frame boundary
+ * @param dev Device handle
+ * @return ESP_OK on success
+ */
+esp_err_t mpu6050_fifo_reset(mpu6050_handle_t dev);
+
+/**
+ * Get number of bytes currently stored in the FIFO
+ * @param dev Device handle
+ * @param count Output byte count
+ * @return ESP_OK on success
+ */
+esp_err_t mpu6050_fifo_get_count(mpu6050_handle_t dev, uint16_t *count);
+
+/**
+ * Get size of one FIFO frame for the enabled sources
+ * @param dev Device handle
+ * @return Frame size in bytes (0 if FIFO disabled)
+ */
+size_t mpu6050_fifo_frame_size(mpu6050_handle_t dev);
+
+/**
+ * Drain complete frames from the FIFO
+ * Reads as many whole frames as are available (up to max_frames) using
+ * multi-frame I2C bursts. Trailing partial frames are left in the FIFO
+ * for the next call. On overflow the FIFO is reset and
+ * ESP_ERR_INVALID_SIZE is returned.
+ * @param dev Device handle
+ * @param frames Output buffer for raw frames
+ * @param max_frames Capacity of output buffer
+ * @param frames_read Output number of frames stored
+ * @return ESP_OK on success
+ */
+esp_err_t mpu6050_fifo_read(mpu6050_handle_t dev, mpu6050_raw_data_t *frames, size_t max_frames,
+                            size_t *frames_read);
+
+/**
+ * Decode raw FIFO bytes into frames
+ * Fields for sources not enabled are set to zero.
+ * @param bytes FIFO byte stream starting at a frame boundary
+ * @param count Number of frames to decode
+ * @param sources Bitmask of mpu6050_fifo_src_t values
+ * @param frames Output buffer for raw frames
+ */
+void mpu6050_fifo_parse(const uint8_t *bytes, size_t count, uint8_t sources,
+                        mpu6050_raw_data_t *frames);
+
+/**
+ * Get number of FIFO overflows since init
+ * @param dev Device handle
+ * @return Overflow count
+ */
+uint32_t mpu6050_fifo_get_overflow_count(mpu6050_handle_t dev);
+
+/**
+ * Get number of frames discarded by overflow resets since init
+ * Counts the frames the FIFO held when it was reset; frames the sensor
+ * overwrote before that are not known, so this is a lower bound.
+ * @param dev Device handle
+ * @return Dropped frame count
+ */
+uint32_t mpu6050_fifo_get_dropped_frames(mpu6050_handle_t dev);
 
 /**
  * Get device ID
+ * @param dev Device handle
  * @return Device ID (should be 0x68)
  */
-uint8_t mpu6050_get_device_id(void);
+uint8_t mpu6050_get_device_id(mpu6050_handle_t dev);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,233 @@
+/**
+ * VibeMon OneWire RMT Backend Implementation
+ * TX generates reset/read/write slots with 1 us resolution; RX records the
+ * line (including our own slots) so presence and read bits are decoded from
+ * measured low-pulse widths. The CPU sleeps while slots are on the wire.
+ */
+
+#include "onewire_rmt.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/ringbuf.h"
+#include "driver/gpio.h"
+#include "soc/gpio_struct.h"
+#include "soc/gpio_periph.h"
+#include "soc/io_mux_reg.h"
+#include "esp_log.h"
+
+static const char *TAG = "ONEWIRE_RMT";
+
+// ===========================================
+// Timing (1 tick = 1 us)
+// ===========================================
+#define OW_RMT_CLK_DIV          80      // 80 MHz APB -> 1 MHz
+#define OW_RMT_RESET_LOW        480
+#define OW_RMT_SLOT             70      // Write/read slot incl. recovery
+#define OW_RMT_WRITE_1_LOW      6
+#define OW_RMT_WRITE_0_LOW      60
+#define OW_RMT_READ_LOW         6
+#define OW_RMT_READ_THRESHOLD   15      // Longer low pulse = device sent 0
+#define OW_RMT_RX_FILTER        30      // APB cycles, rejects glitches < ~0.4 us
+#define OW_RMT_IDLE_RESET       (OW_RMT_RESET_LOW + 60)
+#define OW_RMT_IDLE_SLOTS       (OW_RMT_SLOT + 30)
+#define OW_RMT_RX_BUF_SIZE      512
+#define OW_RMT_TIMEOUT_MS       10
+
+// ===========================================
+// Private Variables
+// ===========================================
+static bool initialized = false;
+static rmt_channel_t tx_ch;
+static rmt_channel_t rx_ch;
+static RingbufHandle_t rx_ring = NULL;
+static rmt_item32_t tx_items[8];
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static inline void set_slot(rmt_item32_t *item, uint16_t low_us) {
+    item->level0 = 0;
+    item->duration0 = low_us;
+    item->level1 = 1;
+    item->duration1 = OW_RMT_SLOT - low_us;
+}
+
+// Send TX items while RX records the line; returns the captured items
+static esp_err_t transact(size_t tx_count, uint16_t idle_thresh,
+                          rmt_item32_t **rx_items, size_t *rx_count) {
+    size_t rx_size = 0;
+    
+    rmt_set_rx_idle_thresh(rx_ch, idle_thresh);
+    rmt_rx_start(rx_ch, true);
+    
+    esp_err_t ret = rmt_write_items(tx_ch, tx_items, tx_count, true);
+    if (ret != ESP_OK) {
+        rmt_rx_stop(rx_ch);
+        return ret;
+    }
+    
+    *rx_items = (rmt_item32_t *)xRingbufferReceive(rx_ring, &rx_size,
+                                                   pdMS_TO_TICKS(OW_RMT_TIMEOUT_MS) + 1);
+    rmt_rx_stop(rx_ch);
+    
+    if (!*rx_items) {
+        return ESP_ERR_TIMEOUT;
+    }
+    
+    *rx_count = rx_size / sizeof(rmt_item32_t);
+    return ESP_OK;
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+esp_err_t onewire_rmt_init(int gpio_num, rmt_channel_t tx_channel, rmt_channel_t rx_channel) {
+    if (initialized) {
+        return ESP_OK;
+    }
+    
+    tx_ch = tx_channel;
+    rx_ch = rx_channel;
+    
+    // RX first: configuring TX later must not drop its output routing
+    rmt_config_t rx_conf = RMT_DEFAULT_CONFIG_RX(gpio_num, rx_channel);
+    rx_conf.clk_div = OW_RMT_CLK_DIV;
+    rx_conf.rx_config.filter_en = true;
+    rx_conf.rx_config.filter_ticks_thresh = OW_RMT_RX_FILTER;
+    rx_conf.rx_config.idle_threshold = OW_RMT_IDLE_RESET;
+    
+    esp_err_t ret = rmt_config(&rx_conf);
+    if (ret != ESP_OK) return ret;
+    
+    ret = rmt_driver_install(rx_channel, OW_RMT_RX_BUF_SIZE, 0);
+    if (ret != ESP_OK) return ret;
+    
+    rmt_config_t tx_conf = RMT_DEFAULT_CONFIG_TX(gpio_num, tx_channel);
+    tx_conf.clk_div = OW_RMT_CLK_DIV;
+    tx_conf.tx_config.idle_output_en = true;
+    tx_conf.tx_config.idle_level = RMT_IDLE_LEVEL_HIGH;
+    
+    ret = rmt_config(&tx_conf);
+    if (ret == ESP_OK) {
+        ret = rmt_driver_install(tx_channel, 0, 0);
+    }
+    if (ret != ESP_OK) {
+        rmt_driver_uninstall(rx_channel);
+        return ret;
+    }
+    
+    rmt_get_ringbuf_handle(rx_channel, &rx_ring);
+    
+    // Share the pin: keep the input path and drive it open-drain
+    gpio_set_pull_mode(gpio_num, GPIO_PULLUP_ONLY);
+    PIN_INPUT_ENABLE(GPIO_PIN_MUX_REG[gpio_num]);
+    GPIO.pin[gpio_num].pad_driver = 1;
+    
+    initialized = true;
+    ESP_LOGI(TAG, "OneWire on GPIO %d (RMT TX %d, RX %d)", gpio_num, tx_channel, rx_channel);
+    
+    return ESP_OK;
+}
+
+esp_err_t onewire_rmt_deinit(void) {
+    if (!initialized) {
+        return ESP_OK;
+    }
+    
+    rmt_driver_uninstall(tx_ch);
+    rmt_driver_uninstall(rx_ch);
+    rx_ring = NULL;
+    initialized = false;
+    
+    return ESP_OK;
+}
+
+esp_err_t onewire_rmt_reset(bool *presence) {
+    if (!initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // Reset low, then release; duration1 = 0 ends the transmission
+    tx_items[0].level0 = 0;
+    tx_items[0].duration0 = OW_RMT_RESET_LOW;
+    tx_items[0].level1 = 1;
+    tx_items[0].duration1 = 0;
+    
+    rmt_item32_t *rx;
+    size_t n = 0;
+    esp_err_t ret = transact(1, OW_RMT_IDLE_RESET, &rx, &n);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    // Our reset pulse, a short release, then the device's presence pulse
+    *presence = (n >= 2 &&
+                 rx[0].level0 == 0 && rx[0].duration0 >= OW_RMT_RESET_LOW - 2 &&
+                 rx[0].level1 == 1 && rx[0].duration1 > 0 &&
+                 rx[1].level0 == 0);
+    
+    vRingbufferReturnItem(rx_ring, rx);
+    return ESP_OK;
+}
+
+esp_err_t onewire_rmt_write_bits(uint8_t data, uint8_t count) {
+    if (!initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (count == 0 || count > 8) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    for (uint8_t i = 0; i < count; i++) {
+        set_slot(&tx_items[i], (data & 0x01) ? OW_RMT_WRITE_1_LOW : OW_RMT_WRITE_0_LOW);
+        data >>= 1;
+    }
+    
+    return rmt_write_items(tx_ch, tx_items, count, true);
+}
+
+esp_err_t onewire_rmt_read_bits(uint8_t *data, uint8_t count) {
+    if (!initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!data || count == 0 || count > 8) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    for (uint8_t i = 0; i < count; i++) {
+        set_slot(&tx_items[i], OW_RMT_READ_LOW);
+    }
+    
+    rmt_item32_t *rx;
+    size_t n = 0;
+    esp_err_t ret = transact(count, OW_RMT_IDLE_SLOTS, &rx, &n);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    // One low pulse per slot; a device holding the line low sends a 0
+    uint8_t value = 0;
+    uint8_t bits = 0;
+    for (size_t i = 0; i < n && bits < count; i++) {
+        if (rx[i].level0 != 0) {
+            continue;
+        }
+        if (rx[i].duration0 < OW_RMT_READ_THRESHOLD) {
+            value |= (1 << bits);
+        }
+        bits++;
+    }
+    
+    vRingbufferReturnItem(rx_ring, rx);
+    
+    if (bits != count) {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    
+    *data = value;
+    return ESP_OK;
+}
@@ -0,0 +1,61 @@
+/**
+ * VibeMon OneWire RMT Backend Header
+ * Hardware-timed OneWire slots using one RMT TX and one RMT RX channel
+ * on the same open-drain GPIO
+ */
+
+#ifndef ONEWIRE_RMT_H
+#define ONEWIRE_RMT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "driver/rmt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initialize RMT channels for OneWire on a GPIO
+ * @param gpio_num OneWire data pin (external or internal pull-up required)
+ * @param tx_channel RMT channel used to drive slots
+ * @param rx_channel RMT channel used to sample the line
+ * @return ESP_OK on success
+ */
+esp_err_t onewire_rmt_init(int gpio_num, rmt_channel_t tx_channel, rmt_channel_t rx_channel);
+
+/**
+ * Release RMT channels
+ * @return ESP_OK on success
+ */
+esp_err_t onewire_rmt_deinit(void);
+
+/**
+ * Issue reset pulse and detect presence
+ * @param presence Output, true if a device answered
+ * @return ESP_OK on success
+ */
+esp_err_t onewire_rmt_reset(bool *presence);
+
+/**
+ * Write up to 8 bits, LSB first, in one RMT transaction
+ * @param data Bits to write
+ * @param count Number of bits (1-8)
+ * @return ESP_OK on success
+ */
+esp_err_t onewire_rmt_write_bits(uint8_t data, uint8_t count);
+
+/**
+ * Read up to 8 bits, LSB first, in one RMT transaction
+ * @param data Output bits
+ * @param count Number of bits (1-8)
+ * @return ESP_OK on success
+ */
+esp_err_t onewire_rmt_read_bits(uint8_t *data, uint8_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ONEWIRE_RMT_H
@@ -0,0 +1,137 @@
+/**
+ * VibeMon Raw Sample Ring Buffer Implementation
+ */
+
+#include "sample_ring.h"
+
+#include <string.h>
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool sample_ring_init(sample_ring_t *ring, raw_accel_sample_t *storage, size_t capacity) {
+    if (!ring || !storage || capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        return false;
+    }
+    
+    ring->samples = storage;
+    ring->mask = capacity - 1;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+    
+    return true;
+}
+
+void sample_ring_reset(sample_ring_t *ring) {
+    ring->tail = ring->head;
+}
+
+size_t sample_ring_count(const sample_ring_t *ring) {
+    return ring->head - ring->tail;
+}
+
+bool sample_ring_push(sample_ring_t *ring, int16_t x, int16_t y, int16_t z) {
+    size_t head = ring->head;
+    
+    if (head - ring->tail > ring->mask) {
+        ring->dropped++;
+        return false;
+    }
+    
+    raw_accel_sample_t *s = &ring->samples[head & ring->mask];
+    s->x = x;
+    s->y = y;
+    s->z = z;
+    
+    // Publish only after the sample is written
+    __sync_synchronize();
+    ring->head = head + 1;
+    
+    return true;
+}
+
+size_t sample_ring_peek(const sample_ring_t *ring, size_t offset,
+                        raw_accel_sample_t *out, size_t max) {
+    size_t count = sample_ring_count(ring);
+    if (offset >= count) {
+        return 0;
+    }
+    
+    count -= offset;
+    if (count > max) {
+        count = max;
+    }
+    
+    // Copy in at most two contiguous runs around the wrap point
+    size_t start = (ring->tail + offset) & ring->mask;
+    size_t first = ring->mask + 1 - start;
+    if (first > count) {
+        first = count;
+    }
+    
+    memcpy(out, &ring->samples[start], first * sizeof(raw_accel_sample_t));
+    memcpy(out + first, ring->samples, (count - first) * sizeof(raw_accel_sample_t));
+    
+    return count;
+}
+
+size_t sample_ring_consume(sample_ring_t *ring, size_t count) {
+    size_t available = sample_ring_count(ring);
+    if (count > available) {
+        count = available;
+    }
+    
+    ring->tail += count;
+    return count;
+}
+
+size_t sample_ring_read_float(sample_ring_t *ring, const accel_calibration_t *cal,
+                              float *x, float *y, float *z, size_t max) {
+    size_t count = sample_ring_count(ring);
+    if (count > max) {
+        count = max;
+    }
+    
+    size_t start = ring->tail & ring->mask;
+    size_t first = ring->mask + 1 - start;
+    if (first > count) {
+        first = count;
+    }
+    
+    sample_ring_convert(&ring->samples[start], first, cal, x, y, z);
+    sample_ring_convert(ring->samples, count - first, cal,
+                        x ? x + first : NULL,
+                        y ? y + first : NULL,
+                        z ? z + first : NULL);
+    
+    ring->tail += count;
+    return count;
+}
+
+void sample_ring_convert(const raw_accel_sample_t *in, size_t count,
+                         const accel_calibration_t *cal,
+                         float *x, float *y, float *z) {
+    const float gain = 1.0f / cal->lsb_per_g;
+    
+    // One pass per axis keeps each loop a plain multiply-subtract stream
+    if (x) {
+        const float off = cal->offset_x;
+        for (size_t i = 0; i < count; i++) {
+            x[i] = in[i].x * gain - off;
+        }
+    }
+    if (y) {
+        const float off = cal->offset_y;
+        for (size_t i = 0; i < count; i++) {
+            y[i] = in[i].y * gain - off;
+        }
+    }
+    if (z) {
+        const float off = cal->offset_z;
+        for (size_t i = 0; i < count; i++) {
+            z[i] = in[i].z * gain - off;
+        }
+    }
+}
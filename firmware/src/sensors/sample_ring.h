@@ -0,0 +1,107 @@
+/**
+ * VibeMon Raw Sample Ring Buffer Header
+ * Packed int16 accelerometer samples with deferred float conversion
+ */
+
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sensor_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Ring Buffer
+// ===========================================
+// Single producer (acquisition) / single consumer (analysis).
+// Capacity must be a power of two; indices run freely and are masked.
+typedef struct {
+    raw_accel_sample_t *samples;
+    size_t mask;
+    volatile size_t head;       // Next write position (producer)
+    volatile size_t tail;       // Next read position (consumer)
+    uint32_t dropped;           // Samples rejected because buffer was full
+} sample_ring_t;
+
+/**
+ * Initialize ring over caller-provided storage
+ * @param ring Ring to initialize
+ * @param storage Sample storage
+ * @param capacity Number of samples in storage (power of two)
+ * @return true on success, false if capacity is not a power of two
+ */
+bool sample_ring_init(sample_ring_t *ring, raw_accel_sample_t *storage, size_t capacity);
+
+/**
+ * Discard all buffered samples
+ * @param ring Ring buffer
+ */
+void sample_ring_reset(sample_ring_t *ring);
+
+/**
+ * Get number of buffered samples
+ * @param ring Ring buffer
+ * @return Sample count
+ */
+size_t sample_ring_count(const sample_ring_t *ring);
+
+/**
+ * Append one raw sample
+ * @param ring Ring buffer
+ * @param x, y, z Raw accelerometer values
+ * @return true if stored, false if the buffer was full
+ */
+bool sample_ring_push(sample_ring_t *ring, int16_t x, int16_t y, int16_t z);
+
+/**
+ * Copy raw samples out without consuming them
+ * @param ring Ring buffer
+ * @param offset Samples to skip from the oldest
+ * @param out Output buffer
+ * @param max Capacity of output buffer
+ * @return Number of samples copied
+ */
+size_t sample_ring_peek(const sample_ring_t *ring, size_t offset,
+                        raw_accel_sample_t *out, size_t max);
+
+/**
+ * Drop samples from the consumer side
+ * @param ring Ring buffer
+ * @param count Number of samples to drop
+ * @return Number of samples dropped
+ */
+size_t sample_ring_consume(sample_ring_t *ring, size_t count);
+
+/**
+ * Convert and consume samples into per-axis float arrays (g)
+ * Scaling and offset correction run in tight per-axis loops with a
+ * precomputed reciprocal instead of a divide per value.
+ * @param ring Ring buffer
+ * @param cal Raw-to-g conversion
+ * @param x, y, z Output arrays (any may be NULL to skip an axis)
+ * @param max Capacity of output arrays
+ * @return Number of samples converted
+ */
+size_t sample_ring_read_float(sample_ring_t *ring, const accel_calibration_t *cal,
+                              float *x, float *y, float *z, size_t max);
+
+/**
+ * Convert a block of raw samples into per-axis float arrays (g)
+ * @param in Raw samples
+ * @param count Number of samples
+ * @param cal Raw-to-g conversion
+ * @param x, y, z Output arrays (any may be NULL to skip an axis)
+ */
+void sample_ring_convert(const raw_accel_sample_t *in, size_t count,
+                         const accel_calibration_t *cal,
+                         float *x, float *y, float *z);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SAMPLE_RING_H
@@ -0,0 +1,64 @@
+/**
+ * VibeMon Sample Store Implementation
+ */
+
+#include "sample_store.h"
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+bool sample_store_init(sample_store_t *store, float *storage, size_t capacity) {
+    if (!store || !storage || capacity < 4 || (capacity & (capacity - 1)) != 0 ||
+        ((uintptr_t)storage % SAMPLE_STORE_ALIGN) != 0) {
+        return false;
+    }
+    
+    // Power-of-two capacity of at least 4 floats keeps every array aligned
+    for (int c = 0; c < SAMPLE_STORE_CHANNELS; c++) {
+        store->channel[c] = storage + c * capacity;
+    }
+    store->mask = capacity - 1;
+    store->head = 0;
+    
+    return true;
+}
+
+void sample_store_reset(sample_store_t *store) {
+    store->head = 0;
+}
+
+size_t sample_store_count(const sample_store_t *store) {
+    return (store->head > store->mask) ? store->mask + 1 : store->head;
+}
+
+void sample_store_push(sample_store_t *store, const float values[SAMPLE_STORE_CHANNELS]) {
+    const size_t i = store->head & store->mask;
+    
+    for (int c = 0; c < SAMPLE_STORE_CHANNELS; c++) {
+        store->channel[c][i] = values[c];
+    }
+    store->head++;
+}
+
+size_t sample_store_latest(const sample_store_t *store, sample_store_channel_t channel,
+                           size_t count, const float **run1, size_t *len1,
+                           const float **run2) {
+    const size_t held = sample_store_count(store);
+    if (count > held) {
+        count = held;
+    }
+    
+    const float *data = store->channel[channel];
+    const size_t start = (store->head - count) & store->mask;
+    size_t first = store->mask + 1 - start;
+    if (first > count) {
+        first = count;
+    }
+    
+    *run1 = &data[start];
+    *len1 = first;
+    *run2 = data;
+    
+    return count;
+}
@@ -0,0 +1,102 @@
+/**
+ * VibeMon Sample Store Header
+ * Recent converted samples kept as one contiguous array per channel
+ * (structure of arrays), so analysis passes stream only the channels
+ * they use instead of striding over whole sensor_data_t records
+ */
+
+#ifndef SAMPLE_STORE_H
+#define SAMPLE_STORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===========================================
+// Channels
+// ===========================================
+// Axis channels share indices with VIB_AXIS_X/Y/Z
+typedef enum {
+    SAMPLE_STORE_ACCEL_X = 0,
+    SAMPLE_STORE_ACCEL_Y,
+    SAMPLE_STORE_ACCEL_Z,
+    SAMPLE_STORE_VIBRATION,     // Dynamic acceleration magnitude (g)
+    SAMPLE_STORE_CHANNELS
+} sample_store_channel_t;
+
+// Channel arrays start on this boundary (bytes)
+#define SAMPLE_STORE_ALIGN              16
+
+// Floats of caller storage for a capacity (power of two, >= 4)
+#define SAMPLE_STORE_STORAGE_SIZE(cap)  (SAMPLE_STORE_CHANNELS * (cap))
+
+// ===========================================
+// Store
+// ===========================================
+// History buffer: keeps the latest capacity samples, overwriting the
+// oldest. Single task; writer and readers must not run concurrently.
+typedef struct {
+    float *channel[SAMPLE_STORE_CHANNELS];
+    size_t mask;
+    size_t head;                // Samples written since reset (free-running)
+} sample_store_t;
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+/**
+ * Initialize a store over caller-provided storage
+ * @param store Store to initialize
+ * @param storage SAMPLE_STORE_STORAGE_SIZE(capacity) floats, aligned to
+ *                SAMPLE_STORE_ALIGN
+ * @param capacity Samples kept per channel (power of two, >= 4)
+ * @return true on success, false on invalid capacity or alignment
+ */
+bool sample_store_init(sample_store_t *store, float *storage, size_t capacity);
+
+/**
+ * Discard all samples
+ * @param store Store
+ */
+void sample_store_reset(sample_store_t *store);
+
+/**
+ * Get number of samples held
+ * @param store Store
+ * @return Sample count (at most the capacity)
+ */
+size_t sample_store_count(const sample_store_t *store);
+
+/**
+ * Append one sample to every channel
+ * @param store Store
+ * @param values One value per channel, indexed by sample_store_channel_t
+ */
+void sample_store_push(sample_store_t *store, const float values[SAMPLE_STORE_CHANNELS]);
+
+/**
+ * Locate the latest samples of a channel without copying
+ * The samples, oldest first, are run1[0..len1) followed by
+ * run2[0..returned - len1); run2 is only used when the range wraps.
+ * @param store Store
+ * @param channel Channel index
+ * @param count Samples wanted
+ * @param run1 Output, first contiguous run
+ * @param len1 Output, length of the first run
+ * @param run2 Output, second contiguous run
+ * @return Number of samples located (count clipped to what is held)
+ */
+size_t sample_store_latest(const sample_store_t *store, sample_store_channel_t channel,
+                           size_t count, const float **run1, size_t *len1,
+                           const float **run2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SAMPLE_STORE_H
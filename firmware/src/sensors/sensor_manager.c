@@ -5,17 +5,32 @@
 
 #include "sensor_manager.h"
 #include "mpu6050.h"
+#include "i2c_bus.h"
 #include "ds18b20.h"
+#include "sample_ring.h"
+#include "calibration_estimator.h"
+#include "alert_engine.h"
+#include "../storage/calibration_store.h"
+#include "../power/battery_monitor.h"
+#include "../dsp/fft.h"
+#include "../dsp/welch.h"
+#include "../dsp/envelope.h"
+#include "../dsp/goertzel.h"
+#include "../dsp/biquad.h"
+#include "../dsp/decimator.h"
+#include "../dsp/running_stats.h"
+#include "../dsp/trend.h"
 #include "../config.h"
 
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_timer.h"
-#include "driver/adc.h"
-#include "esp_adc_cal.h"
+#include "esp_cpu.h"
+#include "driver/gpio.h"
 
 static const char *TAG = "SENSOR_MANAGER";
 
@@ -26,91 +41,902 @@ static bool initialized = false;
 static device_status_t device_status = {0};
 static uint32_t reading_count = 0;
 static uint32_t error_count = 0;
-static esp_adc_cal_characteristics_t adc_chars;
+
+// Data-ready interrupt
+static TaskHandle_t drdy_task = NULL;
+static int64_t drdy_period_us = 0;
+static volatile int64_t drdy_last_edge_us = 0;
+
+// Sampling health: data-ready edges, or FIFO drains in raw acquisition
+static volatile uint32_t sample_jitter_us = 0;
+static volatile uint32_t sample_jitter_max_us = 0;
+static uint32_t missed_samples = 0;
+static int64_t drain_last_us = 0;
+
+// DS18B20 conversion stepping, kept off the sampling task
+#define TEMP_TASK_STACK     2048
+#define TEMP_TASK_PRIO      2       // Below the sampling task
+#define TEMP_TASK_POLL_MS   10
+static StackType_t temp_task_stack[TEMP_TASK_STACK];
+static StaticTask_t temp_task_buf;
+static TaskHandle_t volatile temp_task = NULL;
+static volatile bool temp_task_stop = false;
+
+// Accelerometers, probed in this order; slot 0 is the primary sensor
+typedef struct {
+    i2c_port_t port;
+    uint8_t addr;
+} accel_slot_t;
+
+static const accel_slot_t accel_slots[SENSOR_MAX_ACCELEROMETERS] = {
+    { I2C_MASTER_NUM,    MPU6050_ADDR },
+    { I2C_MASTER_NUM,    MPU6050_ADDR_ALT },
+    { I2C_SECONDARY_NUM, MPU6050_ADDR },
+    { I2C_SECONDARY_NUM, MPU6050_ADDR_ALT },
+};
+
+typedef struct {
+    mpu6050_handle_t dev;
+    uint8_t slot;
+    uint32_t errors;
+    sample_ring_t ring;
+    
+    // Background calibration
+    calibration_estimator_t cal_est;
+    mpu6050_offsets_t cal_saved;    // Offsets last written to NVS
+    mpu6050_offsets_t cal_pending;  // Offsets to write, valid while cal_dirty
+    bool cal_saved_valid;
+    bool cal_dirty;                 // Offsets changed, NVS write pending
+} accel_channel_t;
+
+static accel_channel_t accels[SENSOR_MAX_ACCELEROMETERS];
+static uint8_t accel_count = 0;
+static bool secondary_bus = false;
+
+// Raw acquisition
+#define RAW_DRAIN_CHUNK         32
+static raw_accel_sample_t *raw_storage = NULL;    // One ring per detected sensor
+static mpu6050_raw_data_t raw_frames[RAW_DRAIN_CHUNK];
+static bool raw_acquisition = false;
+
+// Primary sensor stream since the last read(), for telemetry (raw FIFO
+// batches or, without them, single register reads)
+static float raw_latest[VIB_AXIS_COUNT];
+static float raw_vib_sum_sq = 0;
+static float raw_vib_peak = 0;
+static uint32_t raw_vib_count = 0;
+
+// Gravity removal, one high-pass per axis of the primary sensor
+static biquad_cascade_t gravity_hp[VIB_AXIS_COUNT];
+static bool gravity_primed = false;
+
+// Recent samples, one aligned array per channel
+static float store_data[SAMPLE_STORE_STORAGE_SIZE(VIB_STORE_SIZE)]
+    __attribute__((aligned(SAMPLE_STORE_ALIGN)));
+static sample_store_t vib_store;
+
+// Spectrum analysis
+static float fft_work[2 * VIB_FFT_SIZE];            // Two interleaved channels
+static float fft_window[VIB_FFT_SIZE];
+static float fft_amplitude[2][VIB_FFT_SIZE / 2];
+static fft_plan_t fft_plan = {0};
+
+// Welch PSD of the primary sensor, fed from converted raw batches
+static float psd_storage[WELCH_STORAGE_SIZE(VIB_PSD_SEGMENT_MAX)];
+static welch_t psd;
+static bool psd_ready = false;
+static welch_config_t psd_config = {
+    .segment_len = VIB_PSD_SEGMENT,
+    .overlap = VIB_PSD_OVERLAP,
+    .averaging = VIB_PSD_AVERAGING,
+    .alpha = VIB_PSD_ALPHA,
+    .window = VIB_FFT_WINDOW,
+    .sample_rate_hz = 0,
+};
+
+// Envelope analysis of the primary sensor, fed alongside the PSD
+#if !VIB_TARGETED_ONLY
+static float env_storage[ENVELOPE_STORAGE_SIZE(VIB_ENV_FFT_SIZE)];
+#endif
+static envelope_t env;
+static bool env_ready = false;
+
+// Goertzel bank at the machine's fault frequencies
+static goertzel_bank_t fault_bank;
+static uint8_t fault_targets[GOERTZEL_MAX_TARGETS];    // fault_target_t per bin
+static bool fault_ready = false;
+static machine_profile_t machine_profile;
+static bool machine_profile_valid = false;
+
+// Decimated per-axis streams of the primary sensor
+static decimator_t decim[VIB_AXIS_COUNT];
+static bool decim_ready = false;
+
+// Streaming per-axis statistics of the primary sensor
+static running_stats_t stats_window[VIB_AXIS_COUNT];    // Filling
+static running_stats_t stats_long[VIB_AXIS_COUNT];      // Short windows merged so far
+static running_stats_t stats_short_done[VIB_AXIS_COUNT];
+static running_stats_t stats_long_done[VIB_AXIS_COUNT];
+static uint32_t stats_window_len = 0;                   // Samples per short window
+static uint32_t stats_fill = 0;
+static uint16_t stats_windows = 0;
+
+// Long-horizon trend, one point per long statistics window
+static trend_t trends[PROGNOSIS_METRIC_COUNT];
+static bool trend_ready = false;
+static vibration_prognosis_t prognosis;
+static portMUX_TYPE prognosis_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Calibration handoff from the sampling task to the NVS writer
+static portMUX_TYPE cal_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Profile handoff from the BLE task to the analysis consumer
+static portMUX_TYPE profile_mux = portMUX_INITIALIZER_UNLOCKED;
+static machine_profile_t pending_profile;
+static volatile bool profile_pending = false;
+
+// Debounced alerts, updated by the publishing task
+static alert_engine_t alerts;
+static alert_log_limiter_t alert_log[ALERT_METRIC_COUNT];
+static float alert_thresholds[4];   // Config the limits were built from:
+                                    // vibration warn/crit, temperature warn/crit
+static bool alert_thresholds_valid = false;
 
 // Continuous mode
 static bool continuous_mode = false;
 static void (*continuous_callback)(sensor_data_t *data) = NULL;
 
-// ===========================================
-// Battery ADC Constants
-// ===========================================
-#define BATTERY_ADC_SAMPLES     64
-#define BATTERY_VOLTAGE_DIVIDER 2.0f    // Voltage divider ratio
-#define BATTERY_FULL_VOLTAGE    4.2f    // Fully charged LiPo
-#define BATTERY_EMPTY_VOLTAGE   3.0f    // Empty LiPo
+// Only persist offset changes larger than this (limits flash wear)
+#define CAL_SAVE_DELTA_G        0.005f
+#define CAL_SAVE_DELTA_DPS      0.2f
 
 // ===========================================
 // Private Functions
 // ===========================================
 
-// ВАЖНО: MPU6050 возвращает ускорение в "g" по осям.
-// Если брать sqrt(ax^2+ay^2+az^2), то в покое получится ~1g (гравитация),
-// и метрика почти не будет меняться даже при тряске/поворотах.
-// Поэтому сначала оцениваем вектор гравитации НЧ-фильтром и вычитаем его
-// (получаем динамическую составляющую вибрации), затем считаем модуль.
-static float calculate_dynamic_vibration_g(float ax, float ay, float az) {
-    // NЧ фильтр гравитации (alpha ближе к 1 => более медленная адаптация)
-    // При sample rate ~100 Гц alpha=0.99 даёт частоту среза порядка ~0.16 Гц.
-    const float alpha = 0.99f;
-
-    static bool gravity_initialized = false;
-    static float gx = 0.0f, gy = 0.0f, gz = 1.0f;
-
-    if (!gravity_initialized) {
-        gx = ax;
-        gy = ay;
-        gz = az;
-        gravity_initialized = true;
+// MPU6050 reports acceleration including gravity, so the magnitude of
+// the raw vector sits near 1 g regardless of vibration. A per-axis
+// high-pass removes gravity (and slow tilt) before taking the magnitude.
+// Every primary-sensor sample reaches them through raw_vibration_push(),
+// whether it came from the FIFO or from a register read.
+static float dynamic_vibration_g(float ax, float ay, float az) {
+    const float in[VIB_AXIS_COUNT] = { ax, ay, az };
+    
+    // Start from steady state so the first samples do not ring at 1 g
+    if (!gravity_primed) {
+        for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+            biquad_cascade_prime(&gravity_hp[a], in[a]);
+        }
+        gravity_primed = true;
+    }
+    
+    float sum_sq = 0;
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        const float d = biquad_cascade_process(&gravity_hp[a], in[a]);
+        sum_sq += d * d;
+    }
+    
+    return sqrtf(sum_sq);
+}
+
+// (Re)design gravity removal for the current sample rate
+static void gravity_start(void) {
+    const float rate = (float)sensor_manager_get_sample_rate_hz();
+    biquad_coeffs_t c[VIB_GRAVITY_SECTIONS];
+    
+    if (!biquad_design_butterworth(c, VIB_GRAVITY_SECTIONS, BIQUAD_HIGHPASS,
+                                   rate, VIB_GRAVITY_CUTOFF_HZ)) {
+        ESP_LOGW(TAG, "Gravity filter invalid at %.0f Hz", rate);
+        return;
+    }
+    
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        biquad_cascade_init(&gravity_hp[a], c, VIB_GRAVITY_SECTIONS);
+    }
+    gravity_primed = false;
+}
+
+// Primary accelerometer: drives data-ready and the sensor_data_t path
+static inline mpu6050_handle_t primary_accel(void) {
+    return accels[0].dev;
+}
+
+// MPU6050 die temperature; in standby (no reading) in accel-only mode
+static esp_err_t die_temperature(float *temp) {
+    if (!device_status.mpu6050_ok || mpu6050_is_accel_only(primary_accel())) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return mpu6050_read_temperature(primary_accel(), temp);
+}
+
+static void calibration_restore(uint8_t index) {
+    accel_channel_t *ch = &accels[index];
+    
+    calibration_estimator_reset(&ch->cal_est);
+    ch->cal_dirty = false;
+    ch->cal_saved_valid = (calibration_store_load(ch->slot, &ch->cal_saved) == ESP_OK);
+    
+    if (ch->cal_saved_valid) {
+        mpu6050_set_offsets(ch->dev, &ch->cal_saved);
+        device_status.accel_calibrated_mask |= (1 << index);
+        ESP_LOGI(TAG, "Accelerometer %d calibration restored", index);
+    }
+}
+
+static bool offsets_changed(const mpu6050_offsets_t *a, const mpu6050_offsets_t *b) {
+    return fabsf(a->accel_x - b->accel_x) > CAL_SAVE_DELTA_G ||
+           fabsf(a->accel_y - b->accel_y) > CAL_SAVE_DELTA_G ||
+           fabsf(a->accel_z - b->accel_z) > CAL_SAVE_DELTA_G ||
+           fabsf(a->gyro_x - b->gyro_x) > CAL_SAVE_DELTA_DPS ||
+           fabsf(a->gyro_y - b->gyro_y) > CAL_SAVE_DELTA_DPS ||
+           fabsf(a->gyro_z - b->gyro_z) > CAL_SAVE_DELTA_DPS;
+}
+
+// Fold a converged background estimate into the live offsets
+static void calibration_update(uint8_t index) {
+    accel_channel_t *ch = &accels[index];
+    mpu6050_offsets_t residual, offsets;
+    
+    if (!calibration_estimator_take(&ch->cal_est, &residual)) {
+        return;
+    }
+    
+    mpu6050_get_offsets(ch->dev, &offsets);
+    offsets.accel_x += residual.accel_x;
+    offsets.accel_y += residual.accel_y;
+    offsets.accel_z += residual.accel_z;
+    offsets.gyro_x += residual.gyro_x;
+    offsets.gyro_y += residual.gyro_y;
+    offsets.gyro_z += residual.gyro_z;
+    mpu6050_set_offsets(ch->dev, &offsets);
+    
+    device_status.accel_calibrated_mask |= (1 << index);
+    
+    // Written later by sensor_manager_save_calibration(), off this path
+    portENTER_CRITICAL(&cal_mux);
+    if (!ch->cal_saved_valid || offsets_changed(&offsets, &ch->cal_saved)) {
+        ch->cal_pending = offsets;
+        ch->cal_dirty = true;
+    }
+    portEXIT_CRITICAL(&cal_mux);
+}
+
+static void calibration_feed(const mpu6050_data_t *mpu_data) {
+    float gyro[3] = { mpu_data->gyro_x, mpu_data->gyro_y, mpu_data->gyro_z };
+    bool gyro_on = !mpu6050_is_accel_only(primary_accel());
+    
+    if (calibration_estimator_add(&accels[0].cal_est, mpu_data->accel_x, mpu_data->accel_y,
+                                  mpu_data->accel_z, gyro_on ? gyro : NULL)) {
+        calibration_update(0);
+    }
+}
+
+static esp_err_t init_accelerometers(void) {
+    esp_err_t ret = i2c_bus_init(I2C_MASTER_NUM, I2C_MASTER_SDA_IO,
+                                 I2C_MASTER_SCL_IO, I2C_MASTER_FREQ_HZ);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Primary I2C bus init failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    
+    // Secondary bus is optional hardware
+    secondary_bus = (i2c_bus_init(I2C_SECONDARY_NUM, I2C_SECONDARY_SDA_IO,
+                                  I2C_SECONDARY_SCL_IO, I2C_SECONDARY_FREQ_HZ) == ESP_OK);
+    
+    accel_count = 0;
+    for (uint8_t slot = 0; slot < SENSOR_MAX_ACCELEROMETERS; slot++) {
+        if (accel_slots[slot].port == I2C_SECONDARY_NUM && !secondary_bus) {
+            continue;
+        }
+        
+        mpu6050_handle_t dev;
+        if (mpu6050_init(accel_slots[slot].port, accel_slots[slot].addr, &dev) != ESP_OK) {
+            // The primary sensor must be first; without it nothing else is used
+            if (slot == 0) {
+                return ESP_ERR_NOT_FOUND;
+            }
+            continue;
+        }
+        
+        accel_channel_t *ch = &accels[accel_count];
+        ch->dev = dev;
+        ch->slot = slot;
+        ch->errors = 0;
+        device_status.accel_ok_mask |= (1 << accel_count);
+        accel_count++;
+        
+        ESP_LOGI(TAG, "Accelerometer %d on port %d addr 0x%02X", accel_count - 1,
+                 accel_slots[slot].port, accel_slots[slot].addr);
+        
+        // Stored offsets make the first sample valid; no blocking calibration
+        calibration_restore(accel_count - 1);
+    }
+    
+    device_status.accel_count = accel_count;
+    return ESP_OK;
+}
+
+// Amplitude spectrum of fft_work[0..n) into stats->spectrum / dominant_freq
+// Fold a spectrum into a fixed-size report, keeping the peak of each group
+static void fold_spectrum(const float *amplitude, uint16_t bins, float *out) {
+    const uint16_t group = (bins > VIB_SPECTRUM_BINS) ? bins / VIB_SPECTRUM_BINS : 1;
+    
+    for (uint16_t i = 0; i < VIB_SPECTRUM_BINS; i++) {
+        float v = 0;
+        for (uint16_t j = 0; j < group && i * group + j < bins; j++) {
+            v = fmaxf(v, amplitude[i * group + j]);
+        }
+        out[i] = v;
+    }
+}
+
+// Largest bin within one bin of freq, since a defect line seldom sits on a
+// bin centre; 0 when freq is unset or beyond the spectrum
+static float line_amplitude(const float *amplitude, uint16_t bins, float bin_hz, float freq) {
+    const int k = (int)(freq / bin_hz + 0.5f);
+    if (freq <= 0 || k < 1 || k >= bins) {
+        return 0;
+    }
+    
+    float v = amplitude[k];
+    if (k > 1) {
+        v = fmaxf(v, amplitude[k - 1]);
+    }
+    if (k + 1 < bins) {
+        v = fmaxf(v, amplitude[k + 1]);
+    }
+    
+    return v;
+}
+
+// Load two channels of the last n samples as interleaved, mean-removed pairs
+static void load_pair(const sample_store_t *store, uint16_t n,
+                      sample_store_channel_t ch_a, sample_store_channel_t ch_b) {
+    const float *a1, *a2, *b1, *b2;
+    size_t len1;
+    
+    // Channels share indexing, so both split at the same point
+    sample_store_latest(store, ch_a, n, &a1, &len1, &a2);
+    sample_store_latest(store, ch_b, n, &b1, &len1, &b2);
+    
+    float mean_a = 0, mean_b = 0;
+    for (size_t i = 0; i < len1; i++) {
+        fft_work[2 * i] = a1[i];
+        fft_work[2 * i + 1] = b1[i];
+        mean_a += a1[i];
+        mean_b += b1[i];
+    }
+    for (size_t i = len1; i < n; i++) {
+        fft_work[2 * i] = a2[i - len1];
+        fft_work[2 * i + 1] = b2[i - len1];
+        mean_a += a2[i - len1];
+        mean_b += b2[i - len1];
+    }
+    
+    // Remove DC so the window does not smear it into low bins
+    mean_a /= n;
+    mean_b /= n;
+    for (uint16_t i = 0; i < n; i++) {
+        fft_work[2 * i] -= mean_a;
+        fft_work[2 * i + 1] -= mean_b;
+    }
+}
+
+// Windowed amplitude spectra of the pair in fft_work
+// @return CPU cycles spent in the transform itself
+static uint32_t pair_spectra(void) {
+    fft_window_apply_pair_f32(&fft_plan, fft_work);
+    const uint32_t start = esp_cpu_get_cycle_count();
+    fft_real_pair_f32(&fft_plan, fft_work);
+    const uint32_t cycles = esp_cpu_get_cycle_count() - start;
+    fft_amplitude_pair_f32(&fft_plan, fft_work, fft_amplitude[0], fft_amplitude[1]);
+    return cycles;
+}
+
+static float peak_freq(const float *amplitude, uint16_t n, float sample_rate_hz) {
+    float peak_bin;
+    fft_find_peak(amplitude, n / 2, 1, &peak_bin);
+    return peak_bin * sample_rate_hz / n;
+}
+
+// Spectra of X/Y/Z and the magnitude series over the last n samples.
+// Two real channels share each complex transform, so the four series
+// cost two n-point FFTs and every window/twiddle load serves two channels.
+static void calc_spectrum(const sample_store_t *store, uint16_t n, float sample_rate_hz,
+                          vibration_stats_t *stats) {
+    // Window buffer is only rebuilt when the frame length changes
+    if (fft_plan.n != n && !fft_plan_init(&fft_plan, n, VIB_FFT_WINDOW, fft_window, NULL)) {
+        fft_plan.n = 0;
+        return;
+    }
+    
+    load_pair(store, n, SAMPLE_STORE_ACCEL_X, SAMPLE_STORE_ACCEL_Y);
+    uint32_t cycles = pair_spectra();
+    stats->axis[VIB_AXIS_X].dominant_freq = peak_freq(fft_amplitude[0], n, sample_rate_hz);
+    stats->axis[VIB_AXIS_Y].dominant_freq = peak_freq(fft_amplitude[1], n, sample_rate_hz);
+    
+    load_pair(store, n, SAMPLE_STORE_ACCEL_Z, SAMPLE_STORE_VIBRATION);
+    cycles += pair_spectra();
+    stats->axis[VIB_AXIS_Z].dominant_freq = peak_freq(fft_amplitude[0], n, sample_rate_hz);
+    stats->dominant_freq = peak_freq(fft_amplitude[1], n, sample_rate_hz);
+    
+    fold_spectrum(fft_amplitude[1], n / 2, stats->spectrum);
+    
+    // On-target cost, comparable with the host bench_fft table
+    ESP_LOGD(TAG, "%u-point paired FFT: %lu cycles per transform",
+             n, (unsigned long)(cycles / 2));
+}
+
+// (Re)initialize the PSD estimator from psd_config at the current rate
+static bool psd_start(void) {
+    welch_config_t cfg = psd_config;
+    if (cfg.sample_rate_hz <= 0) {
+        cfg.sample_rate_hz = (float)sensor_manager_get_sample_rate_hz();
+    }
+    
+    psd_ready = welch_init(&psd, &cfg, psd_storage);
+    if (!psd_ready) {
+        ESP_LOGW(TAG, "Invalid PSD configuration (segment %u)", cfg.segment_len);
+    }
+    
+    return psd_ready;
+}
+
+#if !VIB_TARGETED_ONLY
+// (Re)initialize the envelope analyzer at the current rate
+static bool envelope_start(void) {
+    const envelope_config_t cfg = {
+        .sample_rate_hz = (float)sensor_manager_get_sample_rate_hz(),
+        .band_low_hz = VIB_ENV_BAND_LOW_HZ,
+        .band_high_hz = VIB_ENV_BAND_HIGH_HZ,
+        .decimation = VIB_ENV_DECIMATION,
+        .fft_size = VIB_ENV_FFT_SIZE,
+        .window = FFT_WINDOW_HANN,
+    };
+    
+    // Band must fit below Nyquist; not available at slow output rates
+    env_ready = envelope_init(&env, &cfg, env_storage);
+    if (!env_ready) {
+        ESP_LOGW(TAG, "Envelope analysis disabled at %.0f Hz", cfg.sample_rate_hz);
+    }
+    
+    return env_ready;
+}
+#endif
+
+// Fault frequencies for a profile; bearing terms follow the usual
+// kinematic formulas with d/D cos(contact angle)
+static void fault_frequencies(const machine_profile_t *p, float *freq) {
+    const float shaft_hz = p->shaft_rpm / 60.0f;
+    
+    freq[FAULT_TARGET_1X] = shaft_hz;
+    freq[FAULT_TARGET_2X] = 2.0f * shaft_hz;
+    freq[FAULT_TARGET_3X] = 3.0f * shaft_hz;
+    freq[FAULT_TARGET_LINE] = p->line_hz;
+    freq[FAULT_TARGET_LINE_2X] = 2.0f * p->line_hz;
+    
+    if (p->rolling_elements > 0 && p->ball_diameter_mm > 0 &&
+        p->pitch_diameter_mm > p->ball_diameter_mm) {
+        const float n = p->rolling_elements;
+        const float r = p->ball_diameter_mm / p->pitch_diameter_mm *
+                        cosf(p->contact_angle_deg * (float)M_PI / 180.0f);
+        
+        freq[FAULT_TARGET_FTF] = 0.5f * shaft_hz * (1.0f - r);
+        freq[FAULT_TARGET_BPFO] = 0.5f * n * shaft_hz * (1.0f - r);
+        freq[FAULT_TARGET_BPFI] = 0.5f * n * shaft_hz * (1.0f + r);
+        freq[FAULT_TARGET_BSF] = 0.5f * p->pitch_diameter_mm / p->ball_diameter_mm *
+                                 shaft_hz * (1.0f - r * r);
     } else {
-        gx = alpha * gx + (1.0f - alpha) * ax;
-        gy = alpha * gy + (1.0f - alpha) * ay;
-        gz = alpha * gz + (1.0f - alpha) * az;
+        freq[FAULT_TARGET_FTF] = 0;
+        freq[FAULT_TARGET_BPFO] = 0;
+        freq[FAULT_TARGET_BPFI] = 0;
+        freq[FAULT_TARGET_BSF] = 0;
+    }
+}
+
+// (Re)build the Goertzel bank from the machine profile at the current rate
+static bool fault_bank_start(void) {
+    fault_ready = false;
+    if (!machine_profile_valid) {
+        return false;
+    }
+    
+    const float rate = (float)sensor_manager_get_sample_rate_hz();
+    float freq[FAULT_TARGET_COUNT];
+    float targets[GOERTZEL_MAX_TARGETS];
+    uint8_t count = 0;
+    
+    fault_frequencies(&machine_profile, freq);
+    
+    // Only targets the sample rate can resolve
+    for (uint8_t t = 0; t < FAULT_TARGET_COUNT && count < GOERTZEL_MAX_TARGETS; t++) {
+        if (freq[t] > 0 && freq[t] < 0.5f * rate) {
+            fault_targets[count] = t;
+            targets[count++] = freq[t];
+        }
+    }
+    
+    uint32_t block = (uint32_t)(rate * VIB_FAULT_BLOCK_MS / 1000);
+    if (block > UINT16_MAX) {
+        block = UINT16_MAX;
     }
+    
+    fault_ready = goertzel_bank_init(&fault_bank, rate, (uint16_t)block, targets, count);
+    if (fault_ready) {
+        ESP_LOGI(TAG, "Fault bank: %d targets, %.2f Hz resolution", count, rate / block);
+    }
+    
+    return fault_ready;
+}
 
-    const float dx = ax - gx;
-    const float dy = ay - gy;
-    const float dz = az - gz;
+// Accumulate the latest count samples of one store channel
+static void channel_stats(const sample_store_t *store, sample_store_channel_t channel,
+                          size_t count, running_stats_t *s) {
+    const float *run1, *run2;
+    size_t len1;
+    size_t n = sample_store_latest(store, channel, count, &run1, &len1, &run2);
+    
+    running_stats_reset(s);
+    running_stats_add_block(s, run1, len1);
+    running_stats_add_block(s, run2, n - len1);
+}
 
-    return sqrtf(dx * dx + dy * dy + dz * dz);
+// Gravity removal, sample store and telemetry aggregates for a converted
+// batch of the primary sensor; register reads arrive as batches of one
+static void raw_vibration_push(const float *x, const float *y, const float *z, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        const float vib = dynamic_vibration_g(x[i], y[i], z[i]);
+        const float values[SAMPLE_STORE_CHANNELS] = {
+            [SAMPLE_STORE_ACCEL_X] = x[i],
+            [SAMPLE_STORE_ACCEL_Y] = y[i],
+            [SAMPLE_STORE_ACCEL_Z] = z[i],
+            [SAMPLE_STORE_VIBRATION] = vib,
+        };
+        sample_store_push(&vib_store, values);
+        
+        raw_vib_sum_sq += vib * vib;
+        raw_vib_peak = fmaxf(raw_vib_peak, vib);
+    }
+    
+    raw_vib_count += n;
+    raw_latest[VIB_AXIS_X] = x[n - 1];
+    raw_latest[VIB_AXIS_Y] = y[n - 1];
+    raw_latest[VIB_AXIS_Z] = z[n - 1];
 }
 
-static uint8_t voltage_to_percent(float voltage) {
-    if (voltage >= BATTERY_FULL_VOLTAGE) return 100;
-    if (voltage <= BATTERY_EMPTY_VOLTAGE) return 0;
+// Telemetry from the stream: latest sample, RMS and peak since last read
+static void stream_telemetry(sensor_data_t *data) {
+    data->accel_x = raw_latest[VIB_AXIS_X];
+    data->accel_y = raw_latest[VIB_AXIS_Y];
+    data->accel_z = raw_latest[VIB_AXIS_Z];
     
-    // Linear interpolation
-    float percent = (voltage - BATTERY_EMPTY_VOLTAGE) / 
-                    (BATTERY_FULL_VOLTAGE - BATTERY_EMPTY_VOLTAGE) * 100.0f;
-    return (uint8_t)percent;
+    if (raw_vib_count > 0) {
+        data->vibration_rms = sqrtf(raw_vib_sum_sq / raw_vib_count);
+        data->vibration_peak = raw_vib_peak;
+    }
+    raw_vib_sum_sq = 0;
+    raw_vib_peak = 0;
+    raw_vib_count = 0;
 }
 
-static esp_err_t init_battery_adc(void) {
-    // Configure ADC
-    adc1_config_width(ADC_WIDTH_BIT_12);
-    adc1_config_channel_atten(BATTERY_ADC_CHANNEL, BATTERY_ADC_ATTEN);
+// One primary-sensor sample from the registers, fed to the same stream as
+// the FIFO batches (fallback without raw acquisition)
+static esp_err_t register_sample(mpu6050_data_t *mpu_data) {
+    esp_err_t ret = mpu6050_read(primary_accel(), mpu_data);
+    if (ret != ESP_OK) {
+        return ret;
+    }
     
-    // Characterize ADC
-    esp_adc_cal_characterize(ADC_UNIT_1, BATTERY_ADC_ATTEN, 
-                             ADC_WIDTH_BIT_12, 1100, &adc_chars);
+    calibration_feed(mpu_data);
+    raw_vibration_push(&mpu_data->accel_x, &mpu_data->accel_y, &mpu_data->accel_z, 1);
     
     return ESP_OK;
 }
 
-static float read_battery_voltage(void) {
-    uint32_t adc_reading = 0;
+// Dynamic (mean-removed) view of one axis accumulator
+static void axis_stats_from(const running_stats_t *s, vibration_axis_stats_t *out) {
+    out->rms = running_stats_std(s);
+    out->peak = running_stats_peak(s);
+    out->crest_factor = (out->rms > 0) ? (out->peak / out->rms) : 0;
+    out->peak_to_peak = running_stats_peak_to_peak(s);
+    out->skewness = running_stats_skewness(s);
+    out->kurtosis = running_stats_kurtosis(s);
+}
+
+static void window_stats_start(void) {
+    stats_window_len = sensor_manager_get_sample_rate_hz() * VIB_STATS_WINDOW_MS / 1000;
+    if (stats_window_len == 0) {
+        stats_window_len = 1;
+    }
+    
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        running_stats_reset(&stats_window[a]);
+        running_stats_reset(&stats_long[a]);
+        running_stats_reset(&stats_short_done[a]);
+        running_stats_reset(&stats_long_done[a]);
+    }
+    stats_fill = 0;
+    stats_windows = 0;
+}
+
+static void trend_start(void) {
+    trend_ready = true;
+    for (int m = 0; m < PROGNOSIS_METRIC_COUNT; m++) {
+        trend_ready &= trend_init(&trends[m], PROGNOSIS_LEVEL_RATIO);
+        prognosis.value[m] = NAN;
+        prognosis.critical[m] = NAN;
+        prognosis.hours_to_critical[m] = NAN;
+    }
+    prognosis.velocity_band_hz[0] = NAN;
+    prognosis.velocity_band_hz[1] = NAN;
+    prognosis.points = 0;
+}
+
+/**
+ * Upper edge of the velocity band that is actually measured
+ * ISO 10816 integrates up to 1 kHz, but the PSD stops at Nyquist and the
+ * accelerometer DLPF rolls off above its corner (184 Hz in accel-only
+ * mode), so the band ends at the lowest of the three.
+ */
+static float velocity_band_hi_hz(void) {
+    float hi = fminf(PROGNOSIS_VELOCITY_HI_HZ, 0.5f * psd.config.sample_rate_hz);
+    
+    if (device_status.mpu6050_ok) {
+        hi = fminf(hi, mpu6050_get_accel_bandwidth_hz(primary_accel()));
+    }
+    
+    return hi;
+}
+
+/**
+ * Velocity RMS from the acceleration PSD
+ * Integrates PSD(f) / (2 pi f)^2 from PROGNOSIS_VELOCITY_LO_HZ to
+ * velocity_band_hi_hz().
+ * @param hi_hz Output, upper band edge used
+ * @return mm/s, NAN when no PSD is available
+ */
+static float psd_velocity_rms(float *hi_hz) {
+    *hi_hz = NAN;
+    if (!psd_ready || welch_segment_count(&psd) == 0) {
+        return NAN;
+    }
+    
+    uint16_t bins;
+    const float *density = welch_psd(&psd, &bins);
+    const float bin_hz = welch_bin_hz(&psd);
+    const float hi = velocity_band_hi_hz();
+    float sum = 0;
+    
+    *hi_hz = hi;
+    for (uint16_t k = 1; k < bins; k++) {
+        const float f = k * bin_hz;
+        if (f < PROGNOSIS_VELOCITY_LO_HZ || f > hi) {
+            continue;
+        }
+        const float gain = 9806.65f / (2.0f * (float)M_PI * f);    // g -> mm/s
+        sum += density[k] * gain * gain;
+    }
+    
+    return sqrtf(sum * bin_hz);
+}
+
+// Trend the aggregates of a completed long window; O(1) per point
+static void prognosis_update(void) {
+    float values[PROGNOSIS_METRIC_COUNT];
+    float critical[PROGNOSIS_METRIC_COUNT];
+    float hours[PROGNOSIS_METRIC_COUNT];
+    float ms = 0, kurtosis = 0;
+    float vib_warn;
+    
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        const float std = running_stats_std(&stats_long_done[a]);
+        ms += std * std;
+        kurtosis = fmaxf(kurtosis, running_stats_kurtosis(&stats_long_done[a]));
+    }
+    values[PROGNOSIS_METRIC_RMS] = sqrtf(ms);
+    float velocity_hi_hz;
+    values[PROGNOSIS_METRIC_VELOCITY] = psd_velocity_rms(&velocity_hi_hz);
+    values[PROGNOSIS_METRIC_KURTOSIS] = kurtosis;
+    
+    config_get_vibration_thresholds(&vib_warn, &critical[PROGNOSIS_METRIC_RMS]);
+    critical[PROGNOSIS_METRIC_VELOCITY] = PROGNOSIS_VELOCITY_CRITICAL;
+    critical[PROGNOSIS_METRIC_KURTOSIS] = PROGNOSIS_KURTOSIS_CRITICAL;
+    
+    const float period_s = VIB_STATS_WINDOW_MS * VIB_STATS_LONG_WINDOWS / 1000.0f;
+    for (int m = 0; m < PROGNOSIS_METRIC_COUNT; m++) {
+        trend_push(&trends[m], values[m]);
+        hours[m] = trend_time_to(&trends[m], critical[m], period_s, PROGNOSIS_MIN_R2) / 3600.0f;
+    }
+    
+    portENTER_CRITICAL(&prognosis_mux);
+    memcpy(prognosis.value, values, sizeof(values));
+    memcpy(prognosis.critical, critical, sizeof(critical));
+    memcpy(prognosis.hours_to_critical, hours, sizeof(hours));
+    prognosis.velocity_band_hz[0] = PROGNOSIS_VELOCITY_LO_HZ;
+    prognosis.velocity_band_hz[1] = velocity_hi_hz;
+    prognosis.points++;
+    portEXIT_CRITICAL(&prognosis_mux);
+}
+
+// Shortest estimate over the metrics; NAN only if none is known
+static float prognosis_hours(void) {
+    float hours = NAN;
+    
+    portENTER_CRITICAL(&prognosis_mux);
+    for (int m = 0; m < PROGNOSIS_METRIC_COUNT; m++) {
+        const float h = prognosis.hours_to_critical[m];
+        if (!isnan(h) && (isnan(hours) || h < hours)) {
+            hours = h;
+        }
+    }
+    portEXIT_CRITICAL(&prognosis_mux);
+    
+    return hours;
+}
+
+// Accumulate a converted batch, closing windows at their sample boundaries
+static void window_stats_push(const float *const axes[VIB_AXIS_COUNT], size_t n) {
+    size_t i = 0;
+    
+    while (i < n) {
+        size_t run = stats_window_len - stats_fill;
+        if (run > n - i) {
+            run = n - i;
+        }
+        
+        for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+            if (axes[a]) {
+                running_stats_add_block(&stats_window[a], axes[a] + i, run);
+            }
+        }
+        stats_fill += run;
+        i += run;
+        
+        if (stats_fill < stats_window_len) {
+            break;
+        }
+        
+        for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+            stats_short_done[a] = stats_window[a];
+            running_stats_merge(&stats_long[a], &stats_window[a]);
+            running_stats_reset(&stats_window[a]);
+        }
+        stats_fill = 0;
+        
+        if (++stats_windows == VIB_STATS_LONG_WINDOWS) {
+            for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+                stats_long_done[a] = stats_long[a];
+                running_stats_reset(&stats_long[a]);
+            }
+            stats_windows = 0;
+    
+            if (trend_ready) {
+                prognosis_update();
+            }
+        }
+    }
+}
+
+/**
+ * Rebuild alert limits when the configured thresholds change
+ * Comparing four floats per update is cheap; the limits (and the log
+ * lines for invalid thresholds) are only rebuilt on a change.
+ */
+static void alert_limits_refresh(void) {
+    float t[4];
+    config_get_vibration_thresholds(&t[0], &t[1]);
+    config_get_temp_thresholds(&t[2], &t[3]);
     
-    // Average multiple samples
-    for (int i = 0; i < BATTERY_ADC_SAMPLES; i++) {
-        adc_reading += adc1_get_raw(BATTERY_ADC_CHANNEL);
+    if (alert_thresholds_valid && memcmp(t, alert_thresholds, sizeof(t)) == 0) {
+        return;
     }
-    adc_reading /= BATTERY_ADC_SAMPLES;
+    memcpy(alert_thresholds, t, sizeof(t));
+    alert_thresholds_valid = true;
+    
+    alert_limits_t limits = {
+        .raise_dwell_ms = ALERT_RAISE_DWELL_MS,
+        .clear_dwell_ms = ALERT_CLEAR_DWELL_MS,
+    };
     
-    // Convert to voltage
-    uint32_t voltage_mv = esp_adc_cal_raw_to_voltage(adc_reading, &adc_chars);
+    limits.warning = t[0];
+    limits.critical = t[1];
+    limits.hysteresis = ALERT_VIBRATION_HYSTERESIS;
+    if (!alert_engine_set_limits(&alerts, ALERT_METRIC_VIBRATION, &limits)) {
+        ESP_LOGW(TAG, "Invalid vibration thresholds %.2f/%.2f g, keeping previous",
+                 limits.warning, limits.critical);
+    }
     
-    // Apply voltage divider correction
-    return (voltage_mv / 1000.0f) * BATTERY_VOLTAGE_DIVIDER;
+    limits.warning = t[2];
+    limits.critical = t[3];
+    limits.hysteresis = ALERT_TEMP_HYSTERESIS;
+    if (!alert_engine_set_limits(&alerts, ALERT_METRIC_TEMPERATURE, &limits)) {
+        ESP_LOGW(TAG, "Invalid temperature thresholds %.1f/%.1f °C, keeping previous",
+                 limits.warning, limits.critical);
+    }
+    
+    limits.warning = BATTERY_LOW_THRESHOLD;
+    limits.critical = BATTERY_CRITICAL;
+    limits.hysteresis = ALERT_BATTERY_HYSTERESIS;
+    limits.falling = true;
+    alert_engine_set_limits(&alerts, ALERT_METRIC_BATTERY, &limits);
+}
+
+/**
+ * Log an alert transition, at most ALERT_LOG_BURST lines per metric and window
+ */
+static void alert_log_event(const alert_event_t *event) {
+    uint32_t suppressed;
+    if (!alert_log_allow(&alert_log[event->metric], event->time_ms, &suppressed)) {
+        return;
+    }
+    
+    if (suppressed > 0) {
+        ESP_LOGW(TAG, "%lu %s alert transition(s) not logged",
+                 (unsigned long)suppressed, alert_metric_name(event->metric));
+    }
+    ESP_LOGW(TAG, "Alert %s: %s -> %s (%.2f)", alert_metric_name(event->metric),
+             alert_level_name(event->from), alert_level_name(event->to), event->value);
+}
+
+static bool decimator_start(void) {
+    const float rate = (float)sensor_manager_get_sample_rate_hz();
+    
+    decim_ready = false;
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        if (!decimator_init(&decim[a], rate, VIB_DECIM_STAGES)) {
+            ESP_LOGW(TAG, "Decimated streams disabled at %.0f Hz", rate);
+            return false;
+        }
+    }
+    
+    decim_ready = true;
+    return true;
+}
+
+// Steps the DS18B20 state machine: one bus byte per tick while
+// collecting, otherwise a cheap poll. Preemption by the sampling task is
+// harmless with RMT; a preempted bit-bang slot fails the CRC and the
+// previous reading is kept.
+static void temp_task_fn(void *arg) {
+    while (!temp_task_stop) {
+        ds18b20_state_t st = ds18b20_update();
+        vTaskDelay(st == DS18B20_STATE_COLLECTING ? 1 : pdMS_TO_TICKS(TEMP_TASK_POLL_MS));
+    }
+    
+    temp_task = NULL;
+    vTaskDelete(NULL);
+}
+
+static void temp_task_start(void) {
+    temp_task_stop = false;
+    temp_task = xTaskCreateStatic(temp_task_fn, "ds18b20", TEMP_TASK_STACK, NULL,
+                                  TEMP_TASK_PRIO, temp_task_stack, &temp_task_buf);
+}
+
+static void temp_task_stop_wait(void) {
+    temp_task_stop = true;
+    while (temp_task) {
+        vTaskDelay(pdMS_TO_TICKS(TEMP_TASK_POLL_MS));
+    }
+}
+
+static void IRAM_ATTR drdy_isr_handler(void *arg) {
+    int64_t now = esp_timer_get_time();
+    
+    // Deviation of this period from the sensor's nominal sample period
+    if (drdy_last_edge_us != 0) {
+        int64_t deviation = (now - drdy_last_edge_us) - drdy_period_us;
+        uint32_t jitter = (uint32_t)(deviation < 0 ? -deviation : deviation);
+        sample_jitter_us = jitter;
+        if (jitter > sample_jitter_max_us) {
+            sample_jitter_max_us = jitter;
+        }
+    }
+    drdy_last_edge_us = now;
+    
+    BaseType_t higher_priority_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(drdy_task, &higher_priority_woken);
+    portYIELD_FROM_ISR(higher_priority_woken);
 }
 
 // ===========================================
@@ -122,14 +948,19 @@ esp_err_t sensor_manager_init(void) {
     
     ESP_LOGI(TAG, "Initializing sensor manager...");
     
-    // Initialize MPU6050
-    ret = mpu6050_init();
+    if (!sample_store_init(&vib_store, store_data, VIB_STORE_SIZE)) {
+        ESP_LOGE(TAG, "Invalid sample store size %d", VIB_STORE_SIZE);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    
+    // Initialize MPU6050 accelerometers
+    ret = init_accelerometers();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "MPU6050 initialization failed!");
         device_status.mpu6050_ok = false;
         error_count++;
     } else {
-        ESP_LOGI(TAG, "MPU6050 initialized");
+        ESP_LOGI(TAG, "MPU6050 initialized (%d accelerometer(s))", accel_count);
         device_status.mpu6050_ok = true;
     }
     
@@ -140,14 +971,16 @@ esp_err_t sensor_manager_init(void) {
         device_status.ds18b20_ok = false;
         error_count++;
     } else {
-        ESP_LOGI(TAG, "DS18B20 initialized");
+        ESP_LOGI(TAG, "DS18B20 initialized (%d probe(s))", ds18b20_get_count());
         device_status.ds18b20_ok = true;
+        device_status.temp_probe_count = ds18b20_get_count();
+        temp_task_start();
     }
     
-    // Initialize battery ADC
-    ret = init_battery_adc();
+    // Start background battery monitor
+    ret = battery_monitor_init();
     if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "Battery ADC initialization failed!");
+        ESP_LOGW(TAG, "Battery monitor initialization failed!");
         device_status.battery_ok = false;
     } else {
         device_status.battery_ok = true;
@@ -159,7 +992,23 @@ esp_err_t sensor_manager_init(void) {
         return ESP_FAIL;
     }
     
+    alert_engine_reset(&alerts);
+    for (int m = 0; m < ALERT_METRIC_COUNT; m++) {
+        alert_log_limiter_init(&alert_log[m], ALERT_LOG_BURST, ALERT_LOG_WINDOW_MS);
+    }
+    alert_thresholds_valid = false;
+    trend_start();
+    
     initialized = true;
+    gravity_start();
+    
+#if MPU6050_ACCEL_ONLY
+    // MPU6050 die temperature is only needed as a DS18B20 fallback
+    if (device_status.ds18b20_ok) {
+        sensor_manager_set_accel_only(true);
+    }
+#endif
+    
     ESP_LOGI(TAG, "Sensor manager initialized");
     return ESP_OK;
 }
@@ -167,8 +1016,29 @@ esp_err_t sensor_manager_init(void) {
 esp_err_t sensor_manager_deinit(void) {
     ESP_LOGI(TAG, "Deinitializing sensor manager...");
     
-    mpu6050_deinit();
+    sensor_manager_stop_raw_acquisition();
+    sensor_manager_save_calibration();
+    
+    for (uint8_t i = 0; i < accel_count; i++) {
+        mpu6050_deinit(accels[i].dev);
+        accels[i].dev = NULL;
+    }
+    accel_count = 0;
+    device_status.accel_count = 0;
+    device_status.accel_ok_mask = 0;
+    device_status.accel_calibrated_mask = 0;
+    
+    if (device_status.ds18b20_ok) {
+        temp_task_stop_wait();
+    }
     ds18b20_deinit();
+    battery_monitor_deinit();
+    
+    i2c_bus_deinit(I2C_MASTER_NUM);
+    if (secondary_bus) {
+        i2c_bus_deinit(I2C_SECONDARY_NUM);
+        secondary_bus = false;
+    }
     
     initialized = false;
     return ESP_OK;
@@ -188,48 +1058,58 @@ esp_err_t sensor_manager_read(sensor_data_t *data) {
     // Get timestamp
     data->timestamp = (uint32_t)(esp_timer_get_time() / 1000000);
     
-    // Read MPU6050
-    if (device_status.mpu6050_ok) {
+    // Read MPU6050; the raw stream already holds every sample when running
+    if (device_status.mpu6050_ok && raw_acquisition) {
+        stream_telemetry(data);
+        
+        // The FIFO carries acceleration only; gyro comes from the registers
         mpu6050_data_t mpu_data;
-        if (mpu6050_read(&mpu_data) == ESP_OK) {
-            data->accel_x = mpu_data.accel_x;
-            data->accel_y = mpu_data.accel_y;
-            data->accel_z = mpu_data.accel_z;
+        if (!mpu6050_is_accel_only(primary_accel()) &&
+            mpu6050_read(primary_accel(), &mpu_data) == ESP_OK) {
+            data->gyro_x = mpu_data.gyro_x;
+            data->gyro_y = mpu_data.gyro_y;
+            data->gyro_z = mpu_data.gyro_z;
+        }
+    } else if (device_status.mpu6050_ok) {
+        mpu6050_data_t mpu_data;
+        if (register_sample(&mpu_data) == ESP_OK) {
+            // Vibration over this and the read_vibration() samples since the last read
+            stream_telemetry(data);
             data->gyro_x = mpu_data.gyro_x;
             data->gyro_y = mpu_data.gyro_y;
             data->gyro_z = mpu_data.gyro_z;
-            
-            // Calculate vibration metrics (динамическая составляющая без гравитации)
-            data->vibration_rms = calculate_dynamic_vibration_g(data->accel_x, data->accel_y, data->accel_z);
-
-            // Peak по динамической составляющей (приближённо)
-            // Для простоты используем отклонения от оценённой гравитации через два вызова:
-            // сохраняем peak как максимум мгновенного модуля динамики.
-            data->vibration_peak = fmaxf(data->vibration_peak, data->vibration_rms);
         } else {
             error_count++;
+            accels[0].errors++;
             data->flags |= ALERT_FLAG_SENSOR_ERROR;
         }
     }
     
-    // Read DS18B20
+    // Latest completed DS18B20 conversion (never waits for one), else the
+    // MPU6050 die temperature. NAN until either has produced a reading, so
+    // alerts skip it; a failed conversion keeps the previous value
+    float temp = NAN;
+    esp_err_t temp_ret = ESP_ERR_NOT_FOUND;
     if (device_status.ds18b20_ok) {
-        float temp;
-        if (ds18b20_read_temperature(&temp) == ESP_OK) {
-            data->temperature = temp;
-        } else {
-            // Try internal MPU6050 temperature as fallback
-            mpu6050_read_temperature(&data->temperature);
-        }
-    } else {
-        // Use MPU6050 internal temperature
-        mpu6050_read_temperature(&data->temperature);
+        temp_ret = ds18b20_get_latest(0, &temp, NULL);
+    }
+    if (temp_ret != ESP_OK) {
+        die_temperature(&temp);
     }
+    data->temperature = temp;
     
-    // Read battery
+    // Cached battery state (sampled in the background)
     if (device_status.battery_ok) {
-        data->battery_voltage = read_battery_voltage();
-        data->battery_level = voltage_to_percent(data->battery_voltage);
+        battery_monitor_get(&data->battery_voltage, &data->battery_level);
+    }
+    
+    const float hours = prognosis_hours();
+    if (isnan(hours)) {
+        data->hours_to_critical = PROGNOSIS_HOURS_UNKNOWN;
+    } else if (hours < PROGNOSIS_HOURS_NONE) {
+        data->hours_to_critical = (uint16_t)hours;
+    } else {
+        data->hours_to_critical = PROGNOSIS_HOURS_NONE;
     }
     
     reading_count++;
@@ -244,8 +1124,13 @@ esp_err_t sensor_manager_read_vibration(sensor_data_t *data) {
         return ESP_ERR_INVALID_STATE;
     }
     
+    // Raw acquisition owns the stream; a register read would interleave with it
+    if (raw_acquisition) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
     mpu6050_data_t mpu_data;
-    esp_err_t ret = mpu6050_read(&mpu_data);
+    esp_err_t ret = register_sample(&mpu_data);
     if (ret != ESP_OK) {
         return ret;
     }
@@ -257,8 +1142,6 @@ esp_err_t sensor_manager_read_vibration(sensor_data_t *data) {
     data->gyro_x = mpu_data.gyro_x;
     data->gyro_y = mpu_data.gyro_y;
     data->gyro_z = mpu_data.gyro_z;
-    data->vibration_rms = calculate_dynamic_vibration_g(data->accel_x, data->accel_y, data->accel_z);
-    data->vibration_peak = fmaxf(data->vibration_peak, data->vibration_rms);
     
     return ESP_OK;
 }
@@ -269,56 +1152,64 @@ esp_err_t sensor_manager_read_temperature(float *temp) {
     }
     
     if (device_status.ds18b20_ok) {
-        return ds18b20_read_temperature(temp);
+        return ds18b20_get_latest(0, temp, NULL);
     } else {
-        return mpu6050_read_temperature(temp);
+        return die_temperature(temp);
     }
 }
 
+esp_err_t sensor_manager_read_temperature_probe(uint8_t probe, float *temp) {
+    if (!initialized || !device_status.ds18b20_ok) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    return ds18b20_get_latest(probe, temp, NULL);
+}
+
+uint8_t sensor_manager_get_temp_probe_count(void) {
+    return device_status.ds18b20_ok ? ds18b20_get_count() : 0;
+}
+
 esp_err_t sensor_manager_read_battery(uint8_t *level, float *voltage) {
     if (!initialized || !device_status.battery_ok) {
         return ESP_ERR_INVALID_STATE;
     }
     
-    float v = read_battery_voltage();
-    if (voltage) *voltage = v;
-    if (level) *level = voltage_to_percent(v);
-    
-    return ESP_OK;
+    return battery_monitor_get(voltage, level);
 }
 
-void sensor_manager_check_thresholds(sensor_data_t *data) {
-    if (!data) return;
+size_t sensor_manager_update_alerts(sensor_data_t *data, alert_event_t *events, size_t max) {
+    if (!data) return 0;
     
-    float vib_warn, vib_crit, temp_warn, temp_crit;
-    config_get_vibration_thresholds(&vib_warn, &vib_crit);
-    config_get_temp_thresholds(&temp_warn, &temp_crit);
+    alert_limits_refresh();
     
-    data->flags = ALERT_FLAG_NONE;
+    const uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    const float values[ALERT_METRIC_COUNT] = {
+        [ALERT_METRIC_VIBRATION] = data->vibration_rms,
+        [ALERT_METRIC_TEMPERATURE] = data->temperature,
+        [ALERT_METRIC_BATTERY] = data->battery_level,
+    };
+    size_t count = 0;
     
-    // Check vibration
-    if (data->vibration_rms >= vib_crit) {
-        data->flags |= ALERT_FLAG_VIBRATION_CRIT;
-        ESP_LOGW(TAG, "CRITICAL: Vibration %.2f g", data->vibration_rms);
-    } else if (data->vibration_rms >= vib_warn) {
-        data->flags |= ALERT_FLAG_VIBRATION_WARN;
-        ESP_LOGW(TAG, "WARNING: Vibration %.2f g", data->vibration_rms);
+    for (int m = 0; m < ALERT_METRIC_COUNT; m++) {
+        // No monitor means no reading, not an empty battery
+        if (m == ALERT_METRIC_BATTERY && !device_status.battery_ok) {
+            continue;
+        }
+        
+        alert_event_t event;
+        if (alert_engine_update(&alerts, (alert_metric_t)m, values[m], now_ms, &event)) {
+            alert_log_event(&event);
+            if (events && count < max) {
+                events[count++] = event;
+            }
+        }
     }
     
-    // Check temperature
-    if (data->temperature >= temp_crit) {
-        data->flags |= ALERT_FLAG_TEMP_CRIT;
-        ESP_LOGW(TAG, "CRITICAL: Temperature %.1f °C", data->temperature);
-    } else if (data->temperature >= temp_warn) {
-        data->flags |= ALERT_FLAG_TEMP_WARN;
-        ESP_LOGW(TAG, "WARNING: Temperature %.1f °C", data->temperature);
-    }
+    // Keep the read error flag; alert bits reflect the debounced levels
+    data->flags = (data->flags & ALERT_FLAG_SENSOR_ERROR) | alert_engine_flags(&alerts);
     
-    // Check battery
-    if (data->battery_level <= BATTERY_LOW_THRESHOLD) {
-        data->flags |= ALERT_FLAG_BATTERY_LOW;
-        ESP_LOGW(TAG, "WARNING: Battery low %d%%", data->battery_level);
-    }
+    return count;
 }
 
 esp_err_t sensor_manager_get_status(device_status_t *status) {
@@ -331,12 +1222,21 @@ esp_err_t sensor_manager_get_status(device_status_t *status) {
     // Update uptime
     status->uptime_seconds = (uint32_t)(esp_timer_get_time() / 1000000);
     
+    // Update sampling health
+    status->sample_jitter_us = sample_jitter_us;
+    status->sample_jitter_max_us = sample_jitter_max_us;
+    status->missed_samples = missed_samples;
+    for (uint8_t i = 0; i < accel_count; i++) {
+        status->accel_errors[i] = accels[i].errors;
+    }
+    
     // Update battery
     if (device_status.battery_ok) {
-        status->battery_voltage = read_battery_voltage();
-        status->battery_level = voltage_to_percent(status->battery_voltage);
+        battery_monitor_get(&status->battery_voltage, &status->battery_level);
     }
     
+    status->hours_to_critical = prognosis_hours();
+    
     return ESP_OK;
 }
 
@@ -345,13 +1245,15 @@ esp_err_t sensor_manager_self_test(void) {
     
     esp_err_t result = ESP_OK;
     
-    // Test MPU6050
-    if (device_status.mpu6050_ok) {
-        if (mpu6050_self_test() != ESP_OK) {
-            ESP_LOGE(TAG, "MPU6050 self-test FAILED");
+    // Test every MPU6050
+    for (uint8_t i = 0; i < accel_count; i++) {
+        if (mpu6050_self_test(accels[i].dev) != ESP_OK) {
+            ESP_LOGE(TAG, "MPU6050 #%d self-test FAILED", i);
+            device_status.accel_ok_mask &= ~(1 << i);
             result = ESP_FAIL;
         } else {
-            ESP_LOGI(TAG, "MPU6050 self-test PASSED");
+            ESP_LOGI(TAG, "MPU6050 #%d self-test PASSED", i);
+            device_status.accel_ok_mask |= (1 << i);
         }
     }
     
@@ -369,27 +1271,532 @@ esp_err_t sensor_manager_self_test(void) {
     return result;
 }
 
-void sensor_manager_calc_vibration_stats(const sensor_data_t *buffer, 
+esp_err_t sensor_manager_save_calibration(void) {
+    if (!initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    esp_err_t result = ESP_OK;
+    
+    for (uint8_t i = 0; i < accel_count; i++) {
+        accel_channel_t *ch = &accels[i];
+        mpu6050_offsets_t offsets;
+    
+        portENTER_CRITICAL(&cal_mux);
+        const bool dirty = ch->cal_dirty;
+        offsets = ch->cal_pending;
+        ch->cal_dirty = false;
+        portEXIT_CRITICAL(&cal_mux);
+    
+        if (!dirty) {
+            continue;
+        }
+    
+        // Not retried on failure: the next converged estimate writes again
+        esp_err_t ret = calibration_store_save(ch->slot, &offsets);
+        if (ret == ESP_OK) {
+            portENTER_CRITICAL(&cal_mux);
+            ch->cal_saved = offsets;
+            ch->cal_saved_valid = true;
+            portEXIT_CRITICAL(&cal_mux);
+        } else if (result == ESP_OK) {
+            result = ret;
+        }
+    }
+    
+    return result;
+}
+
+void sensor_manager_calc_vibration_stats(const sample_store_t *store, 
                                           size_t count, 
                                           vibration_stats_t *stats) {
-    if (!buffer || !stats || count == 0) return;
-    
-    float sum_sq = 0;
-    float max_val = 0;
+    if (!store || !stats) return;
     
-    for (size_t i = 0; i < count; i++) {
-        float rms = buffer[i].vibration_rms;
-        sum_sq += rms * rms;
-        if (rms > max_val) max_val = rms;
+    const size_t held = sample_store_count(store);
+    if (count > held) {
+        count = held;
     }
+    if (count == 0) return;
+    
+    memset(stats, 0, sizeof(*stats));
     
-    stats->rms = sqrtf(sum_sq / count);
-    stats->peak = max_val;
+    // Single pass per channel; each axis mean (gravity) is tracked
+    // alongside its moments
+    running_stats_t magnitude;
+    running_stats_t axis;
+    
+    channel_stats(store, SAMPLE_STORE_VIBRATION, count, &magnitude);
+    stats->rms = running_stats_rms(&magnitude);
+    stats->peak = magnitude.max;
     stats->crest_factor = (stats->rms > 0) ? (stats->peak / stats->rms) : 0;
     
-    // FFT would be calculated here in full implementation
-    stats->dominant_freq = 0;  // Placeholder
-    memset(stats->spectrum, 0, sizeof(stats->spectrum));
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        channel_stats(store, (sample_store_channel_t)a, count, &axis);
+        axis_stats_from(&axis, &stats->axis[a]);
+    }
+    
+    // Spectrum of the most recent power-of-two block (store assumed to
+    // hold consecutive samples at the current accelerometer rate)
+    uint16_t n = VIB_FFT_SIZE;
+    while (n > count && n > FFT_MIN_SIZE) {
+        n >>= 1;
+    }
+    
+    if (n > count || VIB_TARGETED_ONLY) {
+        return;
+    }
+    
+    calc_spectrum(store, n, (float)sensor_manager_get_sample_rate_hz(), stats);
+}
+
+const sample_store_t *sensor_manager_get_sample_store(void) {
+    return &vib_store;
+}
+
+esp_err_t sensor_manager_enable_data_ready(void) {
+    if (!initialized || !device_status.mpu6050_ok) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    drdy_task = xTaskGetCurrentTaskHandle();
+    drdy_period_us = 1000000 / mpu6050_get_sample_rate_hz(primary_accel());
+    drdy_last_edge_us = 0;
+    
+    gpio_config_t io_conf = {
+        .pin_bit_mask = (1ULL << MPU6050_INT_GPIO),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_ENABLE,
+        .intr_type = GPIO_INTR_POSEDGE
+    };
+    esp_err_t ret = gpio_config(&io_conf);
+    if (ret != ESP_OK) return ret;
+    
+    // Service may already be installed by another driver
+    ret = gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) return ret;
+    
+    ret = gpio_isr_handler_add(MPU6050_INT_GPIO, drdy_isr_handler, NULL);
+    if (ret != ESP_OK) return ret;
+    
+    ret = mpu6050_set_data_ready_int(primary_accel(), true);
+    if (ret != ESP_OK) {
+        gpio_isr_handler_remove(MPU6050_INT_GPIO);
+        return ret;
+    }
+    
+    ESP_LOGI(TAG, "Data-ready sampling enabled (%lu Hz)",
+             (unsigned long)mpu6050_get_sample_rate_hz(primary_accel()));
+    return ESP_OK;
+}
+
+esp_err_t sensor_manager_wait_data_ready(uint32_t timeout_ms) {
+    uint32_t pending = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+    if (pending == 0) {
+        return ESP_ERR_TIMEOUT;
+    }
+    
+    // Every edge beyond the first was a sample the task did not service
+    missed_samples += pending - 1;
+    return ESP_OK;
+}
+
+esp_err_t sensor_manager_set_accel_only(bool enable) {
+    if (!initialized || !device_status.mpu6050_ok) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // All sensors share one output rate so their sample streams line up
+    for (uint8_t i = 0; i < accel_count; i++) {
+        esp_err_t ret = mpu6050_set_accel_only(accels[i].dev, enable);
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "MPU6050 #%d failed to switch accel-only mode: %s",
+                     i, esp_err_to_name(ret));
+            return ret;
+        }
+    }
+    
+    // Output rate changed, keep jitter measurement against the new period
+    drdy_period_us = 1000000 / mpu6050_get_sample_rate_hz(primary_accel());
+    drdy_last_edge_us = 0;
+    gravity_start();
+    
+    // PSD bins are rate-dependent; restart the average
+    if (raw_acquisition) {
+#if !VIB_TARGETED_ONLY
+        psd_start();
+        envelope_start();
+#endif
+        fault_bank_start();
+        decimator_start();
+        window_stats_start();
+    }
+    
+    return ESP_OK;
+}
+
+uint32_t sensor_manager_get_sample_rate_hz(void) {
+    return accel_count > 0 ? mpu6050_get_sample_rate_hz(primary_accel()) : 0;
+}
+
+uint8_t sensor_manager_get_accel_count(void) {
+    return accel_count;
+}
+
+esp_err_t sensor_manager_start_raw_acquisition(void) {
+    if (!initialized || !device_status.mpu6050_ok) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (raw_acquisition) {
+        return ESP_OK;
+    }
+    
+    // Rings only for the sensors actually present, only while acquiring
+    raw_storage = calloc((size_t)accel_count * RAW_SAMPLE_RING_SIZE, sizeof(raw_accel_sample_t));
+    if (!raw_storage) {
+        ESP_LOGE(TAG, "No memory for %d raw sample ring(s)", accel_count);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    for (uint8_t i = 0; i < accel_count; i++) {
+        sample_ring_init(&accels[i].ring, &raw_storage[(size_t)i * RAW_SAMPLE_RING_SIZE],
+                         RAW_SAMPLE_RING_SIZE);
+        
+        esp_err_t ret = mpu6050_fifo_enable(accels[i].dev, MPU6050_FIFO_SRC_ACCEL);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "MPU6050 #%d FIFO enable failed", i);
+            while (i-- > 0) {
+                mpu6050_fifo_disable(accels[i].dev);
+            }
+            free(raw_storage);
+            raw_storage = NULL;
+            return ret;
+        }
+    }
+    
+#if !VIB_TARGETED_ONLY
+    psd_start();
+    envelope_start();
+#endif
+    fault_bank_start();
+    decimator_start();
+    window_stats_start();
+    
+    // Stream restarts: filters and telemetry aggregates start over
+    drain_last_us = 0;
+    gravity_start();
+    raw_vib_sum_sq = 0;
+    raw_vib_peak = 0;
+    raw_vib_count = 0;
+    
+    raw_acquisition = true;
+    return ESP_OK;
+}
+
+esp_err_t sensor_manager_stop_raw_acquisition(void) {
+    if (!raw_acquisition) {
+        return ESP_OK;
+    }
+    
+    raw_acquisition = false;
+    
+    esp_err_t result = ESP_OK;
+    for (uint8_t i = 0; i < accel_count; i++) {
+        esp_err_t ret = mpu6050_fifo_disable(accels[i].dev);
+        if (ret != ESP_OK) {
+            result = ret;
+        }
+    }
+    
+    free(raw_storage);
+    raw_storage = NULL;
+    
+    return result;
+}
+
+esp_err_t sensor_manager_acquire_raw(size_t *count) {
+    if (!raw_acquisition) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    size_t added = 0;
+    esp_err_t result = ESP_OK;
+    
+    // No per-sample edge here: jitter is the drain period's deviation
+    // from RAW_DRAIN_INTERVAL_MS, which bounds how full the FIFOs get
+    const int64_t now = esp_timer_get_time();
+    if (drain_last_us != 0) {
+        int64_t deviation = (now - drain_last_us) - (int64_t)RAW_DRAIN_INTERVAL_MS * 1000;
+        uint32_t jitter = (uint32_t)(deviation < 0 ? -deviation : deviation);
+        sample_jitter_us = jitter;
+        if (jitter > sample_jitter_max_us) {
+            sample_jitter_max_us = jitter;
+        }
+    }
+    drain_last_us = now;
+    
+    // Each sensor buffers in its own FIFO, so draining them back to back
+    // loses nothing as long as the whole pass fits in one FIFO depth
+    for (uint8_t s = 0; s < accel_count; s++) {
+        accel_channel_t *ch = &accels[s];
+        const uint32_t fifo_dropped = mpu6050_fifo_get_dropped_frames(ch->dev);
+        const uint32_t ring_dropped = ch->ring.dropped;
+        size_t n;
+        esp_err_t ret;
+        
+        do {
+            ret = mpu6050_fifo_read(ch->dev, raw_frames, RAW_DRAIN_CHUNK, &n);
+            for (size_t i = 0; i < n; i++) {
+                sample_ring_push(&ch->ring, raw_frames[i].accel_x_raw,
+                                 raw_frames[i].accel_y_raw, raw_frames[i].accel_z_raw);
+            }
+            if (s == 0) {
+                added += n;
+            }
+        } while (ret == ESP_OK && n == RAW_DRAIN_CHUNK);
+        
+        // Frames lost to a FIFO overflow reset or a full ring
+        missed_samples += (mpu6050_fifo_get_dropped_frames(ch->dev) - fifo_dropped) +
+                          (ch->ring.dropped - ring_dropped);
+        
+        if (ret != ESP_OK) {
+            error_count++;
+            ch->errors++;
+            result = ret;
+        }
+    }
+    
+    if (count) *count = added;
+    return result;
+}
+
+size_t sensor_manager_raw_available(uint8_t sensor) {
+    if (!raw_acquisition || sensor >= accel_count) {
+        return 0;
+    }
+    
+    return sample_ring_count(&accels[sensor].ring);
+}
+
+size_t sensor_manager_read_raw_float(uint8_t sensor, float *x, float *y, float *z, size_t max) {
+    if (!raw_acquisition || sensor >= accel_count) {
+        return 0;
+    }
+    
+    accel_calibration_t cal;
+    mpu6050_get_accel_calibration(accels[sensor].dev, &cal);
+    
+    size_t n = sample_ring_read_float(&accels[sensor].ring, &cal, x, y, z, max);
+    
+    // Reuse the converted batch for background calibration
+    if (n > 0 && x && y && z &&
+        calibration_estimator_add_block(&accels[sensor].cal_est, x, y, z, n)) {
+        calibration_update(sensor);
+    }
+    
+    // ... and for the primary sensor's PSD
+    const float *axes[3] = { x, y, z };
+    if (n > 0 && sensor == 0 && psd_ready && axes[VIB_PSD_AXIS]) {
+        welch_push(&psd, axes[VIB_PSD_AXIS], n);
+    }
+    if (n > 0 && sensor == 0 && env_ready && axes[VIB_ENV_AXIS]) {
+        envelope_push(&env, axes[VIB_ENV_AXIS], n);
+    }
+    
+    if (sensor == 0 && profile_pending) {
+        portENTER_CRITICAL(&profile_mux);
+        machine_profile = pending_profile;
+        profile_pending = false;
+        portEXIT_CRITICAL(&profile_mux);
+        
+        machine_profile_valid = true;
+        fault_bank_start();
+    }
+    if (n > 0 && sensor == 0 && fault_ready && axes[VIB_FAULT_AXIS]) {
+        goertzel_bank_push(&fault_bank, axes[VIB_FAULT_AXIS], n);
+    }
+    if (n > 0 && sensor == 0 && x && y && z) {
+        raw_vibration_push(x, y, z, n);
+    }
+    if (n > 0 && sensor == 0) {
+        window_stats_push(axes, n);
+    }
+    if (n > 0 && sensor == 0 && decim_ready) {
+        for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+            if (axes[a]) {
+                decimator_push(&decim[a], axes[a], n);
+            }
+        }
+    }
+    
+    return n;
+}
+
+esp_err_t sensor_manager_get_window_stats(bool long_window,
+                                          vibration_axis_stats_t stats[VIB_AXIS_COUNT]) {
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    const running_stats_t *done = long_window ? stats_long_done : stats_short_done;
+    if (!raw_acquisition || done[0].count == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    memset(stats, 0, VIB_AXIS_COUNT * sizeof(vibration_axis_stats_t));
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        axis_stats_from(&done[a], &stats[a]);
+    }
+    
+    return ESP_OK;
+}
+
+esp_err_t sensor_manager_get_prognosis(vibration_prognosis_t *out) {
+    if (!out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    portENTER_CRITICAL(&prognosis_mux);
+    *out = prognosis;
+    portEXIT_CRITICAL(&prognosis_mux);
+    
+    return (out->points > 0) ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+size_t sensor_manager_read_decimated(uint8_t stage, float *x, float *y, float *z, size_t max) {
+    if (!decim_ready || stage >= VIB_DECIM_STAGES) {
+        return 0;
+    }
+    
+    // Keep the axes aligned; one skipped in read_raw_float holds the others back
+    size_t n = max;
+    for (int a = 0; a < VIB_AXIS_COUNT; a++) {
+        size_t avail = decimator_available(&decim[a], stage);
+        if (avail < n) {
+            n = avail;
+        }
+    }
+    
+    decimator_read(&decim[VIB_AXIS_X], stage, x, n);
+    decimator_read(&decim[VIB_AXIS_Y], stage, y, n);
+    decimator_read(&decim[VIB_AXIS_Z], stage, z, n);
+    
+    return n;
+}
+
+float sensor_manager_get_decimated_rate_hz(uint8_t stage) {
+    if (!decim_ready || stage >= VIB_DECIM_STAGES) {
+        return 0;
+    }
+    
+    return decimator_rate_hz(&decim[0], stage);
+}
+
+esp_err_t sensor_manager_configure_psd(const welch_config_t *config) {
+    if (!config || config->segment_len > VIB_PSD_SEGMENT_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    welch_config_t previous = psd_config;
+    psd_config = *config;
+    
+    if (raw_acquisition && !psd_start()) {
+        psd_config = previous;
+        psd_start();
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    return ESP_OK;
+}
+
+size_t sensor_manager_get_psd(float *out, size_t max, float *bin_hz, uint32_t *segments) {
+    if (!out || !psd_ready || welch_segment_count(&psd) == 0) {
+        return 0;
+    }
+    
+    uint16_t bins;
+    const float *values = welch_psd(&psd, &bins);
+    size_t count = (bins < max) ? bins : max;
+    memcpy(out, values, count * sizeof(float));
+    
+    if (bin_hz) {
+        *bin_hz = welch_bin_hz(&psd);
+    }
+    if (segments) {
+        *segments = welch_segment_count(&psd);
+    }
+    
+    return count;
+}
+
+esp_err_t sensor_manager_set_machine_profile(const machine_profile_t *profile) {
+    if (!profile || profile->shaft_rpm < 0 || profile->line_hz < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    // Applied by the analysis consumer before its next batch
+    portENTER_CRITICAL(&profile_mux);
+    pending_profile = *profile;
+    profile_pending = true;
+    portEXIT_CRITICAL(&profile_mux);
+    
+    return ESP_OK;
+}
+
+esp_err_t sensor_manager_get_fault_amplitudes(fault_amplitudes_t *out) {
+    if (!out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (!fault_ready || fault_bank.blocks == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    memset(out, 0, sizeof(*out));
+    for (uint8_t i = 0; i < fault_bank.count; i++) {
+        const uint8_t t = fault_targets[i];
+        out->freq_hz[t] = fault_bank.freq_hz[i];
+        out->amplitude[t] = fault_bank.amplitude[i];
+        out->valid_mask |= (1u << t);
+    }
+    
+    return ESP_OK;
+}
+
+esp_err_t sensor_manager_get_envelope(envelope_stats_t *stats) {
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (!env_ready || env.frames == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    uint16_t bins;
+    const float *spectrum = envelope_spectrum(&env, &bins);
+    
+    float peak_bin;
+    fft_find_peak(spectrum, bins, 1, &peak_bin);
+    
+    stats->envelope_rms = env.envelope_rms;
+    stats->resolution_hz = envelope_bin_hz(&env);
+    stats->dominant_freq = peak_bin * stats->resolution_hz;
+    
+    fold_spectrum(spectrum, bins, stats->spectrum);
+    
+    // Bearing defect lines of the machine profile; zero until one is set
+    float freq[FAULT_TARGET_COUNT] = { 0 };
+    if (machine_profile_valid) {
+        fault_frequencies(&machine_profile, freq);
+    }
+    for (int i = 0; i < VIB_BEARING_TARGETS; i++) {
+        const float f = freq[FAULT_TARGET_BPFO + i];
+        stats->bearing_freq_hz[i] = f;
+        stats->bearing_amplitude[i] = line_amplitude(spectrum, bins, stats->resolution_hz, f);
+    }
+    
+    return ESP_OK;
 }
 
 void sensor_manager_set_continuous_mode(bool enable, 
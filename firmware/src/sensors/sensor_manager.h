@@ -7,6 +7,9 @@
 #define SENSOR_MANAGER_H
 
 #include "sensor_types.h"
+#include "sample_store.h"
+#include "alert_engine.h"
+#include "../dsp/welch.h"
 #include "esp_err.h"
 
 #ifdef __cplusplus
@@ -34,18 +37,37 @@ esp_err_t sensor_manager_read(sensor_data_t *data);
 
 /**
  * Read only vibration/acceleration data
+ * Without raw acquisition, feeds one register sample to the gravity
+ * filter, sample store and telemetry aggregates, as a FIFO batch would.
+ * Vibration fields are left for sensor_manager_read() to report.
  * @param data Output structure for sensor data
- * @return ESP_OK on success
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE while raw acquisition runs
  */
 esp_err_t sensor_manager_read_vibration(sensor_data_t *data);
 
 /**
  * Read only temperature data
+ * The MPU6050 die temperature is used only without a DS18B20 and outside
+ * accel-only mode.
  * @param temp Output for temperature value
- * @return ESP_OK on success
+ * @return ESP_OK on success, an error if no source has a reading
  */
 esp_err_t sensor_manager_read_temperature(float *temp);
 
+/**
+ * Read latest temperature of one DS18B20 probe
+ * @param probe Probe index (bus enumeration order)
+ * @param temp Output for temperature value
+ * @return ESP_OK on success
+ */
+esp_err_t sensor_manager_read_temperature_probe(uint8_t probe, float *temp);
+
+/**
+ * Get number of DS18B20 probes on the OneWire bus
+ * @return Probe count
+ */
+uint8_t sensor_manager_get_temp_probe_count(void);
+
 /**
  * Read battery status
  * @param level Output for battery level (0-100%)
@@ -55,10 +77,16 @@ esp_err_t sensor_manager_read_temperature(float *temp);
 esp_err_t sensor_manager_read_battery(uint8_t *level, float *voltage);
 
 /**
- * Check thresholds and set alert flags
- * @param data Sensor data to check
+ * Update debounced alerts from a published sample
+ * Sets the alert bits of data->flags from the current levels and reports
+ * level changes (also logged, rate limited). Threshold changes in the
+ * configuration take effect on the next call. Call from one task only.
+ * @param data Sensor data to check (flags updated)
+ * @param events Output for level changes, or NULL
+ * @param max Capacity of events (ALERT_METRIC_COUNT covers one call)
+ * @return Number of events stored
  */
-void sensor_manager_check_thresholds(sensor_data_t *data);
+size_t sensor_manager_update_alerts(sensor_data_t *data, alert_event_t *events, size_t max);
 
 /**
  * Get device status
@@ -74,15 +102,203 @@ esp_err_t sensor_manager_get_status(device_status_t *status);
 esp_err_t sensor_manager_self_test(void);
 
 /**
- * Calculate vibration statistics from buffer
- * @param buffer Array of sensor readings
- * @param count Number of readings
+ * Write background calibration that changed since the last save to NVS
+ * NVS writes take milliseconds, so the sampling path only marks offsets
+ * as pending; call this periodically from a low-priority task.
+ * @return ESP_OK on success, or the first NVS error
+ */
+esp_err_t sensor_manager_save_calibration(void);
+
+/**
+ * Calculate vibration statistics from a sample store
+ * Statistics and spectra stream the store's per-channel arrays directly.
+ * @param store Sample store, e.g. sensor_manager_get_sample_store()
+ * @param count Number of most recent samples to analyse
  * @param stats Output structure for statistics
  */
-void sensor_manager_calc_vibration_stats(const sensor_data_t *buffer, 
+void sensor_manager_calc_vibration_stats(const sample_store_t *store, 
                                           size_t count, 
                                           vibration_stats_t *stats);
 
+/**
+ * Get the store of recent samples
+ * Appended by sensor_manager_read() and sensor_manager_read_vibration();
+ * read it from the same task.
+ * @return Sample store at the data-ready rate
+ */
+const sample_store_t *sensor_manager_get_sample_store(void);
+
+/**
+ * Enable data-ready interrupt driven sampling
+ * Routes the MPU6050 INT pin to a GPIO ISR that notifies the calling task
+ * on every new sample. Must be called from the task that will wait.
+ * @return ESP_OK on success
+ */
+esp_err_t sensor_manager_enable_data_ready(void);
+
+/**
+ * Block until the MPU6050 signals a new sample
+ * Edges that arrive while the caller is busy are counted as missed samples.
+ * @param timeout_ms Maximum time to wait
+ * @return ESP_OK on data ready, ESP_ERR_TIMEOUT otherwise
+ */
+esp_err_t sensor_manager_wait_data_ready(uint32_t timeout_ms);
+
+/**
+ * Enable/disable accelerometer-only high-rate mode
+ * Gyroscope and MPU6050 temperature go to standby; vibration sampling
+ * runs at 1 kHz with 6-byte frames.
+ * @param enable True to enable
+ * @return ESP_OK on success
+ */
+esp_err_t sensor_manager_set_accel_only(bool enable);
+
+/**
+ * Get accelerometer output data rate
+ * @return Sample rate in Hz
+ */
+uint32_t sensor_manager_get_sample_rate_hz(void);
+
+/**
+ * Get number of detected accelerometers
+ * Index 0 is the primary sensor used for sensor_data_t readings.
+ * @return Accelerometer count
+ */
+uint8_t sensor_manager_get_accel_count(void);
+
+/**
+ * Start raw FIFO acquisition into per-accelerometer int16 sample rings
+ * While running, sensor_manager_read() takes acceleration and vibration
+ * from the stream consumed through sensor_manager_read_raw_float()
+ * (latest sample, RMS and peak since the previous read). The rings
+ * (RAW_SAMPLE_RING_SIZE samples per detected sensor) are allocated here.
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if the rings do not fit
+ */
+esp_err_t sensor_manager_start_raw_acquisition(void);
+
+/**
+ * Stop raw FIFO acquisition and release the sample rings
+ * Call from the task that drains them.
+ * @return ESP_OK on success
+ */
+esp_err_t sensor_manager_stop_raw_acquisition(void);
+
+/**
+ * Drain every MPU6050 FIFO into its raw sample ring
+ * Stores packed int16 triplets only; no float conversion is done here.
+ * @param count Optional output for number of primary-sensor samples added
+ * @return ESP_OK on success, last error if any sensor failed
+ */
+esp_err_t sensor_manager_acquire_raw(size_t *count);
+
+/**
+ * Get number of raw samples waiting in a sensor's ring
+ * @param sensor Accelerometer index
+ * @return Sample count
+ */
+size_t sensor_manager_raw_available(uint8_t sensor);
+
+/**
+ * Consume raw samples converted to acceleration (g) per axis
+ * Conversion runs in batches only when a consumer asks for floats.
+ * @param sensor Accelerometer index
+ * @param x, y, z Output arrays (any may be NULL to skip an axis)
+ * @param max Capacity of output arrays
+ * @return Number of samples converted
+ */
+size_t sensor_manager_read_raw_float(uint8_t sensor, float *x, float *y, float *z, size_t max);
+
+/**
+ * Get streaming per-axis statistics of the primary sensor
+ * Accumulated in one pass as sensor_manager_read_raw_float() consumes
+ * sensor 0; call from the same task. The long window is the exact merge
+ * of VIB_STATS_LONG_WINDOWS short ones.
+ * @param long_window false for the latest VIB_STATS_WINDOW_MS window,
+ *                    true for the latest long window
+ * @param stats Output, one entry per axis (dominant_freq is not set)
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE before the window completes
+ */
+esp_err_t sensor_manager_get_window_stats(bool long_window,
+                                          vibration_axis_stats_t stats[VIB_AXIS_COUNT]);
+
+/**
+ * Get the long-horizon trend prognosis
+ * Each completed long window adds one point per metric; linear and
+ * exponential fits over the last TREND_POINTS minutes and hours estimate
+ * when each metric reaches its critical level. Safe from any task.
+ * @param out Output
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE before the first long window
+ */
+esp_err_t sensor_manager_get_prognosis(vibration_prognosis_t *out);
+
+/**
+ * Consume the primary sensor's decimated acceleration (g) per axis
+ * Stage 0 runs at the sample rate / 10, each further stage at a tenth of
+ * the one before (VIB_DECIM_STAGES stages). Fed as
+ * sensor_manager_read_raw_float() consumes sensor 0; call from the same
+ * task. Unread samples are kept up to DECIMATOR_QUEUE_LEN per stage.
+ * @param stage Decimation stage
+ * @param x, y, z Output arrays (any may be NULL to discard an axis)
+ * @param max Capacity of output arrays
+ * @return Number of samples consumed
+ */
+size_t sensor_manager_read_decimated(uint8_t stage, float *x, float *y, float *z, size_t max);
+
+/**
+ * Get the output rate of a decimation stage
+ * @param stage Decimation stage
+ * @return Sample rate in Hz, 0 if the stage is not running
+ */
+float sensor_manager_get_decimated_rate_hz(uint8_t stage);
+
+/**
+ * Configure the Welch PSD fed by the primary sensor's raw stream
+ * Takes effect immediately and restarts the average. A sample_rate_hz of
+ * 0 uses the current accelerometer rate.
+ * @param config Segment length (<= VIB_PSD_SEGMENT_MAX), overlap, averaging
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on invalid configuration
+ */
+esp_err_t sensor_manager_configure_psd(const welch_config_t *config);
+
+/**
+ * Copy the averaged PSD of the primary sensor
+ * Updated as sensor_manager_read_raw_float() consumes sensor 0; call from
+ * the same task.
+ * @param psd Output, units g^2/Hz
+ * @param max Capacity of psd
+ * @param bin_hz Optional output, frequency resolution
+ * @param segments Optional output, segments averaged so far
+ * @return Number of bins copied (0 until the first segment completes)
+ */
+size_t sensor_manager_get_psd(float *psd, size_t max, float *bin_hz, uint32_t *segments);
+
+/**
+ * Set the monitored machine for targeted fault-frequency analysis
+ * Safe to call from any task; the Goertzel bank is rebuilt before the
+ * next raw batch of the primary sensor is analysed.
+ * @param profile Running speed, line frequency and bearing geometry
+ * @return ESP_OK on success
+ */
+esp_err_t sensor_manager_set_machine_profile(const machine_profile_t *profile);
+
+/**
+ * Get amplitudes at the machine's fault frequencies
+ * Updated once per VIB_FAULT_BLOCK_MS as sensor_manager_read_raw_float()
+ * consumes sensor 0; call from the same task.
+ * @param out Output amplitudes; targets above Nyquist are not set
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE before the first block
+ */
+esp_err_t sensor_manager_get_fault_amplitudes(fault_amplitudes_t *out);
+
+/**
+ * Get the latest envelope spectrum of the primary sensor
+ * Updated as sensor_manager_read_raw_float() consumes sensor 0; call from
+ * the same task. Bearing lines follow the machine profile, if any.
+ * @param stats Output envelope statistics
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE before the first frame
+ */
+esp_err_t sensor_manager_get_envelope(envelope_stats_t *stats);
+
 /**
  * Enable/disable continuous sampling mode
  * @param enable True to enable
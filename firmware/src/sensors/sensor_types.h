@@ -35,14 +35,18 @@ typedef struct {
     float gyro_x;               // Gyroscope X-axis (deg/s)
     float gyro_y;               // Gyroscope Y-axis (deg/s)
     float gyro_z;               // Gyroscope Z-axis (deg/s)
-    float temperature;          // Temperature (°C)
+    float temperature;          // Temperature (°C), NAN until a reading exists
     float vibration_rms;        // Calculated RMS vibration (g)
     float vibration_peak;       // Peak vibration (g)
     uint8_t battery_level;      // Battery level (0-100%)
     float battery_voltage;      // Battery voltage (V)
     uint8_t flags;              // Alert flags
+    uint16_t hours_to_critical; // Trend prognosis, see PROGNOSIS_HOURS_*
 } sensor_data_t;
 
+// Telemetry encoding of a missing temperature (centi-°C)
+#define TEMPERATURE_CENTI_UNKNOWN   INT16_MIN
+
 // ===========================================
 // MPU6050 Raw Data
 // ===========================================
@@ -56,22 +60,129 @@ typedef struct {
     int16_t temp_raw;
 } mpu6050_raw_data_t;
 
+// Packed accelerometer triplet for raw sample buffers (6 bytes)
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t z;
+} raw_accel_sample_t;
+
+// Raw-to-g conversion: g = raw / lsb_per_g - offset
+typedef struct {
+    float lsb_per_g;            // Accelerometer sensitivity (LSB/g)
+    float offset_x;             // Calibration offsets (g)
+    float offset_y;
+    float offset_z;
+} accel_calibration_t;
+
 // ===========================================
 // Vibration Statistics (for FFT/analysis)
 // ===========================================
+#define VIB_SPECTRUM_BINS           64  // Reported spectrum resolution
+
+#define VIB_AXIS_X                  0
+#define VIB_AXIS_Y                  1
+#define VIB_AXIS_Z                  2
+#define VIB_AXIS_COUNT              3
+
+// Dynamic (mean-removed) acceleration of one axis
+typedef struct {
+    float rms;                  // Root Mean Square (g)
+    float peak;                 // Largest deviation from mean (g)
+    float crest_factor;         // Peak / RMS
+    float peak_to_peak;         // Max - min (g)
+    float skewness;             // Third standardized moment
+    float kurtosis;             // Fourth standardized moment (3 = Gaussian)
+    float dominant_freq;        // Dominant frequency (Hz)
+} vibration_axis_stats_t;
+
 typedef struct {
     float rms;                  // Root Mean Square
     float peak;                 // Peak value
     float crest_factor;         // Peak / RMS
     float dominant_freq;        // Dominant frequency (Hz)
-    float spectrum[64];         // FFT spectrum bins
+    float spectrum[VIB_SPECTRUM_BINS];  // FFT spectrum bins
+    vibration_axis_stats_t axis[VIB_AXIS_COUNT];    // Per-axis X, Y, Z
 } vibration_stats_t;
 
+// Bearing defect lines read off the envelope spectrum: BPFO, BPFI, BSF,
+// FTF, i.e. FAULT_TARGET_BPFO + i
+#define VIB_BEARING_TARGETS         4
+
+// Envelope spectrum (demodulated resonance band)
+typedef struct {
+    float envelope_rms;         // AC RMS of the envelope (g)
+    float dominant_freq;        // Strongest modulation frequency (Hz)
+    float resolution_hz;        // Width of one spectrum bin before folding
+    float spectrum[VIB_SPECTRUM_BINS];  // Envelope amplitude spectrum bins (g)
+    float bearing_freq_hz[VIB_BEARING_TARGETS];     // 0 without bearing geometry
+    float bearing_amplitude[VIB_BEARING_TARGETS];   // Envelope amplitude (g) at each line
+} envelope_stats_t;
+
+// ===========================================
+// Targeted Fault Frequencies
+// ===========================================
+// Machine description pushed by the app; drives the Goertzel bank
+typedef struct {
+    float shaft_rpm;            // Running speed
+    float line_hz;              // Mains frequency, 0 if not of interest
+    uint8_t rolling_elements;   // Balls/rollers per row, 0 = no bearing targets
+    float ball_diameter_mm;
+    float pitch_diameter_mm;
+    float contact_angle_deg;
+} machine_profile_t;
+
+typedef enum {
+    FAULT_TARGET_1X = 0,
+    FAULT_TARGET_2X,
+    FAULT_TARGET_3X,
+    FAULT_TARGET_BPFO,          // Ball pass, outer race
+    FAULT_TARGET_BPFI,          // Ball pass, inner race
+    FAULT_TARGET_BSF,           // Ball spin
+    FAULT_TARGET_FTF,           // Cage (fundamental train)
+    FAULT_TARGET_LINE,
+    FAULT_TARGET_LINE_2X,
+    FAULT_TARGET_COUNT
+} fault_target_t;
+
+typedef struct {
+    float freq_hz[FAULT_TARGET_COUNT];
+    float amplitude[FAULT_TARGET_COUNT];    // Peak amplitude (g)
+    uint16_t valid_mask;        // Bit n set if target n was evaluated
+} fault_amplitudes_t;
+
+// ===========================================
+// Trend Prognosis
+// ===========================================
+// Aggregates of each long statistics window, trended over days
+typedef enum {
+    PROGNOSIS_METRIC_RMS = 0,   // AC RMS of the acceleration vector (g)
+    PROGNOSIS_METRIC_VELOCITY,  // Velocity RMS of VIB_PSD_AXIS (mm/s)
+    PROGNOSIS_METRIC_KURTOSIS,  // Largest axis kurtosis
+    PROGNOSIS_METRIC_COUNT
+} prognosis_metric_t;
+
+typedef struct {
+    float value[PROGNOSIS_METRIC_COUNT];    // Latest aggregates
+    float critical[PROGNOSIS_METRIC_COUNT]; // Thresholds the estimates refer to
+    float hours_to_critical[PROGNOSIS_METRIC_COUNT];  // INFINITY if not rising,
+                                                      // NAN until enough points
+    float velocity_band_hz[2];  // Band the velocity metric covers: 10 Hz up to
+                                // the lowest of 1 kHz, Nyquist and the DLPF corner
+    uint32_t points;            // Aggregates trended since start
+} vibration_prognosis_t;
+
+// Telemetry encoding of the shortest time to critical (whole hours)
+#define PROGNOSIS_HOURS_UNKNOWN     0xFFFF  // Fewer than TREND_MIN_POINTS windows yet
+#define PROGNOSIS_HOURS_NONE        0xFFFE  // Not rising, or beyond the range
+
 // ===========================================
 // Device Status
 // ===========================================
+#define SENSOR_MAX_ACCELEROMETERS   4   // 2 addresses x 2 I2C buses
+
 typedef struct {
-    bool mpu6050_ok;
+    bool mpu6050_ok;            // Primary accelerometer present
     bool ds18b20_ok;
     bool battery_ok;
     uint8_t battery_level;
@@ -80,6 +191,17 @@ typedef struct {
     uint32_t uptime_seconds;
     uint32_t readings_count;
     uint32_t errors_count;
+    uint32_t sample_jitter_us;      // Last data-ready period deviation, or FIFO
+                                    // drain period deviation in raw mode (us)
+    uint32_t sample_jitter_max_us;  // Worst of the above (us)
+    uint32_t missed_samples;        // Data-ready edges not serviced in time, or
+                                    // frames lost to FIFO/ring overflow (all sensors)
+    uint8_t accel_count;            // Accelerometers detected
+    uint8_t accel_ok_mask;          // Bit n set if accelerometer n is healthy
+    uint8_t accel_calibrated_mask;  // Bit n set if accelerometer n has offsets
+    uint8_t temp_probe_count;       // DS18B20 sensors on the OneWire bus
+    uint32_t accel_errors[SENSOR_MAX_ACCELEROMETERS]; // Per-accelerometer read errors
+    float hours_to_critical;        // Shortest trend prognosis (INFINITY none, NAN unknown)
 } device_status_t;
 
 #ifdef __cplusplus
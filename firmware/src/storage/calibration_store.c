@@ -0,0 +1,145 @@
+/**
+ * VibeMon Calibration Store Implementation
+ * One versioned blob per sensor slot in the device namespace.
+ */
+
+#include "calibration_store.h"
+#include "../config.h"
+
+#include <stdio.h>
+#include <math.h>
+#include "nvs.h"
+#include "esp_log.h"
+
+static const char *TAG = "CAL_STORE";
+
+// ===========================================
+// Constants
+// ===========================================
+#define CAL_STORE_VERSION       1
+#define CAL_STORE_ACCEL_MAX_G   0.5f    // Larger bias means a bad record
+#define CAL_STORE_GYRO_MAX_DPS  50.0f
+
+// ===========================================
+// Private Types
+// ===========================================
+typedef struct {
+    uint32_t version;
+    mpu6050_offsets_t offsets;
+} calibration_record_t;
+
+// ===========================================
+// Private Functions
+// ===========================================
+
+static void slot_key(uint8_t slot, char *key, size_t len) {
+    snprintf(key, len, "mpu_cal%u", slot);
+}
+
+static bool offset_valid(float value, float limit) {
+    return isfinite(value) && fabsf(value) <= limit;
+}
+
+static bool record_valid(const calibration_record_t *rec) {
+    const mpu6050_offsets_t *o = &rec->offsets;
+    
+    return rec->version == CAL_STORE_VERSION &&
+           offset_valid(o->accel_x, CAL_STORE_ACCEL_MAX_G) &&
+           offset_valid(o->accel_y, CAL_STORE_ACCEL_MAX_G) &&
+           offset_valid(o->accel_z, CAL_STORE_ACCEL_MAX_G) &&
+           offset_valid(o->gyro_x, CAL_STORE_GYRO_MAX_DPS) &&
+           offset_valid(o->gyro_y, CAL_STORE_GYRO_MAX_DPS) &&
+           offset_valid(o->gyro_z, CAL_STORE_GYRO_MAX_DPS);
+}
+
+// ===========================================
+// Public Functions
+// ===========================================
+
+esp_err_t calibration_store_load(uint8_t slot, mpu6050_offsets_t *offsets) {
+    if (!offsets) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
+    if (ret != ESP_OK) {
+        // Namespace does not exist before the first save
+        return ESP_ERR_NOT_FOUND;
+    }
+    
+    char key[16];
+    slot_key(slot, key, sizeof(key));
+    
+    calibration_record_t rec;
+    size_t len = sizeof(rec);
+    ret = nvs_get_blob(handle, key, &rec, &len);
+    nvs_close(handle);
+    
+    if (ret != ESP_OK || len != sizeof(rec) || !record_valid(&rec)) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    
+    *offsets = rec.offsets;
+    return ESP_OK;
+}
+
+esp_err_t calibration_store_save(uint8_t slot, const mpu6050_offsets_t *offsets) {
+    if (!offsets) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    calibration_record_t rec = {
+        .version = CAL_STORE_VERSION,
+        .offsets = *offsets,
+    };
+    
+    if (!record_valid(&rec)) {
+        ESP_LOGW(TAG, "Refusing to store out-of-range offsets for slot %u", slot);
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    char key[16];
+    slot_key(slot, key, sizeof(key));
+    
+    ret = nvs_set_blob(handle, key, &rec, sizeof(rec));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Saved calibration for slot %u", slot);
+    } else {
+        ESP_LOGE(TAG, "Failed to save calibration for slot %u: %s", slot, esp_err_to_name(ret));
+    }
+    
+    return ret;
+}
+
+esp_err_t calibration_store_erase(uint8_t slot) {
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    char key[16];
+    slot_key(slot, key, sizeof(key));
+    
+    ret = nvs_erase_key(handle, key);
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    } else if (ret == ESP_ERR_NVS_NOT_FOUND) {
+        ret = ESP_OK;
+    }
+    nvs_close(handle);
+    
+    return ret;
+}
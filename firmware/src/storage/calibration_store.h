@@ -0,0 +1,45 @@
+/**
+ * VibeMon Calibration Store Header
+ * Persists accelerometer/gyro offsets in NVS so they survive reboot and
+ * deep sleep.
+ */
+
+#ifndef CALIBRATION_STORE_H
+#define CALIBRATION_STORE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "../sensors/mpu6050.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Load stored offsets for a sensor slot
+ * @param slot Sensor slot (fixed bus/address position)
+ * @param offsets Output offsets
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND if nothing valid is stored
+ */
+esp_err_t calibration_store_load(uint8_t slot, mpu6050_offsets_t *offsets);
+
+/**
+ * Save offsets for a sensor slot
+ * @param slot Sensor slot
+ * @param offsets Offsets to store
+ * @return ESP_OK on success
+ */
+esp_err_t calibration_store_save(uint8_t slot, const mpu6050_offsets_t *offsets);
+
+/**
+ * Erase stored offsets for a sensor slot
+ * @param slot Sensor slot
+ * @return ESP_OK on success
+ */
+esp_err_t calibration_store_erase(uint8_t slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CALIBRATION_STORE_H
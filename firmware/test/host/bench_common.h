@@ -0,0 +1,64 @@
+/**
+ * VibeMon Host Benchmark Helpers
+ * Wall-clock timing for the host-built benchmarks. Each measurement
+ * repeats a block until it has run for BENCH_MIN_NS and keeps the best
+ * of BENCH_ROUNDS rounds, so one-off scheduling noise drops out. Host
+ * numbers rank implementations; target cycle counts need the hardware.
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+#define BENCH_ROUNDS    5
+#define BENCH_MIN_NS    20000000ull     // 20 ms per round
+#define BENCH_BATCH     16              // Iterations between clock reads
+
+// Results land here so the compiler cannot drop the timed work
+static volatile float bench_sink;
+
+// Deterministic uniform noise in [-1, 1), as test_rand()
+static inline void bench_fill(float *x, size_t n, uint32_t seed) {
+    for (size_t i = 0; i < n; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        x[i] = (float)((int32_t)seed) / 2147483648.0f;
+    }
+}
+
+static inline uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Time one iteration of a block
+ * @param ns_out double receiving the best nanoseconds per iteration
+ * @param ... Statements to time; may run many thousands of times
+ */
+#define BENCH(ns_out, ...) do {                                             \
+    double best_ = 1e300;                                                   \
+    for (int r_ = 0; r_ < BENCH_ROUNDS; r_++) {                             \
+        uint64_t iters_ = 0;                                                \
+        const uint64_t start_ = bench_now_ns();                             \
+        uint64_t elapsed_;                                                  \
+        do {                                                                \
+            for (int b_ = 0; b_ < BENCH_BATCH; b_++) {                      \
+                __VA_ARGS__;                                                \
+            }                                                               \
+            iters_ += BENCH_BATCH;                                          \
+            elapsed_ = bench_now_ns() - start_;                             \
+        } while (elapsed_ < BENCH_MIN_NS);                                  \
+        const double per_ = (double)elapsed_ / (double)iters_;              \
+        if (per_ < best_) best_ = per_;                                     \
+    }                                                                       \
+    (ns_out) = best_;                                                       \
+} while (0)
+
+#endif // BENCH_COMMON_H
@@ -0,0 +1,40 @@
+/**
+ * Decimator throughput: input samples per second through one axis of the
+ * cascade at each stage count, fed in raw-drain sized blocks. The
+ * firmware runs three axes at 1 kHz, so 3000 samples/s is real time.
+ */
+
+#include "bench_common.h"
+#include "decimator.h"
+
+#define BLOCK       64              // Samples per decimator_push(), one drain batch
+#define INPUT_LEN   (BLOCK * 64)
+
+static float input[INPUT_LEN];
+static decimator_t dec;
+
+int main(void) {
+    bench_fill(input, INPUT_LEN, 1);
+    
+    double ns;
+    size_t offset = 0;
+    
+    printf("%-8s %14s %16s %12s\n", "stages", "ns/sample", "samples/s", "x real time");
+    for (uint8_t stages = 1; stages <= DECIMATOR_MAX_STAGES; stages++) {
+        decimator_init(&dec, 1000.0f, stages);
+    
+        // Outputs are drained as the firmware does, so queues never overrun
+        BENCH(ns, decimator_push(&dec, &input[offset], BLOCK);
+              offset = (offset + BLOCK) % INPUT_LEN;
+              for (uint8_t s = 0; s < stages; s++) {
+                  decimator_read(&dec, s, NULL, DECIMATOR_QUEUE_LEN);
+              });
+    
+        const double per_sample = ns / BLOCK;
+        const double rate = 1e9 / per_sample;
+        printf("%-8u %14.2f %16.0f %12.0f\n", stages, per_sample, rate, rate / 3000.0);
+    }
+    
+    bench_sink += dec.stage[0].history[0];
+    return 0;
+}
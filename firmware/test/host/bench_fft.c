@@ -0,0 +1,54 @@
+/**
+ * FFT benchmark: time per transform of the real float, paired float and
+ * Q15 real transforms at 256, 512, 1024 and 2048 points. Each transform
+ * works in place, so every call restarts from a copy of the input.
+ */
+
+#include "bench_common.h"
+#include "fft.h"
+
+#include <string.h>
+#include <math.h>
+
+static float input[2 * FFT_MAX_SIZE], work[2 * FFT_MAX_SIZE];
+static int16_t input_q15[FFT_MAX_SIZE], work_q15[FFT_MAX_SIZE];
+
+static void row(const char *transform, uint16_t n, double ns) {
+    const double log2n = log2((double)n);
+    printf("%-18s %6u %14.1f %14.3f\n", transform, n, ns, ns / (n * log2n));
+}
+
+int main(void) {
+    bench_fill(input, 2 * FFT_MAX_SIZE, 1);
+    for (size_t i = 0; i < FFT_MAX_SIZE; i++) {
+        input_q15[i] = (int16_t)(input[i] * 16384.0f);
+    }
+    
+    static const uint16_t sizes[] = { 256, 512, 1024, 2048 };
+    double ns;
+    
+    printf("%-18s %6s %14s %14s\n", "transform", "n", "ns/transform", "ns/(n log2n)");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        const uint16_t n = sizes[s];
+        fft_plan_t plan;
+        fft_plan_init(&plan, n, FFT_WINDOW_RECT, NULL, NULL);
+    
+        BENCH(ns, memcpy(work, input, n * sizeof(float));
+              fft_real_f32(&plan, work); bench_sink += work[1]);
+        row("fft_real_f32", n, ns);
+    
+        BENCH(ns, memcpy(work, input, 2 * n * sizeof(float));
+              fft_real_pair_f32(&plan, work); bench_sink += work[1]);
+        row("fft_real_pair_f32", n, ns);
+    
+        BENCH(ns, memcpy(work_q15, input_q15, n * sizeof(int16_t));
+              fft_real_q15(&plan, work_q15); bench_sink += work_q15[1]);
+        row("fft_real_q15", n, ns);
+    
+        BENCH(ns, memcpy(work, input, 2 * n * sizeof(float));
+              fft_complex_f32(work, n); bench_sink += work[1]);
+        row("fft_complex_f32", n, ns);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * Sample store layout benchmark: the firmware's statistics pass over the
+ * latest n samples, reading one contiguous channel of the structure-of-
+ * arrays store against walking a ring of whole sensor_data_t records for
+ * the same field, plus the cost of appending one sample to each.
+ */
+
+#include "bench_common.h"
+#include "sample_store.h"
+#include "sensor_types.h"
+#include "running_stats.h"
+
+#include <stddef.h>
+
+#define CAPACITY    4096
+
+static float store_data[SAMPLE_STORE_STORAGE_SIZE(CAPACITY)]
+    __attribute__((aligned(SAMPLE_STORE_ALIGN)));
+static sample_store_t store;
+
+// Record ring as the analysis used to keep it
+static sensor_data_t records[CAPACITY];
+static size_t record_head;
+
+static float noise[CAPACITY * SAMPLE_STORE_CHANNELS];
+
+// One channel's statistics over the latest n samples, as channel_stats()
+static float soa_stats(sample_store_channel_t channel, size_t n) {
+    const float *run1, *run2;
+    size_t len1;
+    const size_t got = sample_store_latest(&store, channel, n, &run1, &len1, &run2);
+    running_stats_t s;
+    
+    running_stats_reset(&s);
+    running_stats_add_block(&s, run1, len1);
+    running_stats_add_block(&s, run2, got - len1);
+    return running_stats_rms(&s);
+}
+
+// The same pass reading one field out of each record
+static float aos_stats(size_t field_offset, size_t n) {
+    running_stats_t s;
+    
+    running_stats_reset(&s);
+    for (size_t i = 0; i < n; i++) {
+        const char *r = (const char *)&records[(record_head - n + i) & (CAPACITY - 1)];
+        running_stats_add(&s, *(const float *)(r + field_offset));
+    }
+    return running_stats_rms(&s);
+}
+
+static float soa_axes(size_t n) {
+    return soa_stats(SAMPLE_STORE_ACCEL_X, n) + soa_stats(SAMPLE_STORE_ACCEL_Y, n) +
+           soa_stats(SAMPLE_STORE_ACCEL_Z, n);
+}
+
+static float aos_axes(size_t n) {
+    return aos_stats(offsetof(sensor_data_t, accel_x), n) +
+           aos_stats(offsetof(sensor_data_t, accel_y), n) +
+           aos_stats(offsetof(sensor_data_t, accel_z), n);
+}
+
+static void record_push(const float *v) {
+    sensor_data_t *r = &records[record_head++ & (CAPACITY - 1)];
+    r->accel_x = v[SAMPLE_STORE_ACCEL_X];
+    r->accel_y = v[SAMPLE_STORE_ACCEL_Y];
+    r->accel_z = v[SAMPLE_STORE_ACCEL_Z];
+    r->vibration_rms = v[SAMPLE_STORE_VIBRATION];
+}
+
+static void row(const char *pass, size_t n, double soa_ns, double aos_ns) {
+    printf("%-22s %6zu %12.1f %12.1f %8.2fx\n", pass, n, soa_ns, aos_ns, aos_ns / soa_ns);
+}
+
+int main(void) {
+    bench_fill(noise, CAPACITY * SAMPLE_STORE_CHANNELS, 1);
+    sample_store_init(&store, store_data, CAPACITY);
+    
+    // Offset the head so the latest samples wrap, as in steady state
+    const size_t fill = CAPACITY + CAPACITY / 3;
+    for (size_t i = 0; i < fill; i++) {
+        const float *v = &noise[(i % CAPACITY) * SAMPLE_STORE_CHANNELS];
+        sample_store_push(&store, v);
+        record_push(v);
+    }
+    
+    static const size_t sizes[] = { 256, 1024, 4096 };
+    double soa_ns, aos_ns;
+    size_t k = 0;
+    
+    printf("sizeof(sensor_data_t) = %zu bytes\n", sizeof(sensor_data_t));
+    printf("%-22s %6s %12s %12s %9s\n", "pass", "n", "SoA ns", "records ns", "speedup");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        const size_t n = sizes[s];
+    
+        BENCH(soa_ns, bench_sink += soa_stats(SAMPLE_STORE_VIBRATION, n));
+        BENCH(aos_ns, bench_sink += aos_stats(offsetof(sensor_data_t, vibration_rms), n));
+        row("magnitude stats", n, soa_ns, aos_ns);
+    
+        BENCH(soa_ns, bench_sink += soa_axes(n));
+        BENCH(aos_ns, bench_sink += aos_axes(n));
+        row("per-axis stats", n, soa_ns, aos_ns);
+    }
+    
+    // Appends rotate through the noise so the head keeps moving
+    BENCH(soa_ns, sample_store_push(&store, &noise[(k++ & (CAPACITY - 1)) * SAMPLE_STORE_CHANNELS]));
+    BENCH(aos_ns, record_push(&noise[(k++ & (CAPACITY - 1)) * SAMPLE_STORE_CHANNELS]));
+    row("append one sample", 1, soa_ns, aos_ns);
+    
+    return 0;
+}
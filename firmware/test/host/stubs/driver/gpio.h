@@ -0,0 +1,45 @@
+/**
+ * Host stub: GPIO calls used by the bit-bang OneWire fallback
+ * The host tests drive the OneWire bus through the RMT backend instead,
+ * so these only need to compile and leave the line idle (high).
+ */
+
+#ifndef HOST_STUB_GPIO_H
+#define HOST_STUB_GPIO_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum {
+    GPIO_MODE_INPUT = 1,
+    GPIO_MODE_OUTPUT = 2
+} gpio_mode_t;
+
+typedef enum {
+    GPIO_PULLUP_DISABLE = 0,
+    GPIO_PULLUP_ENABLE
+} gpio_pullup_t;
+
+typedef enum {
+    GPIO_PULLDOWN_DISABLE = 0,
+    GPIO_PULLDOWN_ENABLE
+} gpio_pulldown_t;
+
+typedef enum {
+    GPIO_INTR_DISABLE = 0
+} gpio_int_type_t;
+
+typedef struct {
+    uint64_t pin_bit_mask;
+    gpio_mode_t mode;
+    gpio_pullup_t pull_up_en;
+    gpio_pulldown_t pull_down_en;
+    gpio_int_type_t intr_type;
+} gpio_config_t;
+
+static inline esp_err_t gpio_config(const gpio_config_t *config) { (void)config; return ESP_OK; }
+static inline esp_err_t gpio_set_direction(int gpio, gpio_mode_t mode) { (void)gpio; (void)mode; return ESP_OK; }
+static inline esp_err_t gpio_set_level(int gpio, uint32_t level) { (void)gpio; (void)level; return ESP_OK; }
+static inline int gpio_get_level(int gpio) { (void)gpio; return 1; }
+
+#endif // HOST_STUB_GPIO_H
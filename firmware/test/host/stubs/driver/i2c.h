@@ -0,0 +1,13 @@
+/**
+ * Host stub: I2C port numbers
+ */
+
+#ifndef HOST_STUB_I2C_H
+#define HOST_STUB_I2C_H
+
+typedef int i2c_port_t;
+
+#define I2C_NUM_0   0
+#define I2C_NUM_1   1
+
+#endif // HOST_STUB_I2C_H
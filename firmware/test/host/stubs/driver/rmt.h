@@ -0,0 +1,15 @@
+/**
+ * Host stub: RMT channel numbers
+ */
+
+#ifndef HOST_STUB_RMT_H
+#define HOST_STUB_RMT_H
+
+typedef enum {
+    RMT_CHANNEL_0 = 0,
+    RMT_CHANNEL_1,
+    RMT_CHANNEL_2,
+    RMT_CHANNEL_3
+} rmt_channel_t;
+
+#endif // HOST_STUB_RMT_H
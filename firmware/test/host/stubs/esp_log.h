@@ -0,0 +1,18 @@
+/**
+ * Host stub: logging compiles away (arguments are still type-checked)
+ */
+
+#ifndef HOST_STUB_ESP_LOG_H
+#define HOST_STUB_ESP_LOG_H
+
+#include <stdio.h>
+
+#define HOST_LOG_NONE(tag, ...) do { if (0) { (void)(tag); printf(__VA_ARGS__); } } while (0)
+
+#define ESP_LOGE(tag, ...)  HOST_LOG_NONE(tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...)  HOST_LOG_NONE(tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...)  HOST_LOG_NONE(tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...)  HOST_LOG_NONE(tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...)  HOST_LOG_NONE(tag, __VA_ARGS__)
+
+#endif // HOST_STUB_ESP_LOG_H
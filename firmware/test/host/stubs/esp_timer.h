@@ -0,0 +1,12 @@
+/**
+ * Host stub: microsecond timer backed by the simulated clock (host_clock.c)
+ */
+
+#ifndef HOST_STUB_ESP_TIMER_H
+#define HOST_STUB_ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
+
+#endif // HOST_STUB_ESP_TIMER_H
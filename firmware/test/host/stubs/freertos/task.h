@@ -0,0 +1,12 @@
+/**
+ * Host stub: task delays advance the simulated clock (host_clock.c)
+ */
+
+#ifndef HOST_STUB_TASK_H
+#define HOST_STUB_TASK_H
+
+#include "freertos/FreeRTOS.h"
+
+void vTaskDelay(TickType_t ticks);
+
+#endif // HOST_STUB_TASK_H
@@ -0,0 +1,25 @@
+/**
+ * Host simulated clock
+ */
+
+#include "host_clock.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+static int64_t now_us = 1;
+
+void host_clock_advance_us(int64_t us) {
+    now_us += us;
+}
+
+int64_t host_clock_now_us(void) {
+    return now_us;
+}
+
+int64_t esp_timer_get_time(void) {
+    return now_us++;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    now_us += (int64_t)ticks * portTICK_PERIOD_MS * 1000;
+}
@@ -0,0 +1,15 @@
+/**
+ * Host simulated clock
+ * Time only moves when a test advances it or the code under test delays,
+ * plus 1 us per read so busy-wait loops terminate.
+ */
+
+#ifndef HOST_CLOCK_H
+#define HOST_CLOCK_H
+
+#include <stdint.h>
+
+void host_clock_advance_us(int64_t us);
+int64_t host_clock_now_us(void);
+
+#endif // HOST_CLOCK_H
@@ -0,0 +1,169 @@
+/**
+ * Alert engine: levels are raised only after the raise dwell, values
+ * hovering inside the hysteresis band neither raise nor clear, clearing
+ * takes the clear dwell, falling metrics mirror rising ones, and the
+ * log limiter drops lines beyond its burst.
+ */
+
+#include "test_common.h"
+#include "alert_engine.h"
+#include "sensor_types.h"
+
+static alert_engine_t engine;
+
+static const alert_limits_t vibration = {
+    .warning = 1.0f,
+    .critical = 2.0f,
+    .hysteresis = 0.2f,
+    .raise_dwell_ms = 3000,
+    .clear_dwell_ms = 10000,
+    .falling = false,
+};
+
+// Feed one value per second from t_ms, returning the number of changes
+static int feed(alert_metric_t metric, float value, uint32_t *t_ms, int seconds,
+                alert_event_t *last) {
+    int changes = 0;
+    for (int i = 0; i < seconds; i++) {
+        alert_event_t ev;
+        if (alert_engine_update(&engine, metric, value, *t_ms, &ev)) {
+            changes++;
+            if (last) {
+                *last = ev;
+            }
+        }
+        *t_ms += 1000;
+    }
+    return changes;
+}
+
+static void test_raise_dwell(void) {
+    alert_engine_reset(&engine);
+    CHECK(alert_engine_set_limits(&engine, ALERT_METRIC_VIBRATION, &vibration));
+    
+    uint32_t t = 0;
+    alert_event_t ev;
+    
+    // A 2 s excursion is shorter than the dwell
+    CHECK(feed(ALERT_METRIC_VIBRATION, 1.5f, &t, 3, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 0.5f, &t, 1, NULL) == 0);
+    CHECK(alert_engine_level(&engine, ALERT_METRIC_VIBRATION) == ALERT_LEVEL_NORMAL);
+    
+    // The dwell restarts after the dip: raised on the fourth sample (3 s)
+    CHECK(feed(ALERT_METRIC_VIBRATION, 1.5f, &t, 3, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 1.5f, &t, 1, &ev) == 1);
+    CHECK(ev.from == ALERT_LEVEL_NORMAL && ev.to == ALERT_LEVEL_WARNING);
+    CHECK(ev.time_ms == t - 1000);
+    CHECK(alert_engine_flags(&engine) == ALERT_FLAG_VIBRATION_WARN);
+    
+    // Warning to critical on the way up keeps the dwell going
+    alert_engine_reset(&engine);
+    CHECK(alert_engine_set_limits(&engine, ALERT_METRIC_VIBRATION, &vibration));
+    t = 0;
+    CHECK(feed(ALERT_METRIC_VIBRATION, 1.5f, &t, 2, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 2.5f, &t, 2, &ev) == 1);
+    CHECK(ev.from == ALERT_LEVEL_NORMAL && ev.to == ALERT_LEVEL_CRITICAL);
+}
+
+static void test_hysteresis(void) {
+    alert_engine_reset(&engine);
+    CHECK(alert_engine_set_limits(&engine, ALERT_METRIC_VIBRATION, &vibration));
+    
+    uint32_t t = 0;
+    alert_event_t ev;
+    CHECK(feed(ALERT_METRIC_VIBRATION, 1.2f, &t, 5, NULL) == 1);
+    
+    // Hovering just below the limit, inside the band, holds the level
+    CHECK(feed(ALERT_METRIC_VIBRATION, 0.85f, &t, 30, NULL) == 0);
+    CHECK(alert_engine_level(&engine, ALERT_METRIC_VIBRATION) == ALERT_LEVEL_WARNING);
+    
+    // Chatter across the limit produces no events either way
+    for (int i = 0; i < 20; i++) {
+        CHECK(feed(ALERT_METRIC_VIBRATION, (i & 1) ? 1.05f : 0.95f, &t, 1, NULL) == 0);
+    }
+    
+    // Below the band: cleared after the clear dwell (10 s), not before
+    CHECK(feed(ALERT_METRIC_VIBRATION, 0.7f, &t, 10, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 0.7f, &t, 1, &ev) == 1);
+    CHECK(ev.from == ALERT_LEVEL_WARNING && ev.to == ALERT_LEVEL_NORMAL);
+    CHECK(alert_engine_flags(&engine) == ALERT_FLAG_NONE);
+    
+    // An excursion back into the band restarts the clear dwell
+    CHECK(feed(ALERT_METRIC_VIBRATION, 1.2f, &t, 4, NULL) == 1);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 0.7f, &t, 8, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 0.9f, &t, 1, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 0.7f, &t, 10, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 0.7f, &t, 1, NULL) == 1);
+}
+
+static void test_falling_metric(void) {
+    const alert_limits_t battery = {
+        .warning = 20.0f,
+        .critical = 10.0f,
+        .hysteresis = 5.0f,
+        .raise_dwell_ms = 0,
+        .clear_dwell_ms = 2000,
+        .falling = true,
+    };
+    alert_engine_reset(&engine);
+    CHECK(alert_engine_set_limits(&engine, ALERT_METRIC_BATTERY, &battery));
+    
+    uint32_t t = 0;
+    CHECK(feed(ALERT_METRIC_BATTERY, 50.0f, &t, 2, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_BATTERY, 9.0f, &t, 1, NULL) == 1);
+    CHECK(alert_engine_level(&engine, ALERT_METRIC_BATTERY) == ALERT_LEVEL_CRITICAL);
+    CHECK(alert_engine_flags(&engine) == ALERT_FLAG_BATTERY_LOW);
+    
+    // Charging to 12 % stays inside the critical band (< 15 %)
+    CHECK(feed(ALERT_METRIC_BATTERY, 12.0f, &t, 5, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_BATTERY, 30.0f, &t, 3, NULL) == 1);
+    CHECK(alert_engine_level(&engine, ALERT_METRIC_BATTERY) == ALERT_LEVEL_NORMAL);
+    
+    // Inconsistent limits are refused
+    alert_limits_t bad = battery;
+    bad.critical = 30.0f;
+    CHECK(!alert_engine_set_limits(&engine, ALERT_METRIC_BATTERY, &bad));
+    bad = vibration;
+    bad.hysteresis = -1.0f;
+    CHECK(!alert_engine_set_limits(&engine, ALERT_METRIC_VIBRATION, &bad));
+}
+
+static void test_disabled_and_wrap(void) {
+    alert_engine_reset(&engine);
+    uint32_t t = 0;
+    CHECK(feed(ALERT_METRIC_TEMPERATURE, 500.0f, &t, 10, NULL) == 0);
+    
+    // Dwell timing survives the millisecond counter wrapping
+    CHECK(alert_engine_set_limits(&engine, ALERT_METRIC_VIBRATION, &vibration));
+    t = UINT32_MAX - 1500;
+    CHECK(feed(ALERT_METRIC_VIBRATION, 1.5f, &t, 3, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, NAN, &t, 1, NULL) == 0);
+    CHECK(feed(ALERT_METRIC_VIBRATION, 1.5f, &t, 1, NULL) == 1);
+}
+
+static void test_log_limiter(void) {
+    alert_log_limiter_t lim;
+    alert_log_limiter_init(&lim, 3, 1000);
+    
+    uint32_t suppressed = 99;
+    int allowed = 0;
+    for (uint32_t t = 0; t < 500; t += 50) {
+        allowed += alert_log_allow(&lim, t, &suppressed);
+    }
+    CHECK(allowed == 3);
+    
+    // The first line of the next window reports what was dropped
+    CHECK(alert_log_allow(&lim, 1000, &suppressed));
+    CHECK(suppressed == 7);
+    CHECK(alert_log_allow(&lim, 1001, &suppressed));
+    CHECK(suppressed == 0);
+}
+
+int main(void) {
+    TEST_RUN(test_raise_dwell);
+    TEST_RUN(test_hysteresis);
+    TEST_RUN(test_falling_metric);
+    TEST_RUN(test_disabled_and_wrap);
+    TEST_RUN(test_log_limiter);
+    TEST_EXIT();
+}
@@ -0,0 +1,241 @@
+/**
+ * Biquad filters: designed magnitude response against the analytic
+ * transfer function, measured sine and step response of float sections
+ * and cascades, priming, and the Q31 path against the float one.
+ */
+
+#include "test_common.h"
+#include "biquad.h"
+
+#define FS_HZ           1000.0f
+#define LEN             4000
+
+static float fin[LEN], fout[LEN];
+static int32_t qin[LEN], qout[LEN];
+
+// |H(e^jw)| of one section at freq_hz
+static double section_gain(const biquad_coeffs_t *c, double freq_hz) {
+    const double w = 2 * M_PI * freq_hz / FS_HZ;
+    const double nr = c->b0 + c->b1 * cos(w) + c->b2 * cos(2 * w);
+    const double ni = -c->b1 * sin(w) - c->b2 * sin(2 * w);
+    const double dr = 1 + c->a1 * cos(w) + c->a2 * cos(2 * w);
+    const double di = -c->a1 * sin(w) - c->a2 * sin(2 * w);
+    return hypot(nr, ni) / hypot(dr, di);
+}
+
+static double cascade_gain(const biquad_coeffs_t *c, uint8_t count, double freq_hz) {
+    double g = 1;
+    for (uint8_t i = 0; i < count; i++) {
+        g *= section_gain(&c[i], freq_hz);
+    }
+    return g;
+}
+
+// Amplitude of the settled output (second half) at freq_hz
+static double tone_amplitude(const float *y, double freq_hz) {
+    double c = 0, s = 0;
+    for (size_t t = LEN / 2; t < LEN; t++) {
+        c += y[t] * cos(2 * M_PI * freq_hz * t / FS_HZ);
+        s += y[t] * sin(2 * M_PI * freq_hz * t / FS_HZ);
+    }
+    return 2 * hypot(c, s) / (LEN / 2);
+}
+
+static void test_design(void) {
+    biquad_coeffs_t c[BIQUAD_MAX_SECTIONS];
+    CHECK(!biquad_design_lowpass(c, FS_HZ, 0, BIQUAD_Q_BUTTERWORTH));
+    CHECK(!biquad_design_lowpass(c, FS_HZ, 500, BIQUAD_Q_BUTTERWORTH));
+    CHECK(!biquad_design_highpass(c, FS_HZ, 50, 0));
+    CHECK(!biquad_design_bandpass(c, FS_HZ, 200, 100));
+    CHECK(!biquad_design_butterworth(c, BIQUAD_MAX_SECTIONS + 1, BIQUAD_LOWPASS, FS_HZ, 50));
+    
+    // Butterworth: unity in the passband, -3 dB at the corner
+    CHECK(biquad_design_lowpass(c, FS_HZ, 50, BIQUAD_Q_BUTTERWORTH));
+    CHECK_NEAR(section_gain(c, 0), 1.0, 1e-5);
+    CHECK_NEAR(section_gain(c, 50), M_SQRT1_2, 1e-4);
+    CHECK(section_gain(c, 200) < 0.07);
+    
+    CHECK(biquad_design_highpass(c, FS_HZ, 50, BIQUAD_Q_BUTTERWORTH));
+    CHECK_NEAR(section_gain(c, 0), 0.0, 1e-5);
+    CHECK_NEAR(section_gain(c, 50), M_SQRT1_2, 1e-4);
+    CHECK_NEAR(section_gain(c, 499.9), 1.0, 1e-4);
+    
+    // Band-pass peaks at unity at the geometric centre
+    CHECK(biquad_design_bandpass(c, FS_HZ, 100, 300));
+    CHECK_NEAR(section_gain(c, sqrt(100.0 * 300.0)), 1.0, 1e-4);
+    CHECK(section_gain(c, 10) < 0.1 && section_gain(c, 490) < 0.1);
+    
+    // Higher orders keep the -3 dB corner and roll off 6 dB/octave per pole
+    for (uint8_t n = 1; n <= BIQUAD_MAX_SECTIONS; n++) {
+        CHECK(biquad_design_butterworth(c, n, BIQUAD_LOWPASS, FS_HZ, 50));
+        CHECK_NEAR(cascade_gain(c, n, 0), 1.0, 1e-4);
+        CHECK_NEAR(cascade_gain(c, n, 50), M_SQRT1_2, 1e-3);
+        CHECK(cascade_gain(c, n, 5) > 0.999);
+        CHECK(cascade_gain(c, n, 150) < pow(50.0 / 150.0, 2 * n) * 1.5);
+    
+        CHECK(biquad_design_butterworth(c, n, BIQUAD_HIGHPASS, FS_HZ, 50));
+        CHECK_NEAR(cascade_gain(c, n, 50), M_SQRT1_2, 1e-3);
+        CHECK(cascade_gain(c, n, 400) > 0.999);
+    }
+}
+
+static void test_sine_response(void) {
+    biquad_coeffs_t c[BIQUAD_MAX_SECTIONS];
+    biquad_cascade_t f;
+    CHECK(biquad_design_butterworth(c, 2, BIQUAD_LOWPASS, FS_HZ, 80));
+    
+    // Integer-Hz tones: the settled half is a whole number of cycles
+    const double freqs[] = { 10, 40, 80, 120, 250 };
+    for (size_t i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++) {
+        CHECK(biquad_cascade_init(&f, c, 2));
+        for (size_t t = 0; t < LEN; t++) {
+            fin[t] = (float)sin(2 * M_PI * freqs[i] * t / FS_HZ);
+        }
+        biquad_cascade_process_block(&f, fin, fout, LEN);
+        CHECK_NEAR(tone_amplitude(fout, freqs[i]), cascade_gain(c, 2, freqs[i]), 1e-4);
+    }
+    
+    // Block and per-sample processing agree
+    CHECK(biquad_cascade_init(&f, c, 2));
+    biquad_cascade_process_block(&f, fin, fout, LEN);
+    CHECK(biquad_cascade_init(&f, c, 2));
+    double err = 0;
+    for (size_t t = 0; t < LEN; t++) {
+        err = fmax(err, fabs(biquad_cascade_process(&f, fin[t]) - fout[t]));
+    }
+    CHECK_NEAR(err, 0, 1e-6);
+}
+
+static void test_step(void) {
+    biquad_coeffs_t c[BIQUAD_MAX_SECTIONS];
+    biquad_t f;
+    for (size_t t = 0; t < LEN; t++) {
+        fin[t] = 1.0f;
+    }
+    
+    // Second-order Butterworth overshoots by about 4.3 %, then settles
+    CHECK(biquad_design_lowpass(&c[0], FS_HZ, 20, BIQUAD_Q_BUTTERWORTH));
+    biquad_init(&f, &c[0]);
+    biquad_process_block(&f, fin, fout, LEN);
+    float peak = 0;
+    for (size_t t = 0; t < LEN; t++) {
+        peak = fmaxf(peak, fout[t]);
+    }
+    CHECK_NEAR(peak, 1.043, 0.005);
+    CHECK_NEAR(fout[LEN - 1], 1.0, 1e-5);
+    
+    // High-pass passes the edge and decays to zero
+    CHECK(biquad_design_highpass(&c[0], FS_HZ, 20, BIQUAD_Q_BUTTERWORTH));
+    biquad_init(&f, &c[0]);
+    biquad_process_block(&f, fin, fout, LEN);
+    CHECK_NEAR(fout[0], c[0].b0, 1e-7);
+    CHECK_NEAR(fout[LEN - 1], 0.0, 1e-5);
+    
+    // Eighth-order cascade settles to unity too
+    biquad_cascade_t cas;
+    CHECK(biquad_design_butterworth(c, BIQUAD_MAX_SECTIONS, BIQUAD_LOWPASS, FS_HZ, 20));
+    CHECK(biquad_cascade_init(&cas, c, BIQUAD_MAX_SECTIONS));
+    biquad_cascade_process_block(&cas, fin, fout, LEN);
+    CHECK_NEAR(fout[LEN - 1], 1.0, 1e-4);
+}
+
+static void test_prime(void) {
+    biquad_coeffs_t c[BIQUAD_MAX_SECTIONS];
+    
+    // A primed low-pass holds a constant input with no transient. At a
+    // low corner the float DC gain is only good to about 1e-4
+    biquad_t f;
+    CHECK(biquad_design_lowpass(&c[0], FS_HZ, 5, BIQUAD_Q_BUTTERWORTH));
+    biquad_init(&f, &c[0]);
+    const float y = biquad_prime(&f, 9.81f);
+    CHECK_NEAR(y, 9.81, 9.81 * 3e-4);
+    for (size_t t = 0; t < 100; t++) {
+        CHECK_NEAR(biquad_process(&f, 9.81f), y, 1e-5);
+    }
+    
+    // A primed high-pass cascade outputs zero for the offset
+    biquad_cascade_t cas;
+    CHECK(biquad_design_butterworth(c, 2, BIQUAD_HIGHPASS, FS_HZ, 5));
+    CHECK(biquad_cascade_init(&cas, c, 2));
+    biquad_cascade_prime(&cas, 1.0f);
+    for (size_t t = 0; t < 100; t++) {
+        CHECK_NEAR(biquad_cascade_process(&cas, 1.0f), 0.0, 1e-5);
+    }
+    
+    // Reset clears the primed state again
+    biquad_reset(&f);
+    CHECK(biquad_process(&f, 0.0f) == 0.0f);
+}
+
+// Largest difference between the Q31 and float cascades, in full scale
+static double q31_error(const biquad_coeffs_t *c, uint8_t count) {
+    biquad_cascade_t f;
+    biquad_q31_cascade_t q;
+    CHECK(biquad_cascade_init(&f, c, count));
+    CHECK(biquad_q31_cascade_init(&q, c, count));
+    
+    for (size_t t = 0; t < LEN; t++) {
+        qin[t] = (int32_t)lrint(fin[t] * 2147483648.0);
+    }
+    biquad_cascade_process_block(&f, fin, fout, LEN);
+    biquad_q31_cascade_process_block(&q, qin, qout, LEN);
+    
+    double err = 0;
+    for (size_t t = 0; t < LEN; t++) {
+        err = fmax(err, fabs(qout[t] / 2147483648.0 - fout[t]));
+    }
+    return err;
+}
+
+static void test_q31(void) {
+    biquad_coeffs_t c[BIQUAD_MAX_SECTIONS];
+    biquad_q31_coeffs_t qc;
+    const biquad_coeffs_t wide = { 2.5f, 0, 0, 0, 0 };
+    CHECK(!biquad_q31_coeffs(&qc, &wide));
+    CHECK(biquad_design_lowpass(&c[0], FS_HZ, 50, BIQUAD_Q_BUTTERWORTH));
+    CHECK(biquad_q31_coeffs(&qc, &c[0]));
+    CHECK(qc.b0 == (int32_t)lroundf(c[0].b0 * 1073741824.0f));
+    
+    // Step at half scale, then a sine sweep: Q31 tracks float
+    for (size_t t = 0; t < LEN; t++) {
+        fin[t] = 0.5f;
+    }
+    CHECK(biquad_design_butterworth(c, 2, BIQUAD_LOWPASS, FS_HZ, 50));
+    CHECK_NEAR(q31_error(c, 2), 0, 1e-5);
+    CHECK(biquad_design_butterworth(c, 2, BIQUAD_HIGHPASS, FS_HZ, 50));
+    CHECK_NEAR(q31_error(c, 2), 0, 1e-5);
+    
+    for (size_t t = 0; t < LEN; t++) {
+        fin[t] = 0.7f * (float)sin(2 * M_PI * (5 + 0.05 * t) * t / FS_HZ);
+    }
+    CHECK(biquad_design_butterworth(c, 3, BIQUAD_LOWPASS, FS_HZ, 100));
+    CHECK_NEAR(q31_error(c, 3), 0, 1e-5);
+    CHECK(biquad_design_bandpass(c, FS_HZ, 100, 300));
+    CHECK_NEAR(q31_error(c, 1), 0, 1e-5);
+    
+    // A full-scale edge into a high-pass (ideal peak 1.6) clips instead of
+    // wrapping negative, and the filter recovers once the edge has passed
+    biquad_q31_t f;
+    CHECK(biquad_design_highpass(&c[0], FS_HZ, 50, BIQUAD_Q_BUTTERWORTH));
+    CHECK(biquad_q31_coeffs(&qc, &c[0]));
+    biquad_q31_init(&f, &qc);
+    for (size_t t = 0; t < 200; t++) {
+        qin[t] = (t < 100) ? -INT32_MAX : INT32_MAX;
+    }
+    biquad_q31_process_block(&f, qin, qout, 200);
+    CHECK_NEAR(qout[99] / 2147483648.0, 0, 1e-5);
+    CHECK(qout[100] == INT32_MAX);
+    CHECK_NEAR(qout[199] / 2147483648.0, 0, 1e-5);
+    
+    biquad_q31_reset(&f);
+    CHECK(f.x1 == 0 && f.y1 == 0);
+}
+
+int main(void) {
+    TEST_RUN(test_design);
+    TEST_RUN(test_sine_response);
+    TEST_RUN(test_step);
+    TEST_RUN(test_prime);
+    TEST_RUN(test_q31);
+    TEST_EXIT();
+}
@@ -0,0 +1,54 @@
+/**
+ * VibeMon Host Test Helpers
+ * Minimal checks for the host-built unit tests: each test is a plain
+ * executable that prints failed checks and exits non-zero if any failed.
+ */
+
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+static int test_failures = 0;
+
+#define CHECK(cond) do {                                                    \
+    if (!(cond)) {                                                          \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+        test_failures++;                                                    \
+    }                                                                       \
+} while (0)
+
+#define CHECK_NEAR(actual, expected, tol) do {                              \
+    const double a_ = (actual), e_ = (expected), t_ = (tol);                \
+    if (!(fabs(a_ - e_) <= t_)) {                                           \
+        printf("%s:%d: %s = %g, expected %g +/- %g\n",                      \
+               __FILE__, __LINE__, #actual, a_, e_, t_);                    \
+        test_failures++;                                                    \
+    }                                                                       \
+} while (0)
+
+#define TEST_RUN(fn) do {                                                   \
+    const int before_ = test_failures;                                      \
+    fn();                                                                   \
+    printf("%-40s %s\n", #fn, test_failures == before_ ? "ok" : "FAILED");  \
+} while (0)
+
+#define TEST_EXIT() return (test_failures == 0) ? 0 : 1
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Deterministic uniform noise in [-1, 1)
+static inline float test_rand(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (float)((int32_t)x) / 2147483648.0f;
+}
+
+#endif // TEST_COMMON_H
@@ -0,0 +1,128 @@
+/**
+ * Decimator response: tones in each stage's passband come out at their
+ * input amplitude, tones that would alias into it are suppressed to the
+ * attenuation the taps were designed for, and the output queues behave.
+ */
+
+#include "test_common.h"
+#include "decimator.h"
+
+#define FS_HZ           1000.0
+#define SETTLE          (DECIMATOR_TAPS)    // Outputs dropped per stage
+
+static decimator_t dec;
+
+// Amplitude of a tone at freq_hz in a stage's settled output
+static double tone_out(double freq_hz, uint8_t stage, double *rms_out) {
+    static float in[1000], out[2048];
+    const uint8_t stages = stage + 1;
+    CHECK(decimator_init(&dec, (float)FS_HZ, stages));
+    
+    const size_t wanted = SETTLE + 400;
+    size_t got = 0, t = 0;
+    
+    while (got < wanted) {
+        for (size_t i = 0; i < 1000; i++, t++) {
+            in[i] = (float)sin(2 * M_PI * freq_hz * t / FS_HZ);
+        }
+        decimator_push(&dec, in, 1000);
+        for (uint8_t s = 0; s < stage; s++) {
+            decimator_read(&dec, s, NULL, DECIMATOR_QUEUE_LEN);
+        }
+        got += decimator_read(&dec, stage, &out[got], wanted - got);
+    }
+    
+    // Project the settled part onto the tone; 400 outputs is a whole
+    // number of cycles for every frequency used here
+    double step = 1;
+    for (uint8_t k = 0; k < stages; k++) {
+        step *= DECIMATOR_FACTOR;
+    }
+    
+    double c = 0, s = 0, sq = 0;
+    for (size_t j = SETTLE; j < wanted; j++) {
+        // Output j is taken at input sample (j + 1) * factor^stages - 1
+        const double ti = ((j + 1) * step - 1) / FS_HZ;
+        c += out[j] * cos(2 * M_PI * freq_hz * ti);
+        s += out[j] * sin(2 * M_PI * freq_hz * ti);
+        sq += (double)out[j] * out[j];
+    }
+    const double n = wanted - SETTLE;
+    *rms_out = sqrt(sq / n);
+    
+    return 2 * hypot(c, s) / n;
+}
+
+static void test_rates(void) {
+    CHECK(!decimator_init(&dec, (float)FS_HZ, 0));
+    CHECK(!decimator_init(&dec, (float)FS_HZ, DECIMATOR_MAX_STAGES + 1));
+    CHECK(decimator_init(&dec, (float)FS_HZ, 3));
+    CHECK_NEAR(decimator_rate_hz(&dec, 0), 100, 1e-4);
+    CHECK_NEAR(decimator_rate_hz(&dec, 1), 10, 1e-5);
+    CHECK_NEAR(decimator_rate_hz(&dec, 2), 1, 1e-6);
+}
+
+static void test_passband(void) {
+    // 0 .. 0.3 x output rate is flat to within 0.01 dB
+    const double freqs[] = { 2.5, 10, 20, 30 };
+    for (size_t i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++) {
+        double rms = 0;
+        CHECK_NEAR(tone_out(freqs[i], 0, &rms), 1.0, 1.2e-3);
+    }
+    
+    // Through two stages: 0 .. 3 Hz at the 10 Hz output
+    double rms = 0;
+    CHECK_NEAR(tone_out(2.5, 1, &rms), 1.0, 2.4e-3);
+}
+
+static void test_stopband(void) {
+    // Everything >= 0.7 x output rate would alias into the passband;
+    // designed for about -58 dB. The whole output is alias, so use its RMS
+    const double freqs[] = { 70, 130, 170, 333.5, 499.5 };
+    for (size_t i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++) {
+        double rms = 0;
+        tone_out(freqs[i], 0, &rms);
+        CHECK(rms * sqrt(2) < 1.5e-3);
+    }
+    
+    // 8 Hz survives stage 0 but is rejected by stage 1
+    double rms = 0;
+    tone_out(8, 1, &rms);
+    CHECK(rms * sqrt(2) < 1.5e-3);
+}
+
+static void test_queue(void) {
+    static float in[DECIMATOR_FACTOR * (DECIMATOR_QUEUE_LEN + 5)];
+    for (size_t i = 0; i < sizeof(in) / sizeof(in[0]); i++) {
+        in[i] = 1.0f;
+    }
+    
+    CHECK(decimator_init(&dec, (float)FS_HZ, 1));
+    decimator_push(&dec, in, sizeof(in) / sizeof(in[0]));
+    
+    // Oldest outputs are overwritten once the queue is full
+    CHECK(decimator_available(&dec, 0) == DECIMATOR_QUEUE_LEN);
+    CHECK(dec.stage[0].overruns == 5);
+    CHECK(decimator_available(&dec, 1) == 0);
+    
+    float out[4];
+    CHECK(decimator_read(&dec, 0, out, 4) == 4);
+    CHECK(decimator_available(&dec, 0) == DECIMATOR_QUEUE_LEN - 4);
+    
+    // DC settles at unity gain
+    float last = 0;
+    while (decimator_read(&dec, 0, &last, 1) == 1) {
+    }
+    CHECK_NEAR(last, 1.0, 1e-5);
+    
+    decimator_reset(&dec);
+    CHECK(decimator_available(&dec, 0) == 0);
+}
+
+int main(void) {
+    TEST_RUN(test_rates);
+    TEST_RUN(test_passband);
+    TEST_RUN(test_stopband);
+    TEST_RUN(test_queue);
+    TEST_EXIT();
+}
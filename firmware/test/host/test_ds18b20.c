@@ -0,0 +1,420 @@
+/**
+ * DS18B20 driver against a simulated OneWire bus: the test provides the
+ * onewire_rmt backend, behind which several bit-level DS18B20 models
+ * answer ROM search, Match/Skip ROM, CONVERT_T and scratchpad commands
+ * with wired-AND reads.
+ */
+
+#include "test_common.h"
+#include "ds18b20.h"
+#include "onewire_rmt.h"
+#include "host_clock.h"
+#include "../../src/config.h"
+
+#include <string.h>
+
+// ===========================================
+// Simulated Bus
+// ===========================================
+#define SIM_MAX_DEVICES     6
+
+typedef enum {
+    PHASE_IDLE = 0,         // Waiting for a reset
+    PHASE_ROM_CMD,
+    PHASE_SEARCH,
+    PHASE_MATCH,
+    PHASE_FUNC_CMD,
+    PHASE_READ_SP,
+    PHASE_WRITE_SP
+} sim_phase_t;
+
+typedef struct {
+    uint8_t rom[8];
+    int16_t raw;            // Temperature in 1/16 °C
+    uint8_t scratchpad[9];
+    bool attached;
+    bool corrupt;           // Flip a bit of the scratchpad CRC
+    bool selected;
+} sim_device_t;
+
+static sim_device_t sim[SIM_MAX_DEVICES];
+static int sim_count;
+static sim_phase_t phase;
+static uint8_t shift;       // Command bits collected so far
+static int bit_pos;         // Position within the current phase
+static int search_sub;      // 0 = id bit, 1 = complement, 2 = direction
+
+// Bus activity, for the per-call budget checks
+static int resets;
+static int bytes_on_bus;    // Reset, or 8 slots, count as one bus byte
+
+// Bitwise Dallas CRC8, independent of the driver's table
+static uint8_t crc8_ref(const uint8_t *data, int len) {
+    uint8_t crc = 0;
+    for (int i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        for (int j = 0; j < 8; j++) {
+            const uint8_t mix = (crc ^ b) & 1;
+            crc >>= 1;
+            if (mix) {
+                crc ^= 0x8C;
+            }
+            b >>= 1;
+        }
+    }
+    return crc;
+}
+
+static void sim_add(uint8_t family, uint64_t serial, int16_t raw) {
+    sim_device_t *d = &sim[sim_count++];
+    memset(d, 0, sizeof(*d));
+    d->rom[0] = family;
+    for (int i = 1; i < 7; i++) {
+        d->rom[i] = (uint8_t)(serial >> (8 * (i - 1)));
+    }
+    d->rom[7] = crc8_ref(d->rom, 7);
+    d->raw = raw;
+    d->attached = true;
+    const uint8_t sp[8] = { 0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10 };
+    memcpy(d->scratchpad, sp, 8);
+}
+
+static void sim_latch_scratchpad(sim_device_t *d) {
+    d->scratchpad[0] = (uint8_t)d->raw;
+    d->scratchpad[1] = (uint8_t)(d->raw >> 8);
+    d->scratchpad[8] = crc8_ref(d->scratchpad, 8) ^ (d->corrupt ? 0x01 : 0x00);
+}
+
+static bool sim_any_selected(void) {
+    for (int i = 0; i < sim_count; i++) {
+        if (sim[i].attached && sim[i].selected) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int rom_bit(const sim_device_t *d, int bit) {
+    return (d->rom[bit / 8] >> (bit % 8)) & 1;
+}
+
+static void sim_function(uint8_t cmd) {
+    switch (cmd) {
+        case 0x44:      // CONVERT_T
+            for (int i = 0; i < sim_count; i++) {
+                if (sim[i].attached && sim[i].selected) {
+                    sim_latch_scratchpad(&sim[i]);
+                }
+            }
+            phase = PHASE_IDLE;
+            break;
+        case 0xBE:      // READ_SCRATCHPAD
+            phase = PHASE_READ_SP;
+            break;
+        case 0x4E:      // WRITE_SCRATCHPAD (TH, TL, config)
+            phase = PHASE_WRITE_SP;
+            break;
+        default:
+            phase = PHASE_IDLE;
+            break;
+    }
+    bit_pos = 0;
+}
+
+static void sim_write_bit(int bit) {
+    switch (phase) {
+        case PHASE_ROM_CMD:
+        case PHASE_FUNC_CMD:
+            shift |= (uint8_t)(bit << bit_pos);
+            if (++bit_pos < 8) {
+                return;
+            }
+            bit_pos = 0;
+            if (phase == PHASE_FUNC_CMD) {
+                sim_function(shift);
+            } else if (shift == 0xF0) {
+                phase = PHASE_SEARCH;
+                search_sub = 0;
+            } else if (shift == 0x55) {
+                phase = PHASE_MATCH;
+            } else if (shift == 0xCC) {
+                phase = PHASE_FUNC_CMD;
+            } else {
+                phase = PHASE_IDLE;
+            }
+            shift = 0;
+            break;
+    
+        case PHASE_SEARCH:
+            if (search_sub != 2) {
+                phase = PHASE_IDLE;     // Protocol error
+                return;
+            }
+            for (int i = 0; i < sim_count; i++) {
+                if (sim[i].selected && rom_bit(&sim[i], bit_pos) != bit) {
+                    sim[i].selected = false;
+                }
+            }
+            search_sub = 0;
+            if (++bit_pos == 64) {
+                phase = PHASE_FUNC_CMD;
+                bit_pos = 0;
+            }
+            break;
+    
+        case PHASE_MATCH:
+            for (int i = 0; i < sim_count; i++) {
+                if (sim[i].selected && rom_bit(&sim[i], bit_pos) != bit) {
+                    sim[i].selected = false;
+                }
+            }
+            if (++bit_pos == 64) {
+                phase = PHASE_FUNC_CMD;
+                bit_pos = 0;
+            }
+            break;
+    
+        case PHASE_WRITE_SP:
+            for (int i = 0; i < sim_count; i++) {
+                if (sim[i].attached && sim[i].selected) {
+                    uint8_t *b = &sim[i].scratchpad[2 + bit_pos / 8];
+                    *b = (uint8_t)((*b & ~(1 << (bit_pos % 8))) | (bit << (bit_pos % 8)));
+                }
+            }
+            if (++bit_pos == 24) {
+                phase = PHASE_IDLE;
+            }
+            break;
+    
+        default:
+            break;
+    }
+}
+
+static int sim_read_bit(void) {
+    int line = 1;
+    
+    switch (phase) {
+        case PHASE_SEARCH:
+            if (search_sub > 1) {
+                phase = PHASE_IDLE;
+                return 1;
+            }
+            for (int i = 0; i < sim_count; i++) {
+                if (sim[i].attached && sim[i].selected) {
+                    line &= rom_bit(&sim[i], bit_pos) ^ search_sub;
+                }
+            }
+            search_sub++;
+            break;
+    
+        case PHASE_READ_SP:
+            for (int i = 0; i < sim_count; i++) {
+                if (sim[i].attached && sim[i].selected && bit_pos < 72) {
+                    line &= (sim[i].scratchpad[bit_pos / 8] >> (bit_pos % 8)) & 1;
+                }
+            }
+            bit_pos++;
+            break;
+    
+        default:
+            break;
+    }
+    
+    return line;
+}
+
+esp_err_t onewire_rmt_init(int gpio_num, rmt_channel_t tx_channel, rmt_channel_t rx_channel) {
+    (void)gpio_num;
+    (void)tx_channel;
+    (void)rx_channel;
+    return ESP_OK;
+}
+
+esp_err_t onewire_rmt_deinit(void) {
+    return ESP_OK;
+}
+
+esp_err_t onewire_rmt_reset(bool *presence) {
+    resets++;
+    bytes_on_bus++;
+    
+    for (int i = 0; i < sim_count; i++) {
+        sim[i].selected = sim[i].attached;
+    }
+    *presence = sim_any_selected();
+    phase = *presence ? PHASE_ROM_CMD : PHASE_IDLE;
+    shift = 0;
+    bit_pos = 0;
+    
+    return ESP_OK;
+}
+
+esp_err_t onewire_rmt_write_bits(uint8_t data, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        sim_write_bit((data >> i) & 1);
+    }
+    bytes_on_bus += (count == 8);
+    return ESP_OK;
+}
+
+esp_err_t onewire_rmt_read_bits(uint8_t *data, uint8_t count) {
+    *data = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        *data |= (uint8_t)(sim_read_bit() << i);
+    }
+    bytes_on_bus += (count == 8);
+    return ESP_OK;
+}
+
+// ===========================================
+// Tests
+// ===========================================
+
+// Run update steps until the state machine is idle again
+static int run_cycle(int *max_bytes_per_call) {
+    int calls = 0;
+    *max_bytes_per_call = 0;
+    
+    host_clock_advance_us((int64_t)DS18B20_INTERVAL_MS * 1000);
+    CHECK(ds18b20_update() == DS18B20_STATE_CONVERTING);
+    
+    host_clock_advance_us(800 * 1000);
+    ds18b20_state_t state;
+    do {
+        const int before = bytes_on_bus;
+        state = ds18b20_update();
+        if (bytes_on_bus - before > *max_bytes_per_call) {
+            *max_bytes_per_call = bytes_on_bus - before;
+        }
+        calls++;
+    } while (state != DS18B20_STATE_IDLE && calls < 1000);
+    
+    return calls;
+}
+
+static bool has_rom(const uint8_t *rom) {
+    for (uint8_t i = 0; i < ds18b20_get_count(); i++) {
+        uint8_t found[8];
+        if (ds18b20_get_rom_code(i, found) == ESP_OK && memcmp(found, rom, 8) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void test_crc(void) {
+    // Maxim application note example ROM: CRC of the first 7 bytes
+    const uint8_t rom[8] = { 0x02, 0x1C, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xA2 };
+    CHECK(crc8_ref(rom, 7) == 0xA2);
+    CHECK(crc8_ref(rom, 8) == 0x00);
+}
+
+static void test_search(void) {
+    // Serials differ at low and high bits so the search branches deeply
+    sim_add(0x28, 0x000000000001ULL, 25 * 16);
+    sim_add(0x28, 0x000000000002ULL, -10 * 16 - 2);
+    sim_add(0x28, 0x800000000001ULL, 85 * 16);
+    sim_add(0x10, 0x000000000001ULL, 0);        // DS18S20: ignored
+    
+    CHECK(ds18b20_init() == ESP_OK);
+    CHECK(ds18b20_get_count() == 3);
+    CHECK(has_rom(sim[0].rom));
+    CHECK(has_rom(sim[1].rom));
+    CHECK(has_rom(sim[2].rom));
+    CHECK(!has_rom(sim[3].rom));
+    
+    // Resolution went to every sensor's configuration register
+    for (int i = 0; i < sim_count; i++) {
+        CHECK(sim[i].scratchpad[4] == 0x7F);
+    }
+}
+
+static void test_cycle(void) {
+    int max_bytes = 0;
+    const int calls = run_cycle(&max_bytes);
+    
+    // Reset, MATCH_ROM, 8 ROM bytes, READ_SCRATCHPAD, 9 bytes per sensor
+    CHECK(calls <= 3 * 20 + 2);
+    CHECK(max_bytes == 1);
+    
+    for (uint8_t i = 0; i < ds18b20_get_count(); i++) {
+        uint8_t rom[8];
+        float t = 0;
+        uint32_t age = 0;
+        CHECK(ds18b20_get_rom_code(i, rom) == ESP_OK);
+        CHECK(ds18b20_get_latest(i, &t, &age) == ESP_OK);
+    
+        for (int d = 0; d < sim_count; d++) {
+            if (memcmp(sim[d].rom, rom, 8) == 0) {
+                CHECK_NEAR(t, sim[d].raw / 16.0, 1e-6);
+            }
+        }
+    }
+}
+
+static void test_crc_error(void) {
+    sim[1].corrupt = true;
+    sim[1].raw = 0;
+    
+    int max_bytes = 0;
+    run_cycle(&max_bytes);
+    
+    for (uint8_t i = 0; i < ds18b20_get_count(); i++) {
+        uint8_t rom[8];
+        float t = 0;
+        ds18b20_get_rom_code(i, rom);
+        const esp_err_t ret = ds18b20_get_latest(i, &t, NULL);
+    
+        // The bad read is reported and the last good value kept
+        if (memcmp(rom, sim[1].rom, 8) == 0) {
+            CHECK(ret == ESP_ERR_INVALID_CRC);
+            CHECK_NEAR(t, -10.125, 1e-6);
+        } else {
+            CHECK(ret == ESP_OK);
+        }
+    }
+    sim[1].corrupt = false;
+}
+
+static void test_missing_probe_backoff(void) {
+    for (int i = 0; i < sim_count; i++) {
+        sim[i].attached = false;
+    }
+    
+    host_clock_advance_us((int64_t)DS18B20_INTERVAL_MS * 1000);
+    resets = 0;
+    CHECK(ds18b20_update() == DS18B20_STATE_IDLE);
+    CHECK(resets == 1);
+    
+    // No further resets until the interval has passed
+    for (int i = 0; i < 100; i++) {
+        host_clock_advance_us(1000);
+        ds18b20_update();
+    }
+    CHECK(resets == 1);
+    
+    host_clock_advance_us((int64_t)DS18B20_INTERVAL_MS * 1000);
+    ds18b20_update();
+    CHECK(resets == 2);
+    
+    float t = 0;
+    CHECK(ds18b20_get_latest(0, &t, NULL) == ESP_ERR_NOT_FOUND);
+    
+    // Reattached probes are collected again on the next cycle
+    for (int i = 0; i < sim_count; i++) {
+        sim[i].attached = true;
+    }
+    int max_bytes = 0;
+    run_cycle(&max_bytes);
+    CHECK(ds18b20_get_latest(0, &t, NULL) == ESP_OK);
+}
+
+int main(void) {
+    TEST_RUN(test_crc);
+    TEST_RUN(test_search);
+    TEST_RUN(test_cycle);
+    TEST_RUN(test_crc_error);
+    TEST_RUN(test_missing_probe_backoff);
+    TEST_EXIT();
+}
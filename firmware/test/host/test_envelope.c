@@ -0,0 +1,103 @@
+/**
+ * Envelope demodulation of a simulated outer-race defect: decaying bursts
+ * of a 200 Hz structural resonance repeating at the defect frequency, on
+ * top of strong shaft vibration and noise. The defect line must dominate
+ * the envelope spectrum, and vanish when the impacts stop.
+ */
+
+#include "test_common.h"
+#include "envelope.h"
+
+#define FS_HZ           1000.0f
+#define RESONANCE_HZ    200.0
+#define DEFECT_HZ       31.7
+#define SHAFT_HZ        12.5
+
+static const envelope_config_t config = {
+    .sample_rate_hz = FS_HZ,
+    .band_low_hz = 100,
+    .band_high_hz = 300,
+    .decimation = 4,
+    .fft_size = 256,
+    .window = FFT_WINDOW_HANN,
+};
+
+static float storage[ENVELOPE_STORAGE_SIZE(256)];
+
+// One second of signal starting at sample index start
+static void synthesize(float *x, size_t count, size_t start, double impact_g, uint32_t *seed) {
+    for (size_t i = 0; i < count; i++) {
+        const double t = (start + i) / (double)FS_HZ;
+    
+        // Time since the latest impact
+        const double since = fmod(t, 1.0 / DEFECT_HZ);
+        const double burst = impact_g * exp(-since / 0.004) * sin(2 * M_PI * RESONANCE_HZ * since);
+    
+        x[i] = (float)(1.0 * sin(2 * M_PI * SHAFT_HZ * t) + burst + 0.05 * test_rand(seed));
+    }
+}
+
+static float run(double impact_g, float *defect_amp, float *max_other, float *peak_hz) {
+    static envelope_t env;
+    static float x[1000];
+    uint32_t seed = 21;
+    
+    CHECK(envelope_init(&env, &config, storage));
+    
+    uint32_t spectra = 0;
+    for (size_t s = 0; s < 4; s++) {
+        synthesize(x, 1000, s * 1000, impact_g, &seed);
+        spectra += envelope_push(&env, x, 1000);
+    }
+    CHECK(spectra >= 3);
+    
+    uint16_t bins = 0;
+    const float *spec = envelope_spectrum(&env, &bins);
+    const float bin_hz = envelope_bin_hz(&env);
+    CHECK_NEAR(bin_hz, 250.0 / 256, 1e-6);
+    
+    // Line at the defect frequency vs everything not at one of its harmonics
+    const int k0 = (int)lround(DEFECT_HZ / bin_hz);
+    *defect_amp = fmaxf(spec[k0], fmaxf(spec[k0 - 1], spec[k0 + 1]));
+    *max_other = 0;
+    for (int k = 3; k < bins; k++) {
+        const double h = k * bin_hz / DEFECT_HZ;
+        if (fabs(h - lround(h)) * DEFECT_HZ > 3 * bin_hz) {
+            *max_other = fmaxf(*max_other, spec[k]);
+        }
+    }
+    
+    float frac = 0;
+    fft_find_peak(spec, bins, 3, &frac);
+    *peak_hz = frac * bin_hz;
+    
+    return env.envelope_rms;
+}
+
+static void test_defect_line(void) {
+    float defect = 0, other = 0, peak_hz = 0;
+    const float rms = run(0.5, &defect, &other, &peak_hz);
+    
+    CHECK(rms > 0);
+    CHECK(defect > 10 * other);
+    
+    // The largest line above DC is the defect rate
+    CHECK_NEAR(peak_hz, DEFECT_HZ, 0.5);
+}
+
+static void test_healthy(void) {
+    float defect_hit = 0, other_hit = 0, peak_hz = 0;
+    float defect = 0, other = 0;
+    const float rms_hit = run(0.5, &defect_hit, &other_hit, &peak_hz);
+    const float rms = run(0.0, &defect, &other, &peak_hz);
+    
+    // Shaft vibration is outside the band: no defect line, little envelope
+    CHECK(defect < 0.1f * defect_hit);
+    CHECK(rms < 0.2f * rms_hit);
+}
+
+int main(void) {
+    TEST_RUN(test_defect_line);
+    TEST_RUN(test_healthy);
+    TEST_EXIT();
+}
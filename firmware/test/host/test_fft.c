@@ -0,0 +1,224 @@
+/**
+ * FFT engine against a double-precision DFT: complex, real and paired
+ * float transforms at every supported size, Q15 transforms within a
+ * rounding-error bound, and window amplitude correction.
+ */
+
+#include "test_common.h"
+#include "fft.h"
+
+#include <string.h>
+
+static float data[2 * FFT_MAX_SIZE];
+static double ref_re[FFT_MAX_SIZE], ref_im[FFT_MAX_SIZE];
+static double in_re[FFT_MAX_SIZE], in_im[FFT_MAX_SIZE];
+
+static void dft(uint16_t n) {
+    for (uint16_t k = 0; k < n; k++) {
+        double re = 0, im = 0;
+        for (uint16_t t = 0; t < n; t++) {
+            const double ph = -2 * M_PI * (double)((uint32_t)k * t % n) / n;
+            re += in_re[t] * cos(ph) - in_im[t] * sin(ph);
+            im += in_re[t] * sin(ph) + in_im[t] * cos(ph);
+        }
+        ref_re[k] = re;
+        ref_im[k] = im;
+    }
+}
+
+// Float rounding grows with log2(n) stages over outputs up to n in size
+static double f32_tol(uint16_t n) {
+    return 4e-7 * n * log2(n) + 1e-6;
+}
+
+// Full-scale inputs are kept below 1/sqrt(2) so no butterfly overflows
+static double q15_tol(uint16_t n) {
+    return 1.0 + 0.3 * log2(n);
+}
+
+static void test_complex_f32(void) {
+    uint32_t seed = 11;
+    for (uint16_t n = 2; n <= FFT_MAX_SIZE; n <<= 1) {
+        for (uint16_t t = 0; t < n; t++) {
+            data[2 * t] = test_rand(&seed);
+            data[2 * t + 1] = test_rand(&seed);
+            in_re[t] = data[2 * t];
+            in_im[t] = data[2 * t + 1];
+        }
+        dft(n);
+        fft_complex_f32(data, n);
+    
+        double err = 0;
+        for (uint16_t k = 0; k < n; k++) {
+            err = fmax(err, fabs(data[2 * k] - ref_re[k]));
+            err = fmax(err, fabs(data[2 * k + 1] - ref_im[k]));
+        }
+        CHECK_NEAR(err, 0, f32_tol(n));
+    }
+}
+
+static void test_real_f32(void) {
+    uint32_t seed = 12;
+    for (uint16_t n = FFT_MIN_SIZE; n <= FFT_MAX_SIZE; n <<= 1) {
+        fft_plan_t plan;
+        CHECK(fft_plan_init(&plan, n, FFT_WINDOW_RECT, NULL, NULL));
+    
+        for (uint16_t t = 0; t < n; t++) {
+            data[t] = test_rand(&seed);
+            in_re[t] = data[t];
+            in_im[t] = 0;
+        }
+        dft(n);
+        fft_real_f32(&plan, data);
+    
+        // Packed: X[0], X[n/2], then {re, im} of X[1 .. n/2-1]
+        double err = fmax(fabs(data[0] - ref_re[0]), fabs(data[1] - ref_re[n / 2]));
+        for (uint16_t k = 1; k < n / 2; k++) {
+            err = fmax(err, fabs(data[2 * k] - ref_re[k]));
+            err = fmax(err, fabs(data[2 * k + 1] - ref_im[k]));
+        }
+        CHECK_NEAR(err, 0, f32_tol(n));
+    }
+}
+
+static void test_real_pair_f32(void) {
+    const uint16_t n = 256;
+    static double b_re[256], b_im[256];
+    uint32_t seed = 13;
+    fft_plan_t plan;
+    CHECK(fft_plan_init(&plan, n, FFT_WINDOW_RECT, NULL, NULL));
+    
+    for (uint16_t t = 0; t < n; t++) {
+        data[2 * t] = test_rand(&seed);
+        data[2 * t + 1] = test_rand(&seed);
+    }
+    
+    // Channel b alone, then channel a alone
+    for (uint16_t t = 0; t < n; t++) {
+        in_re[t] = data[2 * t + 1];
+        in_im[t] = 0;
+    }
+    dft(n);
+    memcpy(b_re, ref_re, sizeof(b_re));
+    memcpy(b_im, ref_im, sizeof(b_im));
+    for (uint16_t t = 0; t < n; t++) {
+        in_re[t] = data[2 * t];
+    }
+    dft(n);
+    
+    fft_real_pair_f32(&plan, data);
+    
+    const double tol = f32_tol(n);
+    CHECK_NEAR(data[0], ref_re[0], tol);
+    CHECK_NEAR(data[1], b_re[0], tol);
+    CHECK_NEAR(data[n], ref_re[n / 2], tol);
+    CHECK_NEAR(data[n + 1], b_re[n / 2], tol);
+    for (uint16_t k = 1; k < n / 2; k++) {
+        CHECK_NEAR(data[2 * k], ref_re[k], tol);
+        CHECK_NEAR(data[2 * k + 1], ref_im[k], tol);
+        CHECK_NEAR(data[2 * (n - k)], b_re[k], tol);
+        CHECK_NEAR(data[2 * (n - k) + 1], b_im[k], tol);
+    }
+}
+
+static void test_complex_q15(void) {
+    static int16_t q[2 * FFT_MAX_SIZE];
+    uint32_t seed = 14;
+    
+    for (uint16_t n = 8; n <= FFT_MAX_SIZE; n <<= 1) {
+        for (uint16_t t = 0; t < n; t++) {
+            q[2 * t] = (int16_t)(test_rand(&seed) * 0.7f * 32767);
+            q[2 * t + 1] = (int16_t)(test_rand(&seed) * 0.7f * 32767);
+            in_re[t] = q[2 * t];
+            in_im[t] = q[2 * t + 1];
+        }
+        dft(n);
+        fft_complex_q15(q, n);
+    
+        // Result is DFT / n; every stage rounds, and later stages halve the
+        // error of earlier ones, so it stays within about an LSB per stage
+        // pair (truncating stages instead would sit 2-3 LSB beyond this)
+        double err = 0;
+        for (uint16_t k = 0; k < n; k++) {
+            err = fmax(err, fabs(q[2 * k] - ref_re[k] / n));
+            err = fmax(err, fabs(q[2 * k + 1] - ref_im[k] / n));
+        }
+        CHECK_NEAR(err, 0, q15_tol(n));
+    }
+}
+
+static void test_real_q15(void) {
+    static int16_t q[FFT_MAX_SIZE];
+    uint32_t seed = 15;
+    
+    for (uint16_t n = FFT_MIN_SIZE; n <= FFT_MAX_SIZE; n <<= 1) {
+        fft_plan_t plan;
+        CHECK(fft_plan_init(&plan, n, FFT_WINDOW_RECT, NULL, NULL));
+    
+        for (uint16_t t = 0; t < n; t++) {
+            q[t] = (int16_t)(test_rand(&seed) * 0.7f * 32767);
+            in_re[t] = q[t];
+            in_im[t] = 0;
+        }
+        dft(n);
+        fft_real_q15(&plan, q);
+    
+        double err = fmax(fabs(q[0] - ref_re[0] / n), fabs(q[1] - ref_re[n / 2] / n));
+        for (uint16_t k = 1; k < n / 2; k++) {
+            err = fmax(err, fabs(q[2 * k] - ref_re[k] / n));
+            err = fmax(err, fabs(q[2 * k + 1] - ref_im[k] / n));
+        }
+        CHECK_NEAR(err, 0, q15_tol(n));
+    }
+}
+
+static void test_amplitude(void) {
+    const uint16_t n = 1024;
+    static float win[1024], amp[512];
+    const fft_window_t windows[] = { FFT_WINDOW_HANN, FFT_WINDOW_FLATTOP };
+    
+    for (size_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++) {
+        fft_plan_t plan;
+        CHECK(fft_plan_init(&plan, n, windows[w], win, NULL));
+    
+        // On-bin tone plus DC offset
+        for (uint16_t t = 0; t < n; t++) {
+            data[t] = 0.3f + 0.8f * (float)sin(2 * M_PI * 100 * t / n);
+        }
+        fft_window_apply_f32(&plan, data);
+        fft_real_f32(&plan, data);
+        fft_amplitude_f32(&plan, data, amp);
+    
+        float frac = 0;
+        CHECK(fft_find_peak(amp, n / 2, 2, &frac) == 100);
+        CHECK_NEAR(frac, 100, 0.01);
+        CHECK_NEAR(amp[100], 0.8, 1e-3);
+        CHECK_NEAR(amp[0], 0.3, 1e-3);
+    }
+    
+    // Flat-top reads an off-bin tone within 0.1 %; the peak still locates it
+    fft_plan_t plan;
+    CHECK(fft_plan_init(&plan, n, FFT_WINDOW_FLATTOP, win, NULL));
+    for (uint16_t t = 0; t < n; t++) {
+        data[t] = 0.5f * (float)sin(2 * M_PI * 200.4 * t / n);
+    }
+    fft_window_apply_f32(&plan, data);
+    fft_real_f32(&plan, data);
+    fft_amplitude_f32(&plan, data, amp);
+    
+    float frac = 0;
+    const uint16_t peak = fft_find_peak(amp, n / 2, 2, &frac);
+    CHECK(peak == 200);
+    CHECK_NEAR(amp[peak], 0.5, 0.5e-3);
+    CHECK_NEAR(frac, 200.4, 0.1);
+}
+
+int main(void) {
+    TEST_RUN(test_complex_f32);
+    TEST_RUN(test_real_f32);
+    TEST_RUN(test_real_pair_f32);
+    TEST_RUN(test_complex_q15);
+    TEST_RUN(test_real_q15);
+    TEST_RUN(test_amplitude);
+    TEST_EXIT();
+}
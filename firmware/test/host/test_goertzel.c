@@ -0,0 +1,94 @@
+/**
+ * Goertzel bank: a tone between FFT bins reads its true amplitude at its
+ * own frequency, a target half a resolution step away reads the
+ * rectangular-window response, and block results match a direct DFT at
+ * the target frequency however the samples are batched.
+ */
+
+#include "test_common.h"
+#include "goertzel.h"
+
+#define FS_HZ           1000.0f
+#define BLOCK           1000            // 1 Hz resolution
+
+static float x[3 * BLOCK];
+static goertzel_bank_t bank;
+
+// |DFT| at an arbitrary frequency over x[0..n), scaled to tone amplitude
+static double dft_amplitude(const float *samples, size_t n, double freq) {
+    double re = 0, im = 0;
+    for (size_t i = 0; i < n; i++) {
+        const double ph = 2 * M_PI * freq * i / FS_HZ;
+        re += samples[i] * cos(ph);
+        im -= samples[i] * sin(ph);
+    }
+    return 2.0 * hypot(re, im) / n;
+}
+
+static void test_off_bin(void) {
+    // 37.25 cycles per block: a quarter bin off for a 1000-point FFT
+    const double amp = 0.5, freq = 37.25;
+    for (size_t i = 0; i < BLOCK; i++) {
+        x[i] = (float)(amp * sin(2 * M_PI * freq * i / FS_HZ + 0.3));
+    }
+    
+    // On the tone, half a step away and a clean miss
+    const float targets[] = { 37.25f, 37.75f, 120.0f };
+    CHECK(goertzel_bank_init(&bank, FS_HZ, BLOCK, targets, 3));
+    CHECK(goertzel_bank_push(&bank, x, BLOCK) == 1);
+    
+    // Only the negative-frequency image leaks in, ~0.5 %
+    CHECK_NEAR(bank.amplitude[0], amp, 0.01 * amp);
+    
+    // Half a cycle per block off: |sin(pi/2) / (N sin(pi/2N))| = 2/pi
+    CHECK_NEAR(bank.amplitude[1], amp * 2 / M_PI, 0.01 * amp);
+    CHECK(bank.amplitude[2] < 0.01 * amp);
+}
+
+static void test_matches_dft(void) {
+    uint32_t seed = 5;
+    for (size_t i = 0; i < 3 * BLOCK; i++) {
+        const double t = i / FS_HZ;
+        x[i] = (float)(0.8 * sin(2 * M_PI * 24.6 * t) + 0.2 * sin(2 * M_PI * 153.3 * t)) +
+               0.05f * test_rand(&seed);
+    }
+    
+    const float targets[] = { 24.6f, 49.2f, 153.3f, 311.7f };
+    CHECK(goertzel_bank_init(&bank, FS_HZ, BLOCK, targets, 4));
+    
+    // Batches that straddle block boundaries
+    uint32_t blocks = 0;
+    for (size_t i = 0; i < 3 * BLOCK; i += 333) {
+        const size_t run = (3 * BLOCK - i < 333) ? 3 * BLOCK - i : 333;
+        blocks += goertzel_bank_push(&bank, &x[i], run);
+    }
+    CHECK(blocks == 3);
+    CHECK(bank.blocks == 3);
+    CHECK(bank.position == 0);
+    
+    // Amplitudes are those of the last completed block
+    for (int t = 0; t < 4; t++) {
+        CHECK_NEAR(bank.amplitude[t], dft_amplitude(&x[2 * BLOCK], BLOCK, targets[t]), 1e-4);
+    }
+    CHECK_NEAR(bank.amplitude[0], 0.8, 0.01);
+    CHECK_NEAR(bank.amplitude[2], 0.2, 0.01);
+}
+
+static void test_invalid(void) {
+    const float nyquist[] = { 500.0f };
+    const float zero[] = { 0.0f };
+    CHECK(!goertzel_bank_init(&bank, FS_HZ, BLOCK, nyquist, 1));
+    CHECK(!goertzel_bank_init(&bank, FS_HZ, BLOCK, zero, 1));
+    CHECK(!goertzel_bank_init(&bank, FS_HZ, 0, NULL, 0));
+    
+    // An empty bank completes nothing
+    CHECK(goertzel_bank_init(&bank, FS_HZ, BLOCK, NULL, 0));
+    CHECK(goertzel_bank_push(&bank, x, BLOCK) == 0);
+}
+
+int main(void) {
+    TEST_RUN(test_off_bin);
+    TEST_RUN(test_matches_dft);
+    TEST_RUN(test_invalid);
+    TEST_EXIT();
+}
@@ -0,0 +1,154 @@
+/**
+ * DSP kernel equivalence: every kernel against a plain double-precision
+ * reference loop, across lengths that exercise the unrolled bodies and
+ * their tails, plus the decimator's dot-product output against a direct
+ * convolution.
+ */
+
+#include "test_common.h"
+#include "kernels.h"
+#include "decimator.h"
+#include "fft_tables.h"
+
+#include <string.h>
+
+#define MAX_LEN     1024
+
+static float a[MAX_LEN], b[MAX_LEN], out[MAX_LEN];
+
+static void fill(uint32_t seed) {
+    for (size_t i = 0; i < MAX_LEN; i++) {
+        a[i] = test_rand(&seed);
+        b[i] = test_rand(&seed);
+    }
+}
+
+static void test_dot(void) {
+    fill(1);
+    for (size_t n = 0; n <= 260; n++) {
+        double ref = 0, mag = 0;
+        for (size_t i = 0; i < n; i++) {
+            ref += (double)a[i] * b[i];
+            mag += fabs((double)a[i] * b[i]);
+        }
+        CHECK_NEAR(dsp_dot_f32(a, b, n), ref, 1e-6 * (mag + 1));
+    }
+}
+
+static void test_mul(void) {
+    fill(2);
+    for (size_t n = 1; n <= 67; n++) {
+        dsp_mul_f32(a, b, out, n);
+        for (size_t i = 0; i < n; i++) {
+            CHECK(out[i] == a[i] * b[i]);
+        }
+    }
+    
+    // In place, as the window code calls it
+    memcpy(out, a, sizeof(a));
+    dsp_mul_f32(out, b, out, MAX_LEN);
+    for (size_t i = 0; i < MAX_LEN; i++) {
+        CHECK(out[i] == a[i] * b[i]);
+    }
+}
+
+static void test_biquad(void) {
+    fill(3);
+    const float coeffs[5] = { 0.2f, -0.1f, 0.05f, -1.2f, 0.5f };
+    float state[2] = { 0, 0 };
+    double z1 = 0, z2 = 0;
+    
+    // Split into uneven blocks so state carries across calls
+    size_t done = 0;
+    for (size_t block = 1; done + block <= MAX_LEN; block += 7) {
+        dsp_biquad_f32(&a[done], &out[done], block, coeffs, state);
+        done += block;
+    }
+    
+    for (size_t i = 0; i < done; i++) {
+        const double x = a[i];
+        const double y = coeffs[0] * x + z1;
+        z1 = coeffs[1] * x - coeffs[3] * y + z2;
+        z2 = coeffs[2] * x - coeffs[4] * y;
+        CHECK_NEAR(out[i], y, 1e-5);
+    }
+}
+
+static void test_cmag(void) {
+    fill(4);
+    dsp_cmag_f32(a, out, MAX_LEN / 2, 0.5f);
+    for (size_t k = 0; k < MAX_LEN / 2; k++) {
+        const double ref = 0.5 * hypot(a[2 * k], a[2 * k + 1]);
+        CHECK_NEAR(out[k], ref, 1e-6);
+    }
+}
+
+static void test_fft_stage(void) {
+    // One stage over arbitrary data against the textbook butterfly
+    for (size_t size = 2; size <= 256; size <<= 1) {
+        const size_t n = 256, half = size >> 1;
+        const size_t stride = FFT_MAX_SIZE / size;
+        static double ref[2 * 256];
+    
+        fill((uint32_t)size);
+        memcpy(out, a, 2 * n * sizeof(float));
+        for (size_t i = 0; i < 2 * n; i++) {
+            ref[i] = a[i];
+        }
+    
+        dsp_fft2r_stage_f32(out, n, half, fft_twiddle_f32, stride);
+    
+        for (size_t base = 0; base < n; base += size) {
+            for (size_t k = 0; k < half; k++) {
+                const size_t p = base + k, q = p + half;
+                const double wr = cos(2 * M_PI * k / size);
+                const double wi = sin(2 * M_PI * k / size);
+                const double tr = wr * ref[2 * q] + wi * ref[2 * q + 1];
+                const double ti = wr * ref[2 * q + 1] - wi * ref[2 * q];
+                const double pr = ref[2 * p], pi = ref[2 * p + 1];
+                ref[2 * q] = pr - tr;
+                ref[2 * q + 1] = pi - ti;
+                ref[2 * p] = pr + tr;
+                ref[2 * p + 1] = pi + ti;
+            }
+        }
+    
+        for (size_t i = 0; i < 2 * n; i++) {
+            CHECK_NEAR(out[i], ref[i], 1e-5);
+        }
+    }
+}
+
+static void test_decimator_dot(void) {
+    static decimator_t dec;
+    CHECK(decimator_init(&dec, 1000.0f, 1));
+    
+    fill(5);
+    decimator_push(&dec, a, MAX_LEN);
+    
+    // Output j is taken at input index (j + 1) * FACTOR - 1, zero history before 0
+    const size_t outputs = MAX_LEN / DECIMATOR_FACTOR;
+    CHECK(decimator_available(&dec, 0) == outputs);
+    
+    float y[MAX_LEN / DECIMATOR_FACTOR];
+    CHECK(decimator_read(&dec, 0, y, outputs) == outputs);
+    
+    for (size_t j = 0; j < outputs; j++) {
+        const long t = (long)((j + 1) * DECIMATOR_FACTOR - 1);
+        double ref = 0;
+        for (long k = 0; k < DECIMATOR_TAPS && t - k >= 0; k++) {
+            ref += (double)decimator_taps[k] * a[t - k];
+        }
+        CHECK_NEAR(y[j], ref, 1e-5);
+    }
+}
+
+int main(void) {
+    TEST_RUN(test_dot);
+    TEST_RUN(test_mul);
+    TEST_RUN(test_biquad);
+    TEST_RUN(test_cmag);
+    TEST_RUN(test_fft_stage);
+    TEST_RUN(test_decimator_dot);
+    TEST_EXIT();
+}
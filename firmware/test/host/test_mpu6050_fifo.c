@@ -0,0 +1,299 @@
+/**
+ * MPU6050 FIFO acquisition against a simulated register map: the test
+ * provides the i2c_bus functions, backed by a 128-register file and a
+ * byte FIFO that behaves like the sensor's (FIFO_COUNT, FIFO_R_W pops,
+ * FIFO_RST clears). A register write can be made to fail once, to check
+ * that accelerometer-only switching rolls back.
+ */
+
+#include "test_common.h"
+#include "mpu6050.h"
+#include "i2c_bus.h"
+
+#include <string.h>
+
+#define REG_SMPLRT_DIV  0x19
+#define REG_CONFIG      0x1A
+#define REG_FIFO_EN     0x23
+#define REG_USER_CTRL   0x6A
+#define REG_FIFO_COUNTH 0x72
+#define REG_FIFO_R_W    0x74
+#define REG_WHO_AM_I    0x75
+#define REG_PWR_MGMT_2  0x6C
+
+#define FIFO_SRC_ALL    (MPU6050_FIFO_SRC_ACCEL | MPU6050_FIFO_SRC_GYRO | MPU6050_FIFO_SRC_TEMP)
+
+// ===========================================
+// Simulated Sensor
+// ===========================================
+static uint8_t regs[128];
+static uint8_t fifo[MPU6050_FIFO_SIZE];
+static size_t fifo_len;
+static size_t fifo_reads;       // FIFO_R_W transactions
+static int fail_reg = -1;       // Next write to this register fails
+
+struct i2c_bus_txn {
+    esp_err_t result;
+    bool in_use;
+};
+
+static struct i2c_bus_txn txns[I2C_BUS_MAX_PENDING];
+
+static void fifo_push(const uint8_t *bytes, size_t len) {
+    for (size_t i = 0; i < len && fifo_len < MPU6050_FIFO_SIZE; i++) {
+        fifo[fifo_len++] = bytes[i];
+    }
+}
+
+static void push_accel(int16_t x, int16_t y, int16_t z) {
+    const uint8_t frame[6] = {
+        (uint8_t)(x >> 8), (uint8_t)x, (uint8_t)(y >> 8), (uint8_t)y,
+        (uint8_t)(z >> 8), (uint8_t)z
+    };
+    fifo_push(frame, sizeof(frame));
+}
+
+esp_err_t i2c_bus_write_reg(i2c_port_t port, uint8_t addr, uint8_t reg,
+                            const uint8_t *data, size_t len) {
+    (void)port;
+    (void)addr;
+    
+    if (reg == fail_reg) {
+        fail_reg = -1;
+        return ESP_FAIL;
+    }
+    
+    for (size_t i = 0; i < len; i++) {
+        regs[(reg + i) & 0x7F] = data[i];
+    }
+    
+    // FIFO_RST clears the FIFO and self-clears, as does FIFO_EN with it
+    if (reg == REG_USER_CTRL && (data[0] & 0x04)) {
+        fifo_len = 0;
+        regs[REG_USER_CTRL] = 0;
+    }
+    
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_read_reg(i2c_port_t port, uint8_t addr, uint8_t reg,
+                           uint8_t *data, size_t len) {
+    (void)port;
+    (void)addr;
+    
+    if (reg == REG_FIFO_R_W) {
+        fifo_reads++;
+        for (size_t i = 0; i < len; i++) {
+            data[i] = fifo[0];
+            if (fifo_len > 0) {
+                memmove(fifo, fifo + 1, --fifo_len);
+            }
+        }
+        return ESP_OK;
+    }
+    
+    regs[REG_FIFO_COUNTH] = (uint8_t)(fifo_len >> 8);
+    regs[REG_FIFO_COUNTH + 1] = (uint8_t)fifo_len;
+    
+    for (size_t i = 0; i < len; i++) {
+        data[i] = regs[(reg + i) & 0x7F];
+    }
+    
+    return ESP_OK;
+}
+
+esp_err_t i2c_bus_submit_read(i2c_port_t port, uint8_t addr, uint8_t reg,
+                              uint8_t *data, size_t len, i2c_bus_txn_handle_t *txn) {
+    for (int i = 0; i < I2C_BUS_MAX_PENDING; i++) {
+        if (!txns[i].in_use) {
+            txns[i].in_use = true;
+            txns[i].result = i2c_bus_read_reg(port, addr, reg, data, len);
+            *txn = &txns[i];
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t i2c_bus_wait(i2c_bus_txn_handle_t txn, uint32_t timeout_ms) {
+    (void)timeout_ms;
+    txn->in_use = false;
+    return txn->result;
+}
+
+// ===========================================
+// Tests
+// ===========================================
+static mpu6050_handle_t dev;
+
+static void test_init(void) {
+    regs[REG_WHO_AM_I] = 0x68;
+    CHECK(mpu6050_init(I2C_NUM_0, MPU6050_ADDR_AD0_LOW, &dev) == ESP_OK);
+    
+    // A second open of the same address is refused
+    mpu6050_handle_t again = NULL;
+    CHECK(mpu6050_init(I2C_NUM_0, MPU6050_ADDR_AD0_LOW, &again) == ESP_ERR_INVALID_STATE);
+}
+
+static void test_enable(void) {
+    CHECK(mpu6050_fifo_enable(dev, 0) == ESP_ERR_INVALID_ARG);
+    
+    CHECK(mpu6050_fifo_enable(dev, FIFO_SRC_ALL) == ESP_OK);
+    CHECK(mpu6050_fifo_frame_size(dev) == 14);
+    
+    CHECK(mpu6050_fifo_enable(dev, MPU6050_FIFO_SRC_ACCEL) == ESP_OK);
+    CHECK(mpu6050_fifo_frame_size(dev) == 6);
+    CHECK(regs[REG_FIFO_EN] == MPU6050_FIFO_SRC_ACCEL);
+    CHECK(regs[REG_USER_CTRL] == 0x40);
+}
+
+static void test_drain_bursts(void) {
+    // 100 frames span three bursts of up to 42 frames
+    for (int i = 0; i < 100; i++) {
+        push_accel((int16_t)(i * 100 - 5000), (int16_t)-i, (int16_t)(16384 + i));
+    }
+    
+    // A trailing partial frame must stay in the FIFO
+    const uint8_t partial[3] = { 0x12, 0x34, 0x56 };
+    fifo_push(partial, sizeof(partial));
+    
+    static mpu6050_raw_data_t frames[128];
+    size_t n = 0;
+    fifo_reads = 0;
+    CHECK(mpu6050_fifo_read(dev, frames, 128, &n) == ESP_OK);
+    CHECK(n == 100);
+    CHECK(fifo_reads == 3);
+    CHECK(fifo_len == 3);
+    
+    for (int i = 0; i < (int)n; i++) {
+        CHECK(frames[i].accel_x_raw == i * 100 - 5000);
+        CHECK(frames[i].accel_y_raw == -i);
+        CHECK(frames[i].accel_z_raw == 16384 + i);
+        CHECK(frames[i].gyro_x_raw == 0 && frames[i].temp_raw == 0);
+    }
+    
+    // Completing the frame makes it readable, in order
+    const uint8_t rest[3] = { 0x78, 0x9A, 0xBC };
+    fifo_push(rest, sizeof(rest));
+    CHECK(mpu6050_fifo_read(dev, frames, 128, &n) == ESP_OK);
+    CHECK(n == 1);
+    CHECK(frames[0].accel_x_raw == 0x1234);
+    CHECK(frames[0].accel_y_raw == 0x5678);
+    CHECK(frames[0].accel_z_raw == (int16_t)0x9ABC);
+}
+
+static void test_max_frames(void) {
+    for (int i = 0; i < 20; i++) {
+        push_accel((int16_t)i, 0, 0);
+    }
+    
+    mpu6050_raw_data_t frames[8];
+    size_t n = 0;
+    CHECK(mpu6050_fifo_read(dev, frames, 8, &n) == ESP_OK);
+    CHECK(n == 8);
+    CHECK(frames[7].accel_x_raw == 7);
+    CHECK(fifo_len == 12 * 6);
+    
+    CHECK(mpu6050_fifo_read(dev, frames, 8, &n) == ESP_OK);
+    CHECK(n == 8 && frames[0].accel_x_raw == 8);
+    CHECK(mpu6050_fifo_read(dev, frames, 8, &n) == ESP_OK);
+    CHECK(n == 4 && frames[3].accel_x_raw == 19);
+}
+
+static void test_overflow(void) {
+    while (fifo_len < MPU6050_FIFO_SIZE) {
+        push_accel(1, 2, 3);
+    }
+    
+    mpu6050_raw_data_t frames[8];
+    size_t n = 99;
+    const uint32_t before = mpu6050_fifo_get_overflow_count(dev);
+    const uint32_t dropped = mpu6050_fifo_get_dropped_frames(dev);
+    const size_t held = fifo_len / 6;
+    CHECK(mpu6050_fifo_read(dev, frames, 8, &n) == ESP_ERR_INVALID_SIZE);
+    CHECK(n == 0);
+    CHECK(mpu6050_fifo_get_overflow_count(dev) == before + 1);
+    CHECK(mpu6050_fifo_get_dropped_frames(dev) == dropped + held);
+    
+    // The reset discards the misaligned data and re-enables the FIFO
+    CHECK(fifo_len == 0);
+    CHECK(regs[REG_USER_CTRL] == 0x40);
+}
+
+static void test_accel_only(void) {
+    CHECK(mpu6050_fifo_enable(dev, FIFO_SRC_ALL) == ESP_OK);
+    const uint8_t config = regs[REG_CONFIG];
+    const uint8_t div = regs[REG_SMPLRT_DIV];
+    
+    // Entering keeps only accel frames, leaving brings gyro and temp back
+    CHECK(mpu6050_set_accel_only(dev, true) == ESP_OK);
+    CHECK(regs[REG_PWR_MGMT_2] == 0x07);
+    CHECK(regs[REG_FIFO_EN] == MPU6050_FIFO_SRC_ACCEL);
+    CHECK(mpu6050_fifo_frame_size(dev) == 6);
+    CHECK(mpu6050_get_sample_rate_hz(dev) == 1000);
+    
+    CHECK(mpu6050_set_accel_only(dev, false) == ESP_OK);
+    CHECK(regs[REG_PWR_MGMT_2] == 0);
+    CHECK(regs[REG_FIFO_EN] == FIFO_SRC_ALL);
+    CHECK(mpu6050_fifo_frame_size(dev) == 14);
+    CHECK(regs[REG_CONFIG] == config && regs[REG_SMPLRT_DIV] == div);
+    
+    // A failed register write leaves the full-mode settings in place
+    fail_reg = REG_SMPLRT_DIV;
+    CHECK(mpu6050_set_accel_only(dev, true) == ESP_FAIL);
+    CHECK(!mpu6050_is_accel_only(dev));
+    CHECK(regs[REG_PWR_MGMT_2] == 0);
+    CHECK(regs[REG_CONFIG] == config && regs[REG_SMPLRT_DIV] == div);
+    CHECK(regs[REG_FIFO_EN] == FIFO_SRC_ALL);
+    
+    // So does a failed FIFO switch: gyro awake and still buffered
+    fail_reg = REG_FIFO_EN;
+    CHECK(mpu6050_set_accel_only(dev, true) == ESP_FAIL);
+    CHECK(!mpu6050_is_accel_only(dev));
+    CHECK(regs[REG_PWR_MGMT_2] == 0);
+    CHECK(regs[REG_FIFO_EN] == FIFO_SRC_ALL);
+    CHECK(mpu6050_fifo_frame_size(dev) == 14);
+    
+    // And on the way out, the device stays accel-only with accel frames
+    CHECK(mpu6050_set_accel_only(dev, true) == ESP_OK);
+    fail_reg = REG_FIFO_EN;
+    CHECK(mpu6050_set_accel_only(dev, false) == ESP_FAIL);
+    CHECK(mpu6050_is_accel_only(dev));
+    CHECK(regs[REG_PWR_MGMT_2] == 0x07);
+    CHECK(regs[REG_FIFO_EN] == MPU6050_FIFO_SRC_ACCEL);
+    CHECK(mpu6050_fifo_frame_size(dev) == 6);
+    
+    CHECK(mpu6050_set_accel_only(dev, false) == ESP_OK);
+    CHECK(regs[REG_FIFO_EN] == FIFO_SRC_ALL);
+}
+
+static void test_parse_layout(void) {
+    // Full frame: accel, temp, gyro X/Y/Z, big-endian
+    const uint8_t bytes[14] = {
+        0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00,
+        0xF0, 0x00,
+        0x7F, 0xFF, 0x80, 0x00, 0x00, 0x10
+    };
+    mpu6050_raw_data_t f;
+    mpu6050_fifo_parse(bytes, 1, MPU6050_FIFO_SRC_ACCEL | MPU6050_FIFO_SRC_TEMP |
+                                 MPU6050_FIFO_SRC_GYRO, &f);
+    CHECK(f.accel_x_raw == 1 && f.accel_y_raw == -2 && f.accel_z_raw == 16384);
+    CHECK(f.temp_raw == -4096);
+    CHECK(f.gyro_x_raw == 32767 && f.gyro_y_raw == -32768 && f.gyro_z_raw == 16);
+    
+    // Gyro only: frames are 6 bytes and accel stays zero
+    mpu6050_raw_data_t g[2];
+    mpu6050_fifo_parse(&bytes[8], 1, MPU6050_FIFO_SRC_GYRO, g);
+    CHECK(g[0].gyro_x_raw == 32767 && g[0].accel_x_raw == 0);
+}
+
+int main(void) {
+    TEST_RUN(test_init);
+    TEST_RUN(test_enable);
+    TEST_RUN(test_drain_bursts);
+    TEST_RUN(test_max_frames);
+    TEST_RUN(test_overflow);
+    TEST_RUN(test_accel_only);
+    TEST_RUN(test_parse_layout);
+    TEST_EXIT();
+}
@@ -0,0 +1,133 @@
+/**
+ * Running statistics: single-pass moments against a two-pass double
+ * reference, and Pebay merges of uneven windows (including empty ones)
+ * against accumulating the same samples in sequence.
+ */
+
+#include "test_common.h"
+#include "running_stats.h"
+
+#define LEN             3000
+
+static float x[LEN];
+
+typedef struct {
+    double mean, std, skew, kurt;
+} reference_t;
+
+static reference_t two_pass(const float *samples, size_t n) {
+    reference_t r = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < n; i++) {
+        r.mean += samples[i];
+    }
+    r.mean /= n;
+    
+    double m2 = 0, m3 = 0, m4 = 0;
+    for (size_t i = 0; i < n; i++) {
+        const double d = samples[i] - r.mean;
+        m2 += d * d;
+        m3 += d * d * d;
+        m4 += d * d * d * d;
+    }
+    r.std = sqrt(m2 / n);
+    r.skew = sqrt((double)n) * m3 / (m2 * sqrt(m2));
+    r.kurt = n * m4 / (m2 * m2);
+    return r;
+}
+
+// Skewed, heavy-tailed samples on an offset, like impacts on gravity
+static void fill(uint32_t seed) {
+    for (size_t i = 0; i < LEN; i++) {
+        const float r = test_rand(&seed);
+        x[i] = 1.0f + 0.2f * r + 0.3f * r * r * r * r;
+    }
+}
+
+static void test_against_reference(void) {
+    fill(11);
+    
+    running_stats_t s;
+    running_stats_reset(&s);
+    running_stats_add_block(&s, x, LEN);
+    
+    const reference_t r = two_pass(x, LEN);
+    CHECK(s.count == LEN);
+    CHECK_NEAR(s.mean, r.mean, 1e-5);
+    CHECK_NEAR(running_stats_std(&s), r.std, 1e-4 * r.std);
+    CHECK_NEAR(running_stats_skewness(&s), r.skew, 1e-3 * fabs(r.skew));
+    CHECK_NEAR(running_stats_kurtosis(&s), r.kurt, 1e-3 * r.kurt);
+    CHECK_NEAR(running_stats_rms(&s), sqrt(r.mean * r.mean + r.std * r.std), 1e-5);
+    CHECK(r.skew > 0.5);
+    
+    // A sine: kurtosis 1.5, no skew, peak equals amplitude
+    for (size_t i = 0; i < 1000; i++) {
+        x[i] = (float)(2.0 + 0.5 * sin(2 * M_PI * 5 * i / 1000.0));
+    }
+    running_stats_reset(&s);
+    running_stats_add_block(&s, x, 1000);
+    CHECK_NEAR(running_stats_kurtosis(&s), 1.5, 1e-3);
+    CHECK_NEAR(running_stats_skewness(&s), 0, 1e-3);
+    CHECK_NEAR(running_stats_peak(&s), 0.5, 1e-4);
+    CHECK_NEAR(running_stats_peak_to_peak(&s), 1.0, 1e-4);
+}
+
+static void test_merge_equals_sequential(void) {
+    fill(29);
+    
+    running_stats_t seq;
+    running_stats_reset(&seq);
+    running_stats_add_block(&seq, x, LEN);
+    
+    // Uneven windows, with empty ones on either side of a merge
+    const size_t cuts[] = { 0, 1, 1, 250, 1700, 1700, 2999, LEN };
+    running_stats_t merged, part;
+    running_stats_reset(&merged);
+    for (size_t c = 0; c + 1 < sizeof(cuts) / sizeof(cuts[0]); c++) {
+        running_stats_reset(&part);
+        running_stats_add_block(&part, &x[cuts[c]], cuts[c + 1] - cuts[c]);
+        running_stats_merge(&merged, &part);
+    }
+    
+    CHECK(merged.count == seq.count);
+    CHECK_NEAR(merged.mean, seq.mean, 1e-6);
+    CHECK_NEAR(merged.m2, seq.m2, 1e-4 * seq.m2);
+    CHECK_NEAR(merged.m3, seq.m3, 1e-3 * fabs(seq.m3));
+    CHECK_NEAR(merged.m4, seq.m4, 1e-3 * seq.m4);
+    CHECK(merged.min == seq.min);
+    CHECK(merged.max == seq.max);
+    CHECK_NEAR(running_stats_kurtosis(&merged), running_stats_kurtosis(&seq), 1e-3);
+    CHECK_NEAR(running_stats_skewness(&merged), running_stats_skewness(&seq), 1e-3);
+    
+    // Per-second windows folded into one, as for the long window
+    running_stats_reset(&merged);
+    for (size_t i = 0; i < LEN; i += 100) {
+        running_stats_reset(&part);
+        running_stats_add_block(&part, &x[i], 100);
+        running_stats_merge(&merged, &part);
+    }
+    CHECK_NEAR(running_stats_std(&merged), running_stats_std(&seq), 1e-5);
+    CHECK_NEAR(running_stats_kurtosis(&merged), running_stats_kurtosis(&seq), 1e-3);
+}
+
+static void test_empty(void) {
+    running_stats_t s;
+    running_stats_reset(&s);
+    CHECK(running_stats_std(&s) == 0);
+    CHECK(running_stats_rms(&s) == 0);
+    CHECK(running_stats_kurtosis(&s) == 0);
+    
+    // A constant has no spread and no shape
+    for (int i = 0; i < 10; i++) {
+        running_stats_add(&s, 3.0f);
+    }
+    CHECK(running_stats_std(&s) == 0);
+    CHECK(running_stats_skewness(&s) == 0);
+    CHECK_NEAR(running_stats_rms(&s), 3.0, 1e-6);
+}
+
+int main(void) {
+    TEST_RUN(test_against_reference);
+    TEST_RUN(test_merge_equals_sequential);
+    TEST_RUN(test_empty);
+    TEST_EXIT();
+}
@@ -0,0 +1,138 @@
+/**
+ * Sample buffers across wraparound: the structure-of-arrays store's
+ * zero-copy runs, and the raw int16 ring that feeds it (peek, consume and
+ * calibrated float conversion split around the wrap point).
+ */
+
+#include "test_common.h"
+#include "sample_store.h"
+#include "sample_ring.h"
+
+#define CAP     16
+
+static float storage[SAMPLE_STORE_STORAGE_SIZE(CAP)] __attribute__((aligned(SAMPLE_STORE_ALIGN)));
+
+// Channel c of sample i is i * 10 + c
+static void push_n(sample_store_t *st, size_t from, size_t n) {
+    for (size_t i = from; i < from + n; i++) {
+        float v[SAMPLE_STORE_CHANNELS];
+        for (int c = 0; c < SAMPLE_STORE_CHANNELS; c++) {
+            v[c] = (float)(i * 10 + c);
+        }
+        sample_store_push(st, v);
+    }
+}
+
+// The latest count samples of a channel must read oldest first
+static void check_latest(const sample_store_t *st, size_t pushed, size_t count) {
+    for (int c = 0; c < SAMPLE_STORE_CHANNELS; c++) {
+        const float *run1, *run2;
+        size_t len1 = 0;
+        const size_t n = sample_store_latest(st, (sample_store_channel_t)c, count,
+                                             &run1, &len1, &run2);
+        const size_t held = pushed < CAP ? pushed : CAP;
+        CHECK(n == (count < held ? count : held));
+        CHECK(len1 <= n);
+    
+        for (size_t k = 0; k < n; k++) {
+            const float v = (k < len1) ? run1[k] : run2[k - len1];
+            CHECK(v == (float)((pushed - n + k) * 10 + c));
+        }
+    }
+}
+
+static void test_store_init(void) {
+    sample_store_t st;
+    CHECK(!sample_store_init(&st, storage, 12));       // Not a power of two
+    CHECK(!sample_store_init(&st, storage, 2));        // Too small
+    CHECK(!sample_store_init(&st, storage + 1, CAP));  // Misaligned
+    CHECK(sample_store_init(&st, storage, CAP));
+    CHECK(sample_store_count(&st) == 0);
+    
+    for (int c = 0; c < SAMPLE_STORE_CHANNELS; c++) {
+        CHECK(((uintptr_t)st.channel[c] % SAMPLE_STORE_ALIGN) == 0);
+    }
+}
+
+static void test_store_wrap(void) {
+    sample_store_t st;
+    CHECK(sample_store_init(&st, storage, CAP));
+    
+    // Partly full, exactly full, then every wrap offset
+    size_t pushed = 0;
+    push_n(&st, pushed, 5);
+    pushed += 5;
+    check_latest(&st, pushed, 3);
+    check_latest(&st, pushed, 100);
+    
+    push_n(&st, pushed, CAP - 5);
+    pushed = CAP;
+    CHECK(sample_store_count(&st) == CAP);
+    check_latest(&st, pushed, CAP);
+    
+    for (size_t step = 0; step < 2 * CAP; step++) {
+        push_n(&st, pushed, 1);
+        pushed++;
+        CHECK(sample_store_count(&st) == CAP);
+        check_latest(&st, pushed, CAP);
+        check_latest(&st, pushed, CAP / 2 + 1);
+        check_latest(&st, pushed, 1);
+    }
+    
+    sample_store_reset(&st);
+    CHECK(sample_store_count(&st) == 0);
+}
+
+static void test_ring_wrap(void) {
+    static raw_accel_sample_t samples[8];
+    sample_ring_t ring;
+    CHECK(!sample_ring_init(&ring, samples, 6));
+    CHECK(sample_ring_init(&ring, samples, 8));
+    
+    const accel_calibration_t cal = {
+        .lsb_per_g = 8192.0f, .offset_x = 0.5f, .offset_y = -0.25f, .offset_z = 0.0f
+    };
+    
+    int16_t next = 0, expect = 0;
+    for (int round = 0; round < 10; round++) {
+        // Fill to capacity; the extra push is rejected and counted
+        while (sample_ring_push(&ring, next, (int16_t)-next, (int16_t)(2 * next))) {
+            next++;
+        }
+        CHECK(sample_ring_count(&ring) == 8);
+        CHECK(ring.dropped == (uint32_t)(round + 1));
+    
+        // Peek across the wrap point without consuming
+        raw_accel_sample_t peek[8];
+        CHECK(sample_ring_peek(&ring, 2, peek, 8) == 6);
+        CHECK(peek[0].x == expect + 2 && peek[5].x == expect + 7);
+        CHECK(sample_ring_count(&ring) == 8);
+    
+        // Consume a few, convert the rest (split at a moving wrap point)
+        const size_t skip = (size_t)round % 4;
+        CHECK(sample_ring_consume(&ring, skip) == skip);
+        expect = (int16_t)(expect + skip);
+    
+        float x[8], y[8], z[8];
+        const size_t n = sample_ring_read_float(&ring, &cal, x, y, z, 8);
+        CHECK(n == 8 - skip);
+        for (size_t i = 0; i < n; i++, expect++) {
+            CHECK_NEAR(x[i], expect / 8192.0 - 0.5, 1e-6);
+            CHECK_NEAR(y[i], -expect / 8192.0 + 0.25, 1e-6);
+            CHECK_NEAR(z[i], 2 * expect / 8192.0, 1e-6);
+        }
+        CHECK(sample_ring_count(&ring) == 0);
+    }
+    
+    // Reset drops whatever is buffered
+    sample_ring_push(&ring, 1, 2, 3);
+    sample_ring_reset(&ring);
+    CHECK(sample_ring_count(&ring) == 0);
+}
+
+int main(void) {
+    TEST_RUN(test_store_init);
+    TEST_RUN(test_store_wrap);
+    TEST_RUN(test_ring_wrap);
+    TEST_EXIT();
+}
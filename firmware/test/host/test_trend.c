@@ -0,0 +1,170 @@
+/**
+ * Trend: the sliding least-squares sums match a direct fit over the
+ * points each level holds after eviction, both models recover a known
+ * slope, and the time to a threshold follows from that slope, counted
+ * from the newest point even when a lagging coarse level answers.
+ */
+
+#include "test_common.h"
+#include "trend.h"
+
+#define RATIO           16
+#define PERIOD_S        60.0f           // One fine point per minute
+
+static trend_t trend;
+
+// Direct least squares over the points a level holds, oldest first
+static void direct_fit(const trend_series_t *s, bool log_scale, double *slope,
+                       double *at_newest, double *r2) {
+    const uint16_t first = (s->count == TREND_POINTS) ? s->head : 0;
+    double sx = 0, sy = 0, sxx = 0, sxy = 0, syy = 0;
+    const double n = s->count;
+    
+    for (uint16_t i = 0; i < s->count; i++) {
+        const double v = s->y[(first + i) % TREND_POINTS];
+        const double y = log_scale ? log(fmax(v, TREND_LOG_FLOOR)) : v;
+        sx += i;
+        sy += y;
+        sxx += (double)i * i;
+        sxy += i * y;
+        syy += y * y;
+    }
+    
+    const double cov = n * sxy - sx * sy;
+    const double dx = n * sxx - sx * sx;
+    const double dy = n * syy - sy * sy;
+    *slope = cov / dx;
+    *at_newest = (sy - *slope * sx) / n + *slope * (n - 1);
+    *r2 = cov * cov / (dx * dy);
+}
+
+static void test_sliding_sums(void) {
+    CHECK(trend_init(&trend, RATIO));
+    
+    // Long enough that both levels have evicted points
+    uint32_t seed = 17;
+    for (int i = 0; i < RATIO * TREND_POINTS + 300; i++) {
+        trend_push(&trend, 2.0f + 0.001f * i + 0.2f * test_rand(&seed));
+    }
+    CHECK(trend.level[0].count == TREND_POINTS);
+    CHECK(trend.level[1].count == TREND_POINTS);
+    
+    for (uint8_t lv = 0; lv < TREND_LEVELS; lv++) {
+        for (int m = 0; m < 2; m++) {
+            trend_fit_t fit;
+            double slope, current, r2;
+            CHECK(trend_fit(&trend, lv, m ? TREND_MODEL_EXPONENTIAL : TREND_MODEL_LINEAR, &fit));
+            direct_fit(&trend.level[lv], m, &slope, &current, &r2);
+            if (m) {
+                current = exp(current);
+            }
+            CHECK(fit.points == TREND_POINTS);
+            CHECK_NEAR(fit.slope, slope, 1e-6 + 1e-4 * fabs(slope));
+            CHECK_NEAR(fit.current, current, 1e-4 * current);
+            CHECK_NEAR(fit.r2, r2, 1e-4);
+        }
+    }
+    
+    // Coarse points are block means of the fine ones
+    trend_reset(&trend);
+    for (int i = 0; i < 2 * RATIO; i++) {
+        trend_push(&trend, (float)i);
+    }
+    CHECK(trend.level[1].count == 2);
+    CHECK_NEAR(trend.level[1].y[0], (RATIO - 1) / 2.0, 1e-6);
+    CHECK_NEAR(trend.level[1].y[1], RATIO + (RATIO - 1) / 2.0, 1e-6);
+}
+
+static void test_known_slope(void) {
+    trend_fit_t fit;
+    
+    // Linear: 0.01 per point from 1.0
+    CHECK(trend_init(&trend, RATIO));
+    for (int i = 0; i < 100; i++) {
+        trend_push(&trend, 1.0f + 0.01f * i);
+    }
+    CHECK(trend_fit(&trend, 0, TREND_MODEL_LINEAR, &fit));
+    CHECK_NEAR(fit.slope, 0.01, 1e-6);
+    CHECK_NEAR(fit.current, 1.99, 1e-5);
+    CHECK_NEAR(fit.r2, 1.0, 1e-6);
+    CHECK_NEAR(trend_points_to(&fit, 3.0f), 101, 0.01);
+    
+    // Fewer than ratio * TREND_MIN_POINTS points: the fine level answers
+    CHECK(!trend_fit(&trend, 1, TREND_MODEL_LINEAR, &fit));
+    CHECK_NEAR(trend_time_to(&trend, 3.0f, PERIOD_S, 0.9f), 101 * PERIOD_S, 1.0);
+    CHECK(trend_time_to(&trend, 1.5f, PERIOD_S, 0.9f) == 0);
+    
+    // Exponential: 2 % growth per point doubles in ln 2 / 0.02 points
+    CHECK(trend_init(&trend, RATIO));
+    for (int i = 0; i < 100; i++) {
+        trend_push(&trend, 0.5f * expf(0.02f * i));
+    }
+    CHECK(trend_fit(&trend, 0, TREND_MODEL_EXPONENTIAL, &fit));
+    CHECK_NEAR(fit.slope, 0.02, 1e-6);
+    CHECK_NEAR(fit.r2, 1.0, 1e-6);
+    CHECK_NEAR(trend_points_to(&fit, 2.0f * fit.current), log(2.0) / 0.02, 0.01);
+    CHECK_NEAR(trend_time_to(&trend, 2.0f * fit.current, PERIOD_S, 0.9f),
+               log(2.0) / 0.02 * PERIOD_S, 2.0);
+}
+
+static void test_coarse_lag(void) {
+    // 20 coarse points plus 5 pending fine ones: the coarse level answers
+    const int n = 20 * RATIO + 5;
+    CHECK(trend_init(&trend, RATIO));
+    for (int i = 0; i < n; i++) {
+        trend_push(&trend, 1.0f + 0.001f * i);
+    }
+    
+    trend_fit_t fit;
+    CHECK(trend_fit(&trend, 1, TREND_MODEL_LINEAR, &fit));
+    CHECK(fit.points == 20);
+    
+    // The newest coarse point is the mean of fine points 304..319, i.e.
+    // the ramp at 311.5, 12.5 fine periods behind the newest (324)
+    CHECK_NEAR(fit.current, 1.0 + 0.001 * 311.5, 1e-5);
+    
+    // Time from the newest point: (2.0 - 1.324) / 0.001 fine periods
+    const double expected = (2.0 - (1.0 + 0.001 * (n - 1))) / 0.001 * PERIOD_S;
+    CHECK_NEAR(trend_time_to(&trend, 2.0f, PERIOD_S, 0.9f), expected, 2.0);
+    
+    // Crossed between the coarse point and now: already reached
+    CHECK(trend_time_to(&trend, 1.0f + 0.001f * 318, PERIOD_S, 0.9f) == 0);
+}
+
+static void test_no_trend(void) {
+    CHECK(trend_init(&trend, RATIO));
+    CHECK(!trend_init(&trend, 1));
+    
+    // Too few points for any fit
+    for (int i = 0; i < TREND_MIN_POINTS - 1; i++) {
+        trend_push(&trend, 1.0f + i);
+    }
+    trend_push(&trend, NAN);
+    trend_push(&trend, INFINITY);
+    CHECK(trend.level[0].count == TREND_MIN_POINTS - 1);
+    CHECK(isnan(trend_time_to(&trend, 10.0f, PERIOD_S, 0.5f)));
+    
+    // Noise around a level: steady, never reaching a higher threshold
+    trend_reset(&trend);
+    uint32_t seed = 9;
+    for (int i = 0; i < 100; i++) {
+        trend_push(&trend, 1.0f + 0.1f * test_rand(&seed));
+    }
+    CHECK(isinf(trend_time_to(&trend, 2.0f, PERIOD_S, 0.8f)));
+    CHECK(trend_time_to(&trend, 0.5f, PERIOD_S, 0.8f) == 0);
+    
+    // Falling metric: not rising, so no time to a higher threshold
+    trend_reset(&trend);
+    for (int i = 0; i < 100; i++) {
+        trend_push(&trend, 5.0f - 0.01f * i);
+    }
+    CHECK(isinf(trend_time_to(&trend, 6.0f, PERIOD_S, 0.9f)));
+}
+
+int main(void) {
+    TEST_RUN(test_sliding_sums);
+    TEST_RUN(test_known_slope);
+    TEST_RUN(test_coarse_lag);
+    TEST_RUN(test_no_trend);
+    TEST_EXIT();
+}
@@ -0,0 +1,146 @@
+/**
+ * Welch PSD: the averaged density of a sine integrates to its power
+ * A^2 / 2 and peaks at its frequency, white noise reads its flat level
+ * 2 sigma^2 / fs, and the result does not depend on how the caller
+ * batched the samples.
+ */
+
+#include "test_common.h"
+#include "welch.h"
+
+#include <string.h>
+
+#define FS_HZ           1000.0f
+#define SEGMENT         256
+#define LEN             8192
+
+static float storage[WELCH_STORAGE_SIZE(SEGMENT)];
+static float storage2[WELCH_STORAGE_SIZE(SEGMENT)];
+static float x[LEN];
+static welch_t w, w2;
+
+static const welch_config_t config = {
+    .segment_len = SEGMENT,
+    .overlap = WELCH_OVERLAP_50,
+    .averaging = WELCH_AVG_LINEAR,
+    .alpha = 0,
+    .window = FFT_WINDOW_HANN,
+    .sample_rate_hz = FS_HZ,
+};
+
+// Push in uneven batches, as raw drains arrive
+static uint32_t push_batched(welch_t *est, const float *samples, size_t count, size_t batch) {
+    uint32_t segments = 0;
+    for (size_t i = 0; i < count; i += batch) {
+        const size_t run = (count - i < batch) ? count - i : batch;
+        segments += welch_push(est, &samples[i], run);
+    }
+    return segments;
+}
+
+static double psd_power(const welch_t *est) {
+    uint16_t bins;
+    const float *psd = welch_psd(est, &bins);
+    double sum = 0;
+    for (uint16_t k = 0; k < bins; k++) {
+        sum += psd[k];
+    }
+    return sum * welch_bin_hz(est);
+}
+
+static void test_sine_power(void) {
+    // Off-bin tone on an offset; the segment mean is removed
+    const double amp = 0.7, freq = 73.3;
+    for (size_t i = 0; i < LEN; i++) {
+        x[i] = (float)(1.0 + amp * sin(2 * M_PI * freq * i / FS_HZ));
+    }
+    
+    CHECK(welch_init(&w, &config, storage));
+    CHECK(push_batched(&w, x, LEN, 100) == 1 + (LEN - SEGMENT) / (SEGMENT / 2));
+    CHECK_NEAR(welch_bin_hz(&w), FS_HZ / SEGMENT, 1e-6);
+    
+    CHECK_NEAR(psd_power(&w), amp * amp / 2, 0.01 * amp * amp / 2);
+    
+    uint16_t bins;
+    const float *psd = welch_psd(&w, &bins);
+    CHECK(bins == SEGMENT / 2);
+    const uint16_t peak = fft_find_peak(psd, bins, 1, NULL);
+    CHECK(peak == (uint16_t)lround(freq / welch_bin_hz(&w)));
+    
+    // The offset is gone: only window leakage of the tone reaches DC
+    CHECK(psd[0] < 1e-3f * psd[peak]);
+}
+
+static void test_noise_level(void) {
+    // Uniform noise in [-1, 1): variance 1/3 spread over 0 .. fs/2
+    uint32_t seed = 7;
+    for (size_t i = 0; i < LEN; i++) {
+        x[i] = test_rand(&seed);
+    }
+    
+    CHECK(welch_init(&w, &config, storage));
+    welch_push(&w, x, LEN);
+    
+    uint16_t bins;
+    const float *psd = welch_psd(&w, &bins);
+    double mean = 0;
+    for (uint16_t k = 1; k < bins; k++) {
+        mean += psd[k];
+    }
+    mean /= bins - 1;
+    
+    const double level = 2.0 * (1.0 / 3.0) / FS_HZ;
+    CHECK_NEAR(mean, level, 0.05 * level);
+    CHECK_NEAR(psd_power(&w), 1.0 / 3.0, 0.03);
+}
+
+static void test_batching(void) {
+    uint32_t seed = 3;
+    for (size_t i = 0; i < LEN; i++) {
+        x[i] = (float)(0.3 * sin(2 * M_PI * 120.0 * i / FS_HZ)) + 0.1f * test_rand(&seed);
+    }
+    
+    welch_config_t cfg = config;
+    cfg.overlap = WELCH_OVERLAP_75;
+    CHECK(welch_init(&w, &cfg, storage));
+    CHECK(welch_init(&w2, &cfg, storage2));
+    
+    const uint32_t whole = welch_push(&w, x, LEN);
+    const uint32_t pieces = push_batched(&w2, x, LEN, 7);
+    CHECK(whole == pieces);
+    CHECK(whole == 1 + (LEN - SEGMENT) / (SEGMENT / 4));
+    CHECK(welch_segment_count(&w) == whole);
+    
+    uint16_t bins;
+    const float *a = welch_psd(&w, &bins);
+    const float *b = welch_psd(&w2, NULL);
+    CHECK(memcmp(a, b, bins * sizeof(float)) == 0);
+    
+    welch_reset(&w);
+    CHECK(welch_segment_count(&w) == 0);
+    CHECK(welch_push(&w, x, SEGMENT - 1) == 0);
+    CHECK(welch_push(&w, x, 1) == 1);
+}
+
+static void test_invalid_config(void) {
+    welch_config_t cfg = config;
+    cfg.segment_len = 300;
+    CHECK(!welch_init(&w, &cfg, storage));
+    
+    cfg = config;
+    cfg.averaging = WELCH_AVG_EXPONENTIAL;
+    cfg.alpha = 0;
+    CHECK(!welch_init(&w, &cfg, storage));
+    
+    cfg = config;
+    cfg.sample_rate_hz = 0;
+    CHECK(!welch_init(&w, &cfg, storage));
+}
+
+int main(void) {
+    TEST_RUN(test_sine_power);
+    TEST_RUN(test_noise_level);
+    TEST_RUN(test_batching);
+    TEST_RUN(test_invalid_config);
+    TEST_EXIT();
+}
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""
+Generate the anti-alias FIR for firmware/src/dsp/decimator.
+
+One Kaiser-windowed sinc low-pass serves every stage: each stage decimates
+by the same factor, so the response is the same relative to its own input
+rate. The passband keeps the lowest pass_fraction of the output band; the
+stopband starts where content would alias back into that passband.
+
+Usage: python3 gen_decimator_taps.py [factor] [taps] [atten_db] > ../src/dsp/decimator_taps.c
+"""
+
+import math
+import sys
+
+
+def bessel_i0(x):
+    total, term, k = 1.0, 1.0, 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def design(factor, taps, atten_db):
+    if atten_db > 50:
+        beta = 0.1102 * (atten_db - 8.7)
+    else:
+        beta = 0.5842 * (atten_db - 21) ** 0.4 + 0.07886 * (atten_db - 21)
+
+    # Cutoff halfway through the transition band: the output Nyquist
+    fc = 0.5 / factor
+    mid = (taps - 1) / 2.0
+    h = []
+    for n in range(taps):
+        t = n - mid
+        sinc = 2.0 * fc if t == 0 else math.sin(2.0 * math.pi * fc * t) / (math.pi * t)
+        w = bessel_i0(beta * math.sqrt(1.0 - (t / mid) ** 2)) / bessel_i0(beta)
+        h.append(sinc * w)
+
+    # Unity DC gain
+    s = sum(h)
+    return [v / s for v in h]
+
+
+def response_db(h, f):
+    re = sum(v * math.cos(2.0 * math.pi * f * n) for n, v in enumerate(h))
+    im = sum(v * math.sin(2.0 * math.pi * f * n) for n, v in enumerate(h))
+    return 20.0 * math.log10(max(math.hypot(re, im), 1e-12))
+
+
+def main():
+    factor = int(sys.argv[1]) if len(sys.argv) > 1 else 10
+    taps = int(sys.argv[2]) if len(sys.argv) > 2 else 100
+    atten_db = float(sys.argv[3]) if len(sys.argv) > 3 else 60.0
+    pass_fraction = 0.3
+
+    if taps % factor != 0:
+        sys.exit("taps must be a multiple of factor")
+
+    h = design(factor, taps, atten_db)
+
+    # Report the achieved response in the generated file
+    f_pass = pass_fraction / factor
+    f_stop = (1.0 - pass_fraction) / factor
+    grid = 2000
+    ripple = max(abs(response_db(h, f_pass * i / grid)) for i in range(grid + 1))
+    stop = max(response_db(h, f_stop + (0.5 - f_stop) * i / grid) for i in range(grid + 1))
+
+    print("/**")
+    print(" * VibeMon Decimator Taps")
+    print(f" * Generated by tools/gen_decimator_taps.py for factor {factor}, {taps} taps. Do not edit.")
+    print(f" * Passband 0..{pass_fraction:.2f} x output rate: +/-{ripple:.3f} dB")
+    print(f" * Aliasing bands (>= {1.0 - pass_fraction:.2f} x output rate): {stop:.1f} dB")
+    print(" */")
+    print()
+    print('#include "decimator_taps.h"')
+    print()
+    print(f"#if DECIMATOR_FACTOR != {factor} || DECIMATOR_TAPS != {taps}")
+    print("#error \"decimator_taps.c was generated for a different factor or length\"")
+    print("#endif")
+    print()
+    print("const float decimator_taps[DECIMATOR_TAPS] = {")
+    for i in range(0, taps, 4):
+        print("    " + ", ".join(f"{v:.9e}f" for v in h[i:i + 4]) + ",")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""
+Generate FFT twiddle and bit-reversal tables for firmware/src/dsp.
+
+Tables are built for FFT_MAX_SIZE; smaller power-of-two transforms index
+them with a stride, so one set serves every size.
+
+Usage: python3 gen_fft_tables.py [max_log2] > ../src/dsp/fft_tables.c
+"""
+
+import math
+import sys
+
+
+def emit_array(ctype, name, size_expr, values, fmt, per_line):
+    print(f"const {ctype} {name}[{size_expr}] = {{")
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        print("    " + ", ".join(fmt(v) for v in chunk) + ",")
+    print("};")
+    print()
+
+
+def q15(v):
+    # Symmetric range keeps -w representable
+    return max(-32767, min(32767, int(round(v * 32768.0))))
+
+
+def main():
+    max_log2 = int(sys.argv[1]) if len(sys.argv) > 1 else 11
+    n = 1 << max_log2
+
+    # W_N^k = cos(2*pi*k/N) - i*sin(2*pi*k/N), k < N/2, stored as (cos, sin)
+    tw = []
+    for k in range(n // 2):
+        a = 2.0 * math.pi * k / n
+        tw.extend([math.cos(a), math.sin(a)])
+
+    rev = [int(format(i, f"0{max_log2}b")[::-1], 2) for i in range(n)]
+
+    print("/**")
+    print(" * VibeMon FFT Tables")
+    print(f" * Generated by tools/gen_fft_tables.py for FFT_MAX_SIZE = {n}. Do not edit.")
+    print(" */")
+    print()
+    print('#include "fft_tables.h"')
+    print()
+    print(f"#if FFT_MAX_SIZE != {n}")
+    print("#error \"fft_tables.c was generated for a different FFT_MAX_SIZE\"")
+    print("#endif")
+    print()
+    emit_array("float", "fft_twiddle_f32", "FFT_MAX_SIZE", tw,
+               lambda v: f"{v:.9e}f", 4)
+    emit_array("int16_t", "fft_twiddle_q15", "FFT_MAX_SIZE", [q15(v) for v in tw],
+               lambda v: f"{v:6d}", 8)
+    emit_array("uint16_t", "fft_bitrev", "FFT_MAX_SIZE", rev,
+               lambda v: f"{v:4d}", 12)
+
+
+if __name__ == "__main__":
+    main()
@@ -9,6 +9,7 @@
  * - Пиковые значения (Peak) для детекции ударов
  * - Peak-to-Peak (размах) 
  * - Crest Factor (отношение пик/RMS) - диагностика подшипников
+ * - Статистика и доминантная частота по каждой оси X/Y/Z
  * - Фильтрация шума (высокочастотный фильтр)
  * - Скользящее среднее для стабильности показаний
  * 
@@ -54,6 +55,20 @@
 #define SAMPLES 256              // Количество сэмплов FFT (степень 2)
 #define SAMPLING_FREQUENCY 1000  // Частота дискретизации Гц (Найквист = 500 Гц)
 
+// Скорость по ISO 10816: интегрирование спектра ускорения в полосе 10–1000 Гц
+#define VELOCITY_BAND_LOW 10.0       // Гц
+#define VELOCITY_BAND_HIGH 1000.0    // Гц (ограничено Найквистом)
+#define VELOCITY_HIGHPASS_HZ 10.0    // Срез ВЧ фильтра по умолчанию (Гц)
+#define VELOCITY_HIGHPASS_ORDER 4    // Порядок Баттерворта
+#define HAMMING_POWER_GAIN 0.3974    // Среднее w^2 окна Хэмминга
+
+// Оценка частоты вращения без тахометра (спектр гармонических произведений)
+#define HPS_HARMONICS 3              // Сколько гармоник перемножать
+#define RUNNING_SPEED_MIN 5.0        // Гц (300 об/мин)
+#define HAMMING_COHERENT_GAIN 0.54   // Среднее окна Хэмминга
+#define ORDER_SPECTRUM_SIZE 16       // Порядковый спектр: 0.5x..8x с шагом 0.5x
+#define ORDER_STEP 0.5
+
 // Интервал отправки данных по BLE (мс)
 #define BLE_UPDATE_INTERVAL 500
 
@@ -91,10 +106,18 @@ Adafruit_MPU6050 mpu;
 bool mpuAvailable = false;
 bool tempSensorAvailable = false;
 
-// FFT буферы
-double vReal[SAMPLES];
-double vImag[SAMPLES];
-ArduinoFFT<double> FFT = ArduinoFFT<double>(vReal, vImag, SAMPLES, SAMPLING_FREQUENCY);
+// FFT буферы: float, т.к. FPU ESP32 не поддерживает double
+// (double считается программно и в разы медленнее)
+float vReal[SAMPLES];
+float vImag[SAMPLES];
+ArduinoFFT<float> FFT = ArduinoFFT<float>(vReal, vImag, SAMPLES, SAMPLING_FREQUENCY);
+
+// Оси X/Y/Z (м/с², без гравитации). Два вещественных сигнала считаются одним
+// комплексным FFT: X/Y в pairReal/pairImag, Z - в vImag вместе с модулем в vReal
+float axisSamples[3][SAMPLES];
+float pairReal[SAMPLES];
+float pairImag[SAMPLES];
+ArduinoFFT<float> pairFFT = ArduinoFFT<float>(pairReal, pairImag, SAMPLES, SAMPLING_FREQUENCY);
 
 // Буфер для скользящего среднего
 #define MOVING_AVG_SIZE 10
@@ -102,6 +125,15 @@ float rmsHistory[MOVING_AVG_SIZE];
 int rmsHistoryIndex = 0;
 bool rmsHistoryFull = false;
 
+// Статистика одной оси (динамическое ускорение без среднего)
+struct AxisStats {
+  float rms;           // RMS в м/с²
+  float peak;          // Пиковое значение
+  float crestFactor;   // Peak/RMS
+  float dominantFreq;  // Доминантная частота (Гц)
+};
+static_assert(sizeof(AxisStats) == 16, "AxisStats передаётся по BLE как 4 float");
+
 // Данные вибрации
 struct VibrationData {
   float rms;           // RMS в g
@@ -111,11 +143,18 @@ struct VibrationData {
   float crestFactor;   // Crest Factor (Peak/RMS)
   float dominantFreq;  // Доминантная частота (Гц)
   float dominantAmp;   // Амплитуда доминантной частоты
+  float runningSpeed;  // Частота вращения 1x (Гц), 0 если не найдена
+  float order1x;       // Амплитуда 1x (м/с²)
+  float order2x;       // Амплитуда 2x (м/с²)
+  float order3x;       // Амплитуда 3x (м/с²)
+  AxisStats axis[3];   // X, Y, Z: осевые и радиальные составляющие раздельно
   uint8_t status;      // 0=Good, 1=Acceptable, 2=Alarm, 3=Danger
 };
 
 VibrationData vibData;
+float orderSpectrum[ORDER_SPECTRUM_SIZE]; // Амплитуды на 0.5x, 1x, ... 8x (м/с²)
 float temperature = 0.0;
+float velocityHighpassHz = VELOCITY_HIGHPASS_HZ; // Меняется командой 0x04
 
 // Таймеры
 unsigned long lastBLEUpdate = 0;
@@ -143,6 +182,7 @@ void saveCalibration();
 // 0x01 = Перекалибровка
 // 0x02 = Сброс настроек  
 // 0x03 = Перезагрузка
+// 0x04 = Срез ВЧ фильтра скорости (float, Гц, 4 байта после команды)
 class CommandCallbacks : public BLECharacteristicCallbacks {
   void onWrite(BLECharacteristic* pCharacteristic) {
     String value = pCharacteristic->getValue();
@@ -173,6 +213,19 @@ class CommandCallbacks : public BLECharacteristicCallbacks {
           ESP.restart();
           break;
           
+        case 0x04:  // Срез ВЧ фильтра скорости
+          if (value.length() >= 5) {
+            float hz;
+            memcpy(&hz, value.c_str() + 1, sizeof(hz));
+            if (isfinite(hz) && hz >= 0 && hz < SAMPLING_FREQUENCY / 2) {
+              velocityHighpassHz = hz;
+              Serial.printf("🎚️ Команда: ВЧ фильтр скорости %.1f Гц\n", hz);
+              break;
+            }
+          }
+          Serial.println("❓ Неверный параметр ВЧ фильтра");
+          break;
+          
         default:
           Serial.printf("❓ Неизвестная команда: 0x%02X\n", command);
       }
@@ -277,7 +330,7 @@ void initBLE() {
   );
   pVibrationCharacteristic->addDescriptor(new BLE2902());
 
-  // Спектр FFT (8 основных частотных полос)
+  // Спектр FFT (8 основных частотных полос + порядковый спектр)
   pSpectrumCharacteristic = pService->createCharacteristic(
     SPECTRUM_CHAR_UUID,
     BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY
@@ -438,6 +491,9 @@ void collectSamples() {
       float linY = a.acceleration.y - gravityY;
       float linZ = a.acceleration.z - gravityZ;
       float linearMag = sqrt(linX * linX + linY * linY + linZ * linZ);
+      axisSamples[0][i] = linX;
+      axisSamples[1][i] = linY;
+      axisSamples[2][i] = linZ;
 
       // Дополнительный ВЧ фильтр для удаления остаточного DC
       float filtered = removeOffset(linearMag, prevInput, prevOutput);
@@ -460,6 +516,9 @@ void collectSamples() {
       
       vReal[i] = simulated;
       vImag[i] = 0;
+      axisSamples[0][i] = 0.5 * sin(2 * PI * 25 * t);   // Радиально: дисбаланс
+      axisSamples[1][i] = 0.3 * sin(2 * PI * 50 * t);
+      axisSamples[2][i] = 0.2 * sin(2 * PI * 100 * t);  // Осевая: 2x, расцентровка
       
       if (simulated < minVal) minVal = simulated;
       if (simulated > maxVal) maxVal = simulated;
@@ -479,6 +538,25 @@ void collectSamples() {
   vibData.peakToPeak = maxVal - minVal;
   vibData.crestFactor = (vibData.rms > 0) ? vibData.peak / vibData.rms : 0;
   
+  // То же по каждой оси, относительно среднего за окно
+  for (int a = 0; a < 3; a++) {
+    const float* x = axisSamples[a];
+    float mean = 0;
+    for (int i = 0; i < SAMPLES; i++) mean += x[i];
+    mean /= SAMPLES;
+    
+    float sq = 0, pk = 0;
+    for (int i = 0; i < SAMPLES; i++) {
+      float d = x[i] - mean;
+      sq += d * d;
+      pk = max(pk, fabsf(d));
+    }
+    AxisStats& s = vibData.axis[a];
+    s.rms = sqrtf(sq / SAMPLES);
+    s.peak = pk;
+    s.crestFactor = (s.rms > 0) ? s.peak / s.rms : 0;
+  }
+  
   // ПОКА НЕ вычисляем скорость - сначала найдём доминантную частоту через FFT
   // Это будет сделано в performFFTAnalysis()
   vibData.rmsVelocity = 0.0; // Временно
@@ -486,17 +564,27 @@ void collectSamples() {
 
 // ========== FFT АНАЛИЗ ==========
 void performFFTAnalysis() {
-  // Применяем окно Хэмминга для уменьшения спектральной утечки
-  FFT.windowing(FFTWindow::Hamming, FFTDirection::Forward);
+  // Окно Хэмминга: один проход по весам для всех четырёх сигналов
+  // (модуль, X, Y, Z), чтобы не считать косинус четыре раза
+  for (int i = 0; i < SAMPLES; i++) {
+    const float w = 0.54f - 0.46f * cosf(2.0f * PI * i / (SAMPLES - 1));
+    vReal[i] *= w;
+    vImag[i] = axisSamples[2][i] * w;
+    pairReal[i] = axisSamples[0][i] * w;
+    pairImag[i] = axisSamples[1][i] * w;
+  }
   
-  // Выполняем FFT
+  // Два FFT вместо четырёх: (модуль + jZ) и (X + jY)
   FFT.compute(FFTDirection::Forward);
+  pairFFT.compute(FFTDirection::Forward);
   
-  // Преобразуем в амплитуды
-  FFT.complexToMagnitude();
+  // Разделение пар: A[k] = (C[k] + C*[N-k]) / 2, B[k] = (C[k] - C*[N-k]) / 2j.
+  // vReal[k] становится |модуль[k]|, как после complexToMagnitude()
+  unpackPairSpectrum(vReal, vImag, vReal, nullptr, &vibData.axis[2]);
+  unpackPairSpectrum(pairReal, pairImag, nullptr, &vibData.axis[0], &vibData.axis[1]);
   
   // Находим доминантную частоту (пропускаем DC компоненту)
-  double maxMag = 0;
+  float maxMag = 0;
   int maxIndex = 1;
   
   for (int i = 2; i < SAMPLES / 2; i++) {
@@ -510,41 +598,144 @@ void performFFTAnalysis() {
   vibData.dominantFreq = (float)maxIndex * SAMPLING_FREQUENCY / SAMPLES;
   vibData.dominantAmp = maxMag / (SAMPLES / 2); // Нормализация
   
-  // ПРАВИЛЬНЫЙ расчёт RMS скорости с учётом доминантной частоты
-  // Формула: v = a / (2 * PI * f), результат в мм/с
+  // RMS скорости из того же спектра (без второго FFT)
+  vibData.rmsVelocity = computeVelocityRMS();
+  
+  // Частота вращения и порядковый анализ - тоже по готовому спектру
+  estimateRunningSpeed();
+}
+
+// Амплитуды двух вещественных сигналов из общего комплексного спектра C.
+// Пишет |A[k]| в magA (если задан), доминантные частоты A и B - в axisA/axisB.
+// Бины k < N/2 пишутся поверх re[k]; C[N-k] при этом ещё не тронут.
+void unpackPairSpectrum(float* re, const float* im, float* magA,
+                        AxisStats* axisA, AxisStats* axisB) {
+  float maxA = 0, maxB = 0;
+  int peakA = 1, peakB = 1;
+  
+  for (int k = 0; k < SAMPLES / 2; k++) {
+    const int j = (SAMPLES - k) & (SAMPLES - 1);
+    const float sr = re[k] + re[j], si = im[k] - im[j];   // 2A
+    const float dr = re[k] - re[j], di = im[k] + im[j];   // 2jB
+    const float a = 0.5f * sqrtf(sr * sr + si * si);
+    const float b = 0.5f * sqrtf(dr * dr + di * di);
+    
+    if (magA) magA[k] = a;
+    if (k < 2) continue;  // Без DC, как для модуля
+    if (a > maxA) { maxA = a; peakA = k; }
+    if (b > maxB) { maxB = b; peakB = k; }
+  }
+  
+  const float binHz = (float)SAMPLING_FREQUENCY / SAMPLES;
+  if (axisA) axisA->dominantFreq = peakA * binHz;
+  if (axisB) axisB->dominantFreq = peakB * binHz;
+}
+
+// ========== ЧАСТОТА ВРАЩЕНИЯ И ПОРЯДКИ ==========
+// Амплитуда (м/с²) на произвольной частоте: максимум соседних бинов,
+// чтобы не терять пик между бинами
+float amplitudeAt(float freq) {
+  const float binHz = (float)SAMPLING_FREQUENCY / SAMPLES;
+  int k = (int)(freq / binHz + 0.5f);
+  if (k < 1 || k >= SAMPLES / 2) return 0;
   
-  // КРИТИЧНО: Многоуровневая проверка для устранения ложных показаний
+  float mag = vReal[k];
+  if (k > 1) mag = max(mag, vReal[k - 1]);
+  if (k + 1 < SAMPLES / 2) mag = max(mag, vReal[k + 1]);
   
-  // Уровень 1: Проверка RMS ускорения (увеличен порог)
-  if (vibData.rms < 0.1) {  
-    // Ускорение < 0.1 м/с² = шум/покой
-    vibData.rmsVelocity = 0.0;
+  return 2.0f * mag / (SAMPLES * HAMMING_COHERENT_GAIN);
+}
+
+// Спектр гармонических произведений: HPS[k] = |X[k]| * |X[2k]| * ... * |X[Hk]|.
+// Гармоники 1x/2x/3x усиливают друг друга, поэтому пик HPS - основная частота,
+// даже если самый высокий бин спектра - гармоника. Считается в логарифмах.
+// Вызывать после FFT.complexToMagnitude().
+void estimateRunningSpeed() {
+  const float binHz = (float)SAMPLING_FREQUENCY / SAMPLES;
+  const int kMin = max(1, (int)ceilf(RUNNING_SPEED_MIN / binHz));
+  const int kMax = (SAMPLES / 2 - 1) / HPS_HARMONICS;
+  
+  vibData.runningSpeed = 0;
+  vibData.order1x = vibData.order2x = vibData.order3x = 0;
+  memset(orderSpectrum, 0, sizeof(orderSpectrum));
+  
+  if (kMax <= kMin) return;
+  
+  // Логарифм HPS в точках k-1, k, k+1 для параболической интерполяции
+  auto logHps = [](int k) {
+    float sum = 0;
+    for (int h = 1; h <= HPS_HARMONICS; h++) {
+      sum += logf(vReal[h * k] + 1e-9f);
+    }
+    return sum;
+  };
+  
+  int peak = kMin;
+  float peakVal = logHps(kMin);
+  for (int k = kMin + 1; k <= kMax; k++) {
+    float v = logHps(k);
+    if (v > peakVal) {
+      peakVal = v;
+      peak = k;
+    }
+  }
+  
+  // Пик HPS должен заметно выделяться над шумом основного бина
+  if (vReal[peak] * 2.0f / (SAMPLES * HAMMING_COHERENT_GAIN) < 0.01f) return;
+  
+  // Уточнение между бинами: парабола по логарифму (точна для гауссова пика)
+  float frac = 0;
+  if (peak > kMin && peak < kMax) {
+    float a = logHps(peak - 1);
+    float c = logHps(peak + 1);
+    float denom = a - 2.0f * peakVal + c;
+    if (denom < 0) frac = 0.5f * (a - c) / denom;
   }
-  // Уровень 2: Проверка доминантной частоты и амплитуды
-  else if (vibData.dominantFreq < 3.0 || vibData.dominantAmp < 0.01) {
-    // Частота слишком низкая (<3 Гц) или амплитуда слишком мала
-    // Это скорее всего шум или дрейф датчика
-    vibData.rmsVelocity = 0.0;
+  
+  vibData.runningSpeed = (peak + frac) * binHz;
+  vibData.order1x = amplitudeAt(vibData.runningSpeed);
+  vibData.order2x = amplitudeAt(2 * vibData.runningSpeed);
+  vibData.order3x = amplitudeAt(3 * vibData.runningSpeed);
+  
+  // Порядковый спектр: ось в долях частоты вращения, не зависит от скорости
+  for (int i = 0; i < ORDER_SPECTRUM_SIZE; i++) {
+    orderSpectrum[i] = amplitudeAt((i + 1) * ORDER_STEP * vibData.runningSpeed);
   }
-  // Уровень 3: Нормальный расчёт с реальной частотой
-  else if (vibData.dominantFreq >= 3.0 && vibData.dominantFreq <= 500.0) {
-    vibData.rmsVelocity = (vibData.rms * 1000.0) / (2.0 * PI * vibData.dominantFreq);
+}
+
+// ========== СКОРОСТЬ ВИБРАЦИИ (ISO 10816) ==========
+// Интегрирование в частотной области: V(f) = A(f) / (j*2*PI*f) по каждому бину.
+// Верно для любого спектра, а не только для одной синусоиды.
+// Вызывать после FFT.complexToMagnitude() (vReal = |X[k]|, окно Хэмминга).
+float computeVelocityRMS() {
+  const float binHz = (float)SAMPLING_FREQUENCY / SAMPLES;
+  const float bandHigh = min((float)VELOCITY_BAND_HIGH, SAMPLING_FREQUENCY / 2.0f);
+  
+  // Парсеваль для одностороннего спектра с окном:
+  // rms^2 = sum(2 * |X[k]|^2) / (N^2 * mean(w^2))
+  const float scale = 2.0f / ((float)SAMPLES * SAMPLES * HAMMING_POWER_GAIN);
+  
+  float sumSquares = 0;
+  for (int k = 1; k < SAMPLES / 2; k++) {
+    float f = k * binHz;
+    if (f < VELOCITY_BAND_LOW || f > bandHigh) continue;
     
-    // Мёртвая зона: если < 0.5 мм/с, считаем за 0
-    if (vibData.rmsVelocity < 0.5) {
-      vibData.rmsVelocity = 0.0;
+    // |H|^2 Баттерворта ВЧ: 1 / (1 + (fc/f)^(2n))
+    float gain = 1.0f;
+    if (velocityHighpassHz > 0) {
+      float r2 = (velocityHighpassHz / f) * (velocityHighpassHz / f);
+      float r = 1.0f;
+      for (int i = 0; i < VELOCITY_HIGHPASS_ORDER; i++) r *= r2;
+      gain = 1.0f / (1.0f + r);
     }
-  }
-  // Уровень 4: Fallback (не должно происходить)
-  else {
-    vibData.rmsVelocity = 0.0;
+    
+    float omega = 2.0f * PI * f;
+    float mag = vReal[k];
+    sumSquares += mag * mag * gain / (omega * omega);
   }
   
-  // Дополнительная защита от аномально высоких значений
-  if (vibData.rmsVelocity > 100.0) {  
-    // Что-то пошло не так (> 100 мм/с это катастрофа)
-    vibData.rmsVelocity = 0.0;
-  }
+  // Ускорение в м/с² -> скорость в мм/с
+  return sqrtf(sumSquares * scale) * 1000.0f;
 }
 
 // ========== ОПРЕДЕЛЕНИЕ СТАТУСА ==========
@@ -630,8 +821,10 @@ void sendBLEData() {
   
   // Данные вибрации (структура)
   // Формат: [rms(4), rmsVelocity(4), peak(4), peakToPeak(4), crestFactor(4), 
-  //          dominantFreq(4), dominantAmp(4), status(1)] = 29 байт
-  uint8_t vibBuffer[29];
+  //          dominantFreq(4), dominantAmp(4), status(1),
+  //          X/Y/Z: rms(4), peak(4), crestFactor(4), dominantFreq(4)] = 77 байт
+  // Первые 29 байт прежние, старые клиенты читают только их
+  uint8_t vibBuffer[77];
   memcpy(vibBuffer, &vibData.rms, 4);
   memcpy(vibBuffer + 4, &vibData.rmsVelocity, 4);
   memcpy(vibBuffer + 8, &vibData.peak, 4);
@@ -640,23 +833,32 @@ void sendBLEData() {
   memcpy(vibBuffer + 20, &vibData.dominantFreq, 4);
   memcpy(vibBuffer + 24, &vibData.dominantAmp, 4);
   vibBuffer[28] = vibData.status;
+  for (int a = 0; a < 3; a++) {
+    memcpy(vibBuffer + 29 + a * 16, &vibData.axis[a], 16);
+  }
   
-  pVibrationCharacteristic->setValue(vibBuffer, 29);
+  pVibrationCharacteristic->setValue(vibBuffer, sizeof(vibBuffer));
   pVibrationCharacteristic->notify();
   
-  // Спектр (8 полос по 4 байта = 32 байта)
-  float bands[8];
-  getSpectrumBands(bands);
-  pSpectrumCharacteristic->setValue((uint8_t*)bands, 32);
+  // Спектр: 8 полос (32 байта), затем частота вращения (Гц) и порядковый
+  // спектр 0.5x..8x (16 float) = 100 байт. Старые клиенты читают первые 32
+  float spectrum[8 + 1 + ORDER_SPECTRUM_SIZE];
+  getSpectrumBands(spectrum);
+  spectrum[8] = vibData.runningSpeed;
+  memcpy(&spectrum[9], orderSpectrum, sizeof(orderSpectrum));
+  pSpectrumCharacteristic->setValue((uint8_t*)spectrum, sizeof(spectrum));
   pSpectrumCharacteristic->notify();
   
   // Статус JSON
-  char statusJson[200];
+  char statusJson[256];
   const char* statusText[] = {"Good", "Acceptable", "Alarm", "Danger"};
   snprintf(statusJson, sizeof(statusJson),
-    "{\"rms\":%.3f,\"vel\":%.2f,\"peak\":%.3f,\"cf\":%.2f,\"freq\":%.1f,\"status\":\"%s\",\"temp\":%.1f}",
+    "{\"rms\":%.3f,\"vel\":%.2f,\"peak\":%.3f,\"cf\":%.2f,\"freq\":%.1f,\"rpm\":%.0f,"
+    "\"o1\":%.3f,\"o2\":%.3f,\"o3\":%.3f,\"status\":\"%s\",\"temp\":%.1f}",
     vibData.rms, vibData.rmsVelocity, vibData.peak, vibData.crestFactor,
-    vibData.dominantFreq, statusText[vibData.status], temperature
+    vibData.dominantFreq, vibData.runningSpeed * 60.0f,
+    vibData.order1x, vibData.order2x, vibData.order3x,
+    statusText[vibData.status], temperature
   );
   pStatusCharacteristic->setValue(statusJson);
   pStatusCharacteristic->notify();
@@ -677,6 +879,21 @@ void printStatus() {
   Serial.printf("  Peak: %.4f м/с² | P-P: %.4f м/с²\n", vibData.peak, vibData.peakToPeak);
   Serial.printf("  Crest Factor: %.2f\n", vibData.crestFactor);
   Serial.printf("  Дом. частота: %.1f Гц (амплитуда: %.4f)\n", vibData.dominantFreq, vibData.dominantAmp);
+  Serial.printf("  Вращение: %.2f Гц (%.0f об/мин) | 1x: %.3f 2x: %.3f 3x: %.3f\n",
+    vibData.runningSpeed, vibData.runningSpeed * 60.0f,
+    vibData.order1x, vibData.order2x, vibData.order3x);
+  if (vibData.runningSpeed > 0) {
+    Serial.print("  Порядки:");
+    for (int i = 0; i < ORDER_SPECTRUM_SIZE; i++) {
+      Serial.printf(" %.1fx:%.3f", (i + 1) * ORDER_STEP, orderSpectrum[i]);
+    }
+    Serial.println();
+  }
+  for (int a = 0; a < 3; a++) {
+    const AxisStats& s = vibData.axis[a];
+    Serial.printf("  Ось %c: RMS %.4f | Peak %.4f | CF %.2f | %.1f Гц\n",
+      "XYZ"[a], s.rms, s.peak, s.crestFactor, s.dominantFreq);
+  }
   Serial.printf("  Температура: %.1f°C\n", temperature);
   Serial.printf("  Gravity: (%.3f, %.3f, %.3f) м/с²\n", gravityX, gravityY, gravityZ);
   